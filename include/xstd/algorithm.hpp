@@ -9,6 +9,11 @@
 #define INCLUDE_XSTD_ALGORITHM_HPP_
 
 
+#include "xstd/detail/algorithm/branchless_search.hpp"
+#include "xstd/detail/algorithm/gallop_search.hpp"
+#include "xstd/detail/algorithm/msd_radix_sort.hpp"
+#include "xstd/detail/algorithm/parallel_radix_sort.hpp"
+#include "xstd/detail/algorithm/radix_argsort.hpp"
 #include "xstd/detail/algorithm/radix_sort.hpp"
 
 
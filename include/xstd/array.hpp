@@ -10,5 +10,7 @@
 
 #include "xstd/detail/array/array_math.hpp"
 #include "xstd/detail/array/const_array.hpp"
+#include "xstd/detail/array/small_matrix.hpp"
+#include "xstd/detail/array/soa_array.hpp"
 
 #endif /* INCLUDE_XSTD_ARRAY_HPP_ */
@@ -14,5 +14,6 @@
 #include "xstd/detail/config/null_macros.hpp"
 #include "xstd/detail/config/platform.hpp"
 #include "xstd/detail/config/restrict.hpp"
+#include "xstd/detail/config/simd.hpp"
 
 #endif /* INCLUDE_XSTD_CONFIG_HPP_ */
@@ -0,0 +1,135 @@
+/**
+ * \file       branchless_search.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_ALGORITHM_BRANCHLESS_SEARCH_HPP_
+#define INCLUDE_XSTD_DETAIL_ALGORITHM_BRANCHLESS_SEARCH_HPP_
+
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+
+/**
+ * \file
+ * branchless_search.hpp
+ *
+ * \brief
+ * Binary searches without data dependent branches
+ *
+ * \details
+ * A classic binary search branches on every comparison which the
+ * processor can't predict so small lookup tables spend most of
+ * their time recovering from mispredictions. The branchless search
+ * always halves the range and selects the next base with a
+ * conditional move so the loop length only depends on the size.
+ *
+ * The Eytzinger layout stores a sorted array in the breadth first
+ * order of a complete binary tree. The children of node k live at
+ * 2k and 2k+1 so the next few levels of the search share a cache
+ * line and the hardware prefetcher can follow the access pattern.
+ * The layout suits read mostly tables built once and queried often.
+ */
+
+namespace xstd {
+
+/// Branchless search for the first element not less than value
+/**
+ * Returns the same iterator as std::lower_bound.
+ *
+ * \param first[in] Start of sorted range to search
+ * \param last[in] One past end of sorted range to search
+ * \param value[in] Value to compare elements against
+ * \param comp[in] Comparison returning true if first argument is less than second
+ *
+ * \returns Iterator to first element not less than value or last
+ */
+template<typename RandomIt, typename T, typename Compare>
+RandomIt branchless_lower_bound(RandomIt first, RandomIt last, const T& value, Compare comp){
+	using diff_type = typename std::iterator_traits<RandomIt>::difference_type;
+
+	diff_type n = last - first;
+	if( n == 0 ){
+		return first;
+	}
+	while( n > 1 ){
+		const diff_type half = n / 2;
+		first = comp(first[half], value) ? first + half : first;
+		n -= half;
+	}
+	return first + static_cast<diff_type>(comp(*first, value));
+}
+
+/// Branchless search for the first element not less than value
+template<typename RandomIt, typename T>
+RandomIt branchless_lower_bound(RandomIt first, RandomIt last, const T& value){
+	return branchless_lower_bound(first, last, value, std::less<>());
+}
+
+
+/// Copy a sorted range into Eytzinger (breadth first) order
+/**
+ * \param first[in] Start of sorted range
+ * \param last[in] One past end of sorted range
+ * \param d_first[out] Start of destination with room for last-first values
+ *
+ * \returns Iterator past the last element written
+ */
+template<typename RandomIt, typename OutputIt>
+OutputIt make_eytzinger(RandomIt first, RandomIt last, OutputIt d_first){
+	using diff_type = typename std::iterator_traits<RandomIt>::difference_type;
+
+	// In order walk of the implicit tree visits the sorted values in order
+	const diff_type n = last - first;
+	auto fill = [&](auto& self, const diff_type k) -> void {
+		if( k <= n ){
+			self(self, 2*k);
+			d_first[k - 1] = *first++;
+			self(self, 2*k + 1);
+		}
+	};
+	fill(fill, 1);
+	return d_first + n;
+}
+
+/// Search Eytzinger ordered values for the first element not less than value
+/**
+ * The result is the element std::lower_bound would find within the
+ * sorted values but as an iterator into the Eytzinger ordered range.
+ *
+ * \param first[in] Start of range in Eytzinger order
+ * \param last[in] One past end of range in Eytzinger order
+ * \param value[in] Value to compare elements against
+ * \param comp[in] Comparison returning true if first argument is less than second
+ *
+ * \returns Iterator to first element not less than value or last
+ */
+template<typename RandomIt, typename T, typename Compare>
+RandomIt eytzinger_lower_bound(RandomIt first, RandomIt last, const T& value, Compare comp){
+	const auto n = static_cast<std::size_t>(last - first);
+
+	// Descend to a leaf going right whenever the node is less
+	std::size_t k = 1;
+	while( k <= n ){
+		k = 2*k + static_cast<std::size_t>(comp(first[k - 1], value));
+	}
+
+	// Undo the trailing right turns plus the final left turn
+	k >>= std::countr_one(k) + 1;
+	return (k == 0) ? last : first + (k - 1);
+}
+
+/// Search Eytzinger ordered values for the first element not less than value
+template<typename RandomIt, typename T>
+RandomIt eytzinger_lower_bound(RandomIt first, RandomIt last, const T& value){
+	return eytzinger_lower_bound(first, last, value, std::less<>());
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_ALGORITHM_BRANCHLESS_SEARCH_HPP_ */
@@ -0,0 +1,99 @@
+/**
+ * \file       gallop_search.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_ALGORITHM_GALLOP_SEARCH_HPP_
+#define INCLUDE_XSTD_DETAIL_ALGORITHM_GALLOP_SEARCH_HPP_
+
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+/**
+ * \file
+ * gallop_search.hpp
+ *
+ * \brief
+ * Galloping (exponential) search within sorted ranges
+ *
+ * \details
+ * A galloping search probes positions 1, 3, 7, 15, ... from the
+ * start of the range until it passes the value and then performs a
+ * binary search within the last step. Finding a value d positions
+ * from the start costs O(log d) comparisons instead of O(log n)
+ * which makes repeatedly advancing a cursor through a long sorted
+ * range proportional to the distance moved.
+ */
+
+namespace xstd {
+
+/// Galloping search for the first element not less than value
+/**
+ * Returns the same iterator as std::lower_bound but searches
+ * outward from first so the cost depends on the distance to the
+ * result instead of the length of the range. Iterators which are
+ * not random access are advanced linearly.
+ *
+ * \code
+ * auto it = list.begin();
+ * for(auto v : probes){ // probes ascending
+ *     it = xstd::gallop_lower_bound(it, list.end(), v);
+ * }
+ * \endcode
+ *
+ * \param first[in] Start of sorted range to search
+ * \param last[in] One past end of sorted range to search
+ * \param value[in] Value to compare elements against
+ * \param comp[in] Comparison returning true if first argument is less than second
+ *
+ * \returns Iterator to first element not less than value or last
+ */
+template<typename ForwardIt, typename T, typename Compare>
+ForwardIt gallop_lower_bound(ForwardIt first, ForwardIt last, const T& value, Compare comp){
+	using category = typename std::iterator_traits<ForwardIt>::iterator_category;
+	using diff_type = typename std::iterator_traits<ForwardIt>::difference_type;
+
+	if constexpr ( std::is_base_of<std::random_access_iterator_tag, category>::value ) {
+		if( (first == last) || (not comp(*first, value)) ){
+			return first;
+		}
+		const diff_type n = last - first;
+		diff_type lo   = 0; // Known to be less than value
+		diff_type step = 1;
+		diff_type hi   = 1;
+		while( (hi < n) && comp(first[hi], value) ){
+			lo    = hi;
+			step *= 2;
+			hi    = lo + step;
+		}
+		return std::lower_bound(first + lo + 1, first + std::min(hi, n), value, comp);
+	}
+	else {
+		while( (first != last) && comp(*first, value) ){
+			++first;
+		}
+		return first;
+	}
+}
+
+/// Galloping search for the first element not less than value
+/**
+ * \param first[in] Start of sorted range to search
+ * \param last[in] One past end of sorted range to search
+ * \param value[in] Value to compare elements against
+ *
+ * \returns Iterator to first element not less than value or last
+ */
+template<typename ForwardIt, typename T>
+ForwardIt gallop_lower_bound(ForwardIt first, ForwardIt last, const T& value){
+	return gallop_lower_bound(first, last, value, std::less<>());
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_ALGORITHM_GALLOP_SEARCH_HPP_ */
@@ -0,0 +1,310 @@
+/**
+ * \file       msd_radix_sort.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_ALGORITHM_MSD_RADIX_SORT_HPP_
+#define INCLUDE_XSTD_DETAIL_ALGORITHM_MSD_RADIX_SORT_HPP_
+
+
+#include "xstd/assert.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * msd_radix_sort.hpp
+ *
+ * \brief
+ * Most Significant Digit (MSD) radix sort for byte string keys
+ *
+ * \details
+ * Sorts strings and other variable length byte sequences using an
+ * in-place American flag sort over one byte digits. Each key keeps
+ * a cache of its next 8 bytes so the bucketing of 8 consecutive
+ * digits reads only the cache instead of chasing the pointer to the
+ * key data. Buckets at or below a small size are finished with an
+ * insertion sort. Keys are ordered lexicographically by unsigned
+ * byte value with shorter prefixes first (as std::string does).
+ */
+
+/// @cond SKIP_DETAIL
+namespace xstd {
+namespace detail {
+
+/// Buckets at or below this length are insertion sorted
+constexpr std::size_t msd_radix_sort_insertion_limit = 32;
+
+/// Number of digits (end of key + 256 byte values)
+constexpr std::size_t msd_radix_sort_buckets = 257;
+
+/// Sort entry for a single key
+struct msd_entry {
+	std::uint64_t        cache;  // Next 8 key bytes (big endian) from cache depth
+	const unsigned char* bytes;  // Start of key bytes
+	std::size_t          length; // Number of key bytes
+	std::size_t          index;  // Position of record within the input range
+};
+
+/// Sub-range of entries still to be sorted
+struct msd_task {
+	msd_entry*  first;
+	msd_entry*  last;
+	std::size_t depth;      // Digit to sort on
+	std::size_t cache_base; // Depth of the first cached byte
+};
+
+/// Bytes and length of a string like key
+/// Key function results referring to bytes held by the record
+/**
+ * References, pointers and borrowed views (std::string_view,
+ * std::span, ...) stay valid after the key function returns. Owning
+ * values (std::array, std::string, ...) would be destroyed first.
+ */
+template<typename Key>
+concept msd_key_view = std::is_reference<Key>::value
+		|| std::is_pointer<Key>::value
+		|| std::ranges::borrowed_range<Key>;
+
+template<typename Key>
+std::pair<const unsigned char*, std::size_t> msd_key_bytes(const Key& key) {
+	if constexpr ( std::is_convertible<const Key&, std::string_view>::value ) {
+		const std::string_view view(key);
+		return {reinterpret_cast<const unsigned char*>(view.data()), view.size()};
+	}
+	else {
+		STATIC_ASSERT(sizeof(*std::data(key)) == 1, "Key must be a sequence of bytes");
+		return {reinterpret_cast<const unsigned char*>(std::data(key)), std::size(key)};
+	}
+}
+
+/// Load the 8 key bytes starting at depth (zero padded)
+inline void msd_load_cache(msd_entry& entry, const std::size_t depth) noexcept {
+	std::uint64_t cache = 0;
+	const std::size_t last = std::min(entry.length, depth + 8);
+	for(std::size_t i = depth; i < last; ++i){
+		cache |= std::uint64_t(entry.bytes[i]) << (56 - 8 * (i - depth));
+	}
+	entry.cache = cache;
+}
+
+/// Digit of entry at the cached byte with the given shift (0 = end of key)
+inline std::size_t msd_digit(const msd_entry& entry, const std::size_t depth, const unsigned shift) noexcept {
+	if( depth >= entry.length ){
+		return 0;
+	}
+	return 1 + static_cast<std::size_t>((entry.cache >> shift) & 0xFF);
+}
+
+/// Compare two keys known to be equal before depth
+/**
+ * Both caches must start at the same depth at or before depth.
+ * Zero padding of a shorter key can only compare less or equal
+ * so differing caches already determine the order.
+ */
+inline bool msd_less(const msd_entry& a, const msd_entry& b, const std::size_t depth) noexcept {
+	if( a.cache != b.cache ){
+		return a.cache < b.cache;
+	}
+	const auto a_rest = (a.length > depth) ? (a.length - depth) : 0;
+	const auto b_rest = (b.length > depth) ? (b.length - depth) : 0;
+	const auto common = std::min(a_rest, b_rest);
+	if( common > 0 ){
+		const int cmp = std::memcmp(a.bytes + depth, b.bytes + depth, common);
+		if( cmp != 0 ){
+			return cmp < 0;
+		}
+	}
+	return a_rest < b_rest;
+}
+
+/// Insertion sort of entries equal before depth
+inline void msd_insertion_sort(msd_entry* first, msd_entry* last, const std::size_t depth) noexcept {
+	for(auto i = first + 1; i < last; ++i){
+		const auto entry = *i;
+		auto j = i;
+		for(; (j != first) && msd_less(entry, *(j - 1), depth); --j){
+			*j = *(j - 1);
+		}
+		*j = entry;
+	}
+}
+
+/// American flag sort of entries by their byte keys
+inline void msd_radix_sort_entries(msd_entry* first, msd_entry* last) {
+	std::vector<msd_task> tasks;
+	tasks.push_back(msd_task{first, last, 0, 0});
+	for(auto it = first; it != last; ++it){
+		msd_load_cache(*it, 0);
+	}
+
+	std::size_t counts[msd_radix_sort_buckets];
+	std::size_t heads[msd_radix_sort_buckets];
+	std::size_t tails[msd_radix_sort_buckets];
+	while( not tasks.empty() ){
+		auto task = tasks.back();
+		tasks.pop_back();
+
+		while( true ){
+			const auto n = static_cast<std::size_t>(task.last - task.first);
+			if( n < 2 ){
+				break;
+			}
+
+			// Refill the caches once all 8 cached bytes were consumed
+			if( task.depth >= task.cache_base + 8 ){
+				for(auto it = task.first; it != task.last; ++it){
+					msd_load_cache(*it, task.depth);
+				}
+				task.cache_base = task.depth;
+			}
+			if( n <= msd_radix_sort_insertion_limit ){
+				msd_insertion_sort(task.first, task.last, task.depth);
+				break;
+			}
+
+			// Histogram the current digit from the cache
+			const auto shift = static_cast<unsigned>(56 - 8 * (task.depth - task.cache_base));
+			std::fill(counts, counts + msd_radix_sort_buckets, 0);
+			for(auto it = task.first; it != task.last; ++it){
+				++counts[msd_digit(*it, task.depth, shift)];
+			}
+
+			// All keys share the digit so move to the next one
+			if( counts[0] == n ){
+				break; // Every key ended and they are all equal
+			}
+			const auto single = std::find(counts + 1, counts + msd_radix_sort_buckets, n);
+			if( single != counts + msd_radix_sort_buckets ){
+				++task.depth;
+				continue;
+			}
+
+			// Permute entries in place into their buckets
+			std::size_t sum = 0;
+			for(std::size_t b = 0; b < msd_radix_sort_buckets; ++b){
+				heads[b] = sum;
+				sum     += counts[b];
+				tails[b] = sum;
+			}
+			for(std::size_t b = 0; b < msd_radix_sort_buckets; ++b){
+				while( heads[b] < tails[b] ){
+					auto entry = task.first[heads[b]];
+					auto d     = msd_digit(entry, task.depth, shift);
+					while( d != b ){
+						std::swap(entry, task.first[heads[d]++]);
+						d = msd_digit(entry, task.depth, shift);
+					}
+					task.first[heads[b]++] = entry;
+				}
+			}
+
+			// Bucket 0 holds equal keys which ended so skip it
+			for(std::size_t b = 1; b < msd_radix_sort_buckets; ++b){
+				if( counts[b] > 1 ){
+					const auto bucket_last = task.first + tails[b];
+					tasks.push_back(msd_task{bucket_last - counts[b], bucket_last, task.depth + 1, task.cache_base});
+				}
+			}
+			break;
+		}
+	}
+}
+
+} /* namespace detail */
+} /* namespace xstd */
+/// @endcond
+
+
+namespace xstd {
+
+/// MSD radix sort of records by an extracted byte string key
+/**
+ * Sorts the records within [first,last) into ascending
+ * lexicographical order of the keys returned by key_fn. A key can
+ * be anything convertible to std::string_view (std::string,
+ * const char*, ...) or a contiguous sequence of single byte values
+ * (std::vector<std::uint8_t>, std::array<char,N>, ...). Bytes are
+ * compared as unsigned values. The key function must return a
+ * reference, pointer or view (std::string_view, std::span, ...)
+ * into the record since keys are read while the records are being
+ * sorted. Owning values returned by value are rejected. The sort is
+ * not stable.
+ *
+ * \code
+ * struct Page { std::string url; std::uint32_t hits; };
+ * std::vector<Page> p = ...;
+ * xstd::msd_radix_sort(p.begin(), p.end(), [](const Page& x) -> const std::string& {return x.url;});
+ * \endcode
+ *
+ * \param first[in] Start of range to sort
+ * \param last[in] One past end of range to sort
+ * \param key_fn[in] Function returning the key of a record
+ */
+template<typename RandomIt, typename KeyFunction>
+void msd_radix_sort(RandomIt first, RandomIt last, KeyFunction key_fn){
+	using value_type  = typename std::iterator_traits<RandomIt>::value_type;
+	using result_type = std::invoke_result_t<KeyFunction&, const value_type&>;
+	STATIC_ASSERT(detail::msd_key_view<result_type>,
+			"Key function must return a reference or view into the record");
+
+	const auto n = static_cast<std::size_t>(std::distance(first, last));
+	if( n < 2 ){
+		return;
+	}
+
+	// Build the entries
+	std::vector<detail::msd_entry> entries(n);
+	for(std::size_t i = 0; i < n; ++i){
+		const auto [bytes, length] = detail::msd_key_bytes(std::invoke(key_fn, std::as_const(first[i])));
+		entries[i] = detail::msd_entry{0, bytes, length, i};
+	}
+
+	detail::msd_radix_sort_entries(entries.data(), entries.data() + n);
+
+	// Apply the sorted order to the records
+	std::vector<value_type> sorted;
+	sorted.reserve(n);
+	for(const auto& entry : entries){
+		sorted.push_back(std::move(first[entry.index]));
+	}
+	std::move(sorted.begin(), sorted.end(), first);
+}
+
+/// MSD radix sort of byte strings
+/**
+ * Sorts the strings within [first,last) into ascending
+ * lexicographical order. Values can be anything convertible to
+ * std::string_view or a contiguous sequence of single byte values.
+ *
+ * \code
+ * std::vector<std::string> urls = ...;
+ * xstd::msd_radix_sort(urls.begin(), urls.end());
+ * \endcode
+ *
+ * \param first[in] Start of range to sort
+ * \param last[in] One past end of range to sort
+ */
+template<typename RandomIt>
+void msd_radix_sort(RandomIt first, RandomIt last){
+	using value_type = typename std::iterator_traits<RandomIt>::value_type;
+	msd_radix_sort(first, last, [](const value_type& val) -> const value_type& {
+		return val;
+	});
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_ALGORITHM_MSD_RADIX_SORT_HPP_ */
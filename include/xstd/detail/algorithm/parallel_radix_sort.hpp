@@ -0,0 +1,279 @@
+/**
+ * \file       parallel_radix_sort.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_ALGORITHM_PARALLEL_RADIX_SORT_HPP_
+#define INCLUDE_XSTD_DETAIL_ALGORITHM_PARALLEL_RADIX_SORT_HPP_
+
+
+#include "xstd/detail/algorithm/radix_sort.hpp"
+#include "xstd/detail/thread/thread_pool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+/**
+ * \file
+ * parallel_radix_sort.hpp
+ *
+ * \brief
+ * Multithreaded LSD radix sort
+ *
+ * \details
+ * The range is split into one contiguous chunk per thread. For
+ * each digit every thread histograms its own chunk, an exclusive
+ * prefix sum over (bucket, thread) produces the scatter offset of
+ * each thread within each bucket and all threads then scatter
+ * concurrently into the scratch buffer. Since chunks are ordered
+ * the sort remains stable and the result is identical to the
+ * serial xstd::radix_sort.
+ */
+
+/// @cond SKIP_DETAIL
+namespace xstd {
+namespace detail {
+
+/// Ranges below this length are sorted serially
+constexpr std::size_t parallel_radix_sort_serial_limit = 1 << 16;
+
+/// Parallel LSD radix sort engine
+/**
+ * Same contract as detail::lsd_radix_sort but executed on the
+ * threads of pool.
+ */
+template<std::size_t Bits, typename RandomIt, typename BufferIt, typename KeyFunction>
+void parallel_lsd_radix_sort(thread_pool& pool, RandomIt first, RandomIt last, BufferIt buffer, KeyFunction key) {
+	using value_type = typename std::iterator_traits<RandomIt>::value_type;
+	using key_type   = std::decay_t<decltype(key(std::declval<const value_type&>()))>;
+	using digits     = radix_digits<key_type, Bits>;
+
+	const auto n          = static_cast<std::size_t>(std::distance(first, last));
+	const auto num_chunks = std::min(pool.size(), n / radix_sort_insertion_limit);
+	if( (n < parallel_radix_sort_serial_limit) || (num_chunks < 2) ){
+		lsd_radix_sort<Bits>(first, last, buffer, key);
+		return;
+	}
+	const auto chunk_size  = (n + num_chunks - 1) / num_chunks;
+	const auto chunk_first = [=](const std::size_t c){ return std::min(n, c * chunk_size); };
+	const auto chunk_last  = [=](const std::size_t c){ return std::min(n, (c + 1) * chunk_size); };
+
+	// Histogram every digit of every chunk within one read
+	// - Global sums decide which passes are skipped
+	// - Chunk counts of the first performed pass are reused
+	std::vector<std::size_t> counts(num_chunks * digits::passes * digits::buckets, 0);
+	pool.parallel_for(num_chunks, [&](const std::size_t c){
+		auto hist = counts.data() + c * digits::passes * digits::buckets;
+		for(auto it = first + chunk_first(c); it != first + chunk_last(c); ++it){
+			const auto k = key(*it);
+			for(std::size_t p = 0; p < digits::passes; ++p){
+				++hist[p * digits::buckets + digits::digit(k, p)];
+			}
+		}
+	});
+
+	std::vector<bool> skip_pass(digits::passes, false);
+	for(std::size_t p = 0; p < digits::passes; ++p){
+		for(std::size_t b = 0; b < digits::buckets; ++b){
+			std::size_t total = 0;
+			for(std::size_t c = 0; c < num_chunks; ++c){
+				total += counts[(c * digits::passes + p) * digits::buckets + b];
+			}
+			if( total == n ){
+				skip_pass[p] = true;
+				break;
+			}
+		}
+	}
+
+	// Chunk offsets for current pass: offsets[c * buckets + b]
+	std::vector<std::size_t> offsets(num_chunks * digits::buckets);
+	bool in_buffer = false;
+	bool moved     = false;
+	for(std::size_t p = 0; p < digits::passes; ++p){
+		if( skip_pass[p] ){
+			continue;
+		}
+
+		// Histogram chunks for this digit if values were moved
+		if( moved ){
+			std::fill(offsets.begin(), offsets.end(), 0);
+			pool.parallel_for(num_chunks, [&](const std::size_t c){
+				auto hist = offsets.data() + c * digits::buckets;
+				if( in_buffer ){
+					for(auto it = buffer + chunk_first(c); it != buffer + chunk_last(c); ++it){
+						++hist[digits::digit(key(*it), p)];
+					}
+				}
+				else {
+					for(auto it = first + chunk_first(c); it != first + chunk_last(c); ++it){
+						++hist[digits::digit(key(*it), p)];
+					}
+				}
+			});
+		}
+		else {
+			for(std::size_t c = 0; c < num_chunks; ++c){
+				const auto hist = counts.data() + (c * digits::passes + p) * digits::buckets;
+				std::copy(hist, hist + digits::buckets, offsets.begin() + c * digits::buckets);
+			}
+		}
+
+		// Exclusive prefix sum ordered by bucket then chunk
+		std::size_t sum = 0;
+		for(std::size_t b = 0; b < digits::buckets; ++b){
+			for(std::size_t c = 0; c < num_chunks; ++c){
+				const auto count = offsets[c * digits::buckets + b];
+				offsets[c * digits::buckets + b] = sum;
+				sum += count;
+			}
+		}
+
+		// Scatter all chunks concurrently
+		pool.parallel_for(num_chunks, [&](const std::size_t c){
+			auto chunk_offsets = offsets.data() + c * digits::buckets;
+			if( in_buffer ){
+				radix_scatter<digits>(buffer + chunk_first(c), buffer + chunk_last(c), first, chunk_offsets, p, key);
+			}
+			else {
+				radix_scatter<digits>(first + chunk_first(c), first + chunk_last(c), buffer, chunk_offsets, p, key);
+			}
+		});
+		in_buffer = not in_buffer;
+		moved     = true;
+	}
+
+	if( in_buffer ){
+		pool.parallel_for(num_chunks, [&](const std::size_t c){
+			std::move(buffer + chunk_first(c), buffer + chunk_last(c), first + chunk_first(c));
+		});
+	}
+}
+
+} /* namespace detail */
+} /* namespace xstd */
+/// @endcond
+
+
+namespace xstd {
+
+/// Parallel radix sort of values using Bits wide digits
+/**
+ * Sorts the values within [first,last) using the threads of pool.
+ * The result is identical to xstd::radix_sort<RadixBits>.
+ *
+ * \code
+ * xstd::thread_pool pool(64);
+ * xstd::parallel_radix_sort<16>(pool, a.begin(), a.end());
+ * \endcode
+ *
+ * \tparam RadixBits Width of each digit in bits (1-16)
+ *
+ * \param pool[in] Threads used to perform the sort
+ * \param first[in] Start of range to sort
+ * \param last[in] One past end of range to sort
+ */
+template<std::size_t RadixBits, typename RandomIt>
+void parallel_radix_sort(thread_pool& pool, RandomIt first, RandomIt last){
+	using value_type = typename std::iterator_traits<RandomIt>::value_type;
+	auto buffer = detail::radix_buffer(first, last);
+	detail::parallel_lsd_radix_sort<RadixBits>(pool, first, last, buffer.begin(), [](const value_type& val){
+		return radix_key(val);
+	});
+}
+
+/// Parallel radix sort of values
+/**
+ * Sorts the values within [first,last) using the threads of pool.
+ * The result is identical to xstd::radix_sort.
+ *
+ * \param pool[in] Threads used to perform the sort
+ * \param first[in] Start of range to sort
+ * \param last[in] One past end of range to sort
+ */
+template<typename RandomIt>
+void parallel_radix_sort(thread_pool& pool, RandomIt first, RandomIt last){
+	using value_type = typename std::iterator_traits<RandomIt>::value_type;
+	using key_type   = radix_key_t<value_type>;
+	parallel_radix_sort<detail::radix_default_bits<key_type>()>(pool, first, last);
+}
+
+/// Parallel radix sort of records by an extracted key using Bits wide digits
+/**
+ * Sorts the records within [first,last) by the key returned from
+ * key_fn using the threads of pool. The key function is called
+ * concurrently. The result is identical to xstd::radix_sort<RadixBits>.
+ *
+ * \tparam RadixBits Width of each digit in bits (1-16)
+ *
+ * \param pool[in] Threads used to perform the sort
+ * \param first[in] Start of range to sort
+ * \param last[in] One past end of range to sort
+ * \param key_fn[in] Function returning the key of a record
+ */
+template<std::size_t RadixBits, typename RandomIt, typename KeyFunction>
+void parallel_radix_sort(thread_pool& pool, RandomIt first, RandomIt last, KeyFunction key_fn){
+	using value_type = typename std::iterator_traits<RandomIt>::value_type;
+	auto buffer = detail::radix_buffer(first, last);
+	detail::parallel_lsd_radix_sort<RadixBits>(pool, first, last, buffer.begin(), [&key_fn](const value_type& val){
+		return radix_key(key_fn(val));
+	});
+}
+
+/// Parallel radix sort of records by an extracted key
+/**
+ * Sorts the records within [first,last) by the key returned from
+ * key_fn using the threads of pool. The result is identical to
+ * xstd::radix_sort.
+ *
+ * \param pool[in] Threads used to perform the sort
+ * \param first[in] Start of range to sort
+ * \param last[in] One past end of range to sort
+ * \param key_fn[in] Function returning the key of a record
+ */
+template<typename RandomIt, typename KeyFunction>
+void parallel_radix_sort(thread_pool& pool, RandomIt first, RandomIt last, KeyFunction key_fn){
+	using value_type = typename std::iterator_traits<RandomIt>::value_type;
+	using key_type   = radix_key_t<std::invoke_result_t<KeyFunction&, const value_type&>>;
+	parallel_radix_sort<detail::radix_default_bits<key_type>()>(pool, first, last, key_fn);
+}
+
+/// Parallel radix sort using a temporary pool of threads
+/**
+ * Creates a pool of num_threads threads for the duration of the
+ * sort. Callers sorting repeatedly should reuse a thread_pool.
+ *
+ * \param num_threads[in] Number of threads (0 for hardware concurrency)
+ * \param first[in] Start of range to sort
+ * \param last[in] One past end of range to sort
+ */
+template<typename RandomIt>
+void parallel_radix_sort(const std::size_t num_threads, RandomIt first, RandomIt last){
+	thread_pool pool(num_threads);
+	parallel_radix_sort(pool, first, last);
+}
+
+/// Parallel radix sort of records using a temporary pool of threads
+/**
+ * Creates a pool of num_threads threads for the duration of the
+ * sort. Callers sorting repeatedly should reuse a thread_pool.
+ *
+ * \param num_threads[in] Number of threads (0 for hardware concurrency)
+ * \param first[in] Start of range to sort
+ * \param last[in] One past end of range to sort
+ * \param key_fn[in] Function returning the key of a record
+ */
+template<typename RandomIt, typename KeyFunction>
+void parallel_radix_sort(const std::size_t num_threads, RandomIt first, RandomIt last, KeyFunction key_fn){
+	thread_pool pool(num_threads);
+	parallel_radix_sort(pool, first, last, key_fn);
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_ALGORITHM_PARALLEL_RADIX_SORT_HPP_ */
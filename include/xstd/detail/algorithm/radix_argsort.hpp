@@ -0,0 +1,173 @@
+/**
+ * \file       radix_argsort.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_ALGORITHM_RADIX_ARGSORT_HPP_
+#define INCLUDE_XSTD_DETAIL_ALGORITHM_RADIX_ARGSORT_HPP_
+
+
+#include "xstd/assert.hpp"
+#include "xstd/detail/algorithm/radix_sort.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * radix_argsort.hpp
+ *
+ * \brief
+ * Radix sorting for structure-of-arrays data
+ *
+ * \details
+ * Data held as parallel columns (one container per field) is
+ * ordered by computing the permutation that sorts one key column
+ * and then gathering every column through that permutation. Only
+ * (key, index) pairs are moved during the radix passes so the
+ * payload columns are each read and written exactly once.
+ */
+
+/// @cond SKIP_DETAIL
+namespace xstd {
+namespace detail {
+
+/// Radix key paired with its original position
+template<typename Key, typename Index>
+struct radix_indexed_key {
+	Key   key;
+	Index index;
+};
+
+/// Sorted (key, index) pairs of a key column
+template<typename IndexType, typename Container>
+auto radix_sorted_keys(const Container& keys) {
+	using value_type = std::decay_t<decltype(*std::begin(keys))>;
+	using key_type   = radix_key_t<value_type>;
+	using entry_type = radix_indexed_key<key_type, IndexType>;
+
+	const auto n = static_cast<std::size_t>(std::size(keys));
+	if( (n != 0) && (n - 1 > static_cast<std::size_t>(std::numeric_limits<IndexType>::max())) ){
+		throw std::length_error("radix_argsort: too many keys for index type");
+	}
+
+	std::vector<entry_type> entries(n);
+	auto it = std::begin(keys);
+	for(std::size_t i = 0; i < n; ++i, ++it){
+		entries[i] = entry_type{radix_key(*it), static_cast<IndexType>(i)};
+	}
+
+	std::vector<entry_type> buffer(n);
+	lsd_radix_sort<radix_default_bits<key_type>()>(entries.begin(), entries.end(), buffer.begin(), [](const entry_type& entry){
+		return entry.key;
+	});
+	return entries;
+}
+
+/// Reorder a column so column[i] = old_column[perm[i]]
+template<typename Container, typename Permutation>
+void radix_gather(Container& column, const Permutation& perm) {
+	using value_type = std::decay_t<decltype(*std::begin(column))>;
+	ASSERT( static_cast<std::size_t>(std::size(column)) == static_cast<std::size_t>(std::size(perm)) );
+
+	const auto first = std::begin(column);
+	std::vector<value_type> gathered;
+	gathered.reserve(std::size(perm));
+	for(const auto& p : perm){
+		gathered.push_back(std::move(first[p.index]));
+	}
+	std::move(gathered.begin(), gathered.end(), first);
+}
+
+/// Sort key column and gather every payload column
+template<typename IndexType, typename KeyContainer, typename... ValueContainers>
+void radix_sort_by_key_impl(KeyContainer& keys, ValueContainers&... values) {
+	const auto entries = radix_sorted_keys<IndexType>(keys);
+	radix_gather(keys, entries);
+	(radix_gather(values, entries), ...);
+}
+
+} /* namespace detail */
+} /* namespace xstd */
+/// @endcond
+
+
+namespace xstd {
+
+/// Permutation which sorts a key column
+/**
+ * Returns the indices that order keys into ascending order such
+ * that keys[perm[0]] <= keys[perm[1]] <= ... Equal keys keep their
+ * original relative order (the sort is stable). Keys may be any
+ * type supported by xstd::radix_key.
+ *
+ * \code
+ * std::vector<double> price = ...;
+ * std::vector<int>    qty   = ...;
+ * auto perm = xstd::radix_argsort(price);
+ * for(auto i : perm){ use(price[i], qty[i]); }
+ * \endcode
+ *
+ * \tparam IndexType Unsigned integer type of the indices returned
+ *
+ * \param keys[in] Random access container of keys
+ *
+ * \returns Vector of indices sorting keys
+ *
+ * \throws std::length_error if keys has more entries than IndexType can index
+ */
+template<typename IndexType = std::uint32_t, typename Container>
+std::vector<IndexType> radix_argsort(const Container& keys){
+	STATIC_ASSERT(std::is_unsigned<IndexType>::value, "Index type must be unsigned");
+	const auto entries = detail::radix_sorted_keys<IndexType>(keys);
+
+	std::vector<IndexType> perm(entries.size());
+	std::transform(entries.begin(), entries.end(), perm.begin(), [](const auto& entry){
+		return entry.index;
+	});
+	return perm;
+}
+
+/// Sort a key column and apply the same reordering to payload columns
+/**
+ * Sorts keys into ascending order while moving the entries of every
+ * values container along with their key, as if the columns were
+ * zipped together (see xstd::zip) and sorted by the first column.
+ * Each column is gathered once through the sorting permutation
+ * instead of shuffling tuples of references. All containers must be
+ * random access and the same size. The sort is stable.
+ *
+ * \code
+ * std::vector<std::int64_t> time = ...;
+ * std::vector<double>       value = ...;
+ * std::vector<std::string>  label = ...;
+ * xstd::radix_sort_by_key(time, value, label);
+ * \endcode
+ *
+ * \param keys[inout] Container of keys to sort
+ * \param values[inout] Containers reordered along with keys
+ */
+template<typename KeyContainer, typename... ValueContainers>
+void radix_sort_by_key(KeyContainer& keys, ValueContainers&... values){
+	const auto n = static_cast<std::size_t>(std::size(keys));
+	ASSERT( ((static_cast<std::size_t>(std::size(values)) == n) && ...) );
+	if( (n == 0) || (n - 1 <= static_cast<std::size_t>(std::numeric_limits<std::uint32_t>::max())) ){
+		detail::radix_sort_by_key_impl<std::uint32_t>(keys, values...);
+	}
+	else {
+		detail::radix_sort_by_key_impl<std::uint64_t>(keys, values...);
+	}
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_ALGORITHM_RADIX_ARGSORT_HPP_ */
@@ -11,55 +11,336 @@
 #include "xstd/assert.hpp"
 
 #include <algorithm>
-#include <cmath>
-#include <functional>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
-#include <list>
+#include <limits>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
+/**
+ * \file
+ * radix_sort.hpp
+ *
+ * \brief
+ * Least Significant Digit (LSD) radix sort
+ *
+ * \details
+ * The sort is built on counting histograms of fixed width binary
+ * digits (8, 11 or 16 bits are typical). The histograms for every
+ * digit are gathered during a single read of the input, after which
+ * each pass scatters the values between the input range and one
+ * scratch buffer. Passes where every key shares the same digit are
+ * skipped entirely. No allocations are made per element.
+ *
+ * Signed integers, floating point values and enumerations are
+ * sorted through an order preserving bijection onto unsigned
+ * keys (see xstd::radix_key) so negative values are supported.
+ */
 
-namespace xstd{
+/// @cond SKIP_DETAIL
+namespace xstd {
+namespace detail {
 
+/// Unsigned integer type of the given width in bytes
+template<std::size_t Bytes>
+struct radix_unsigned;
 
-template< class RandomIt>
-void radix_sort(RandomIt first, RandomIt last){
-	using size_type  = std::size_t;
+template<> struct radix_unsigned<1> { using type = std::uint8_t;  };
+template<> struct radix_unsigned<2> { using type = std::uint16_t; };
+template<> struct radix_unsigned<4> { using type = std::uint32_t; };
+template<> struct radix_unsigned<8> { using type = std::uint64_t; };
+
+/// Ranges at or below this length are insertion sorted
+constexpr std::size_t radix_sort_insertion_limit = 64;
+
+/// Default digit width (in bits) for an unsigned key type
+/**
+ * Keys of 16 bits or less use 8 bit digits while wider keys
+ * use 11 bit digits so each histogram (2048 counters) still
+ * fits within L1 cache.
+ */
+template<typename Key>
+constexpr std::size_t radix_default_bits() noexcept {
+	return (std::numeric_limits<Key>::digits <= 16) ? 8 : 11;
+}
+
+/// Digit layout of an unsigned key split into Bits wide digits
+template<typename Key, std::size_t Bits>
+struct radix_digits {
+	STATIC_ASSERT(std::is_unsigned<Key>::value, "Radix keys must be unsigned");
+	STATIC_ASSERT(Bits > 0 && Bits <= 16, "Radix digit must be 1-16 bits");
+
+	static constexpr std::size_t key_bits = std::numeric_limits<Key>::digits;
+	static constexpr std::size_t bits     = Bits;
+	static constexpr std::size_t buckets  = std::size_t(1) << Bits;
+	static constexpr std::size_t passes   = (key_bits + Bits - 1) / Bits;
+	static constexpr std::size_t mask     = buckets - 1;
+
+	static constexpr std::size_t digit(const Key key, const std::size_t pass) noexcept {
+		return static_cast<std::size_t>(key >> (pass * Bits)) & mask;
+	}
+};
+
+/// Stable insertion sort ordered by the extracted radix key
+template<typename RandomIt, typename KeyFunction>
+void radix_insertion_sort(RandomIt first, RandomIt last, KeyFunction key) {
+	if( first == last ){
+		return;
+	}
+	for(auto i = std::next(first); i != last; ++i){
+		auto value     = std::move(*i);
+		const auto k   = key(value);
+		auto j         = i;
+		for(; (j != first) && (k < key(*std::prev(j))); --j){
+			*j = std::move(*std::prev(j));
+		}
+		*j = std::move(value);
+	}
+}
+
+/// Exclusive prefix sum of a histogram
+/**
+ * Converts the bucket counts into the starting offset of
+ * each bucket. Returns false if a single bucket contains
+ * all n values in which case the pass can be skipped.
+ */
+template<std::size_t Buckets>
+bool radix_offsets(std::size_t* counts, const std::size_t n) noexcept {
+	std::size_t sum = 0;
+	for(std::size_t b = 0; b < Buckets; ++b){
+		const auto count = counts[b];
+		if( count == n ){
+			return false;
+		}
+		counts[b] = sum;
+		sum += count;
+	}
+	return true;
+}
+
+/// Scatter one digit of [first,last) into dest using bucket offsets
+template<typename Digits, typename InputIt, typename OutputIt, typename KeyFunction>
+void radix_scatter(InputIt first, InputIt last, OutputIt dest, std::size_t* offsets, const std::size_t pass, KeyFunction key) {
+	for(; first != last; ++first){
+		const auto d = Digits::digit(key(*first), pass);
+		dest[offsets[d]++] = std::move(*first);
+	}
+}
+
+/// LSD radix sort engine
+/**
+ * Sorts [first,last) by the unsigned key returned from key(value).
+ * The scratch range starting at buffer must hold at least
+ * distance(first,last) values. The sort is stable.
+ *
+ * \tparam Bits Width of each digit in bits
+ *
+ * \param first[in] Start of range to sort
+ * \param last[in] One past end of range to sort
+ * \param buffer[in] Start of scratch range
+ * \param key[in] Function returning the unsigned key of a value
+ */
+template<std::size_t Bits, typename RandomIt, typename BufferIt, typename KeyFunction>
+void lsd_radix_sort(RandomIt first, RandomIt last, BufferIt buffer, KeyFunction key) {
 	using value_type = typename std::iterator_traits<RandomIt>::value_type;
+	using key_type   = std::decay_t<decltype(key(std::declval<const value_type&>()))>;
+	using digits     = radix_digits<key_type, Bits>;
+
+	const auto n = static_cast<std::size_t>(std::distance(first, last));
+	if( n <= radix_sort_insertion_limit ){
+		radix_insertion_sort(first, last, key);
+		return;
+	}
 
-	// Assert values are Integers and all values are Positive
-	STATIC_ASSERT(std::is_integral<value_type>::value, "Integral required");
-	ASSERT( std::all_of(first,last,[](value_type val){return val >= value_type(0);}) );
-
-	const size_type one = 1;
-	const size_type ten = 10;
-
-	// Get max number of digits in numbers
-	auto max_value   = *std::max_element(first,last);
-	auto max_digits  = static_cast<size_type>(std::log10(max_value)) + one;
-
-	// Loop over each digit
-	std::list<value_type> pocket[10];
-	for(size_type i = 0; i < max_digits; ++i) {
-		const size_type m = std::pow(ten, i+1);
-		const size_type p = std::pow(ten, i);
-
-		// Place values into bins
-		auto iter = first;
-		for(; iter != last; ++iter){
-			auto temp = *iter % m;
-			auto indx = temp / p;
-			pocket[indx].push_back(*iter);
+	// Histogram every digit within a single read of the keys
+	std::vector<std::size_t> counts(digits::passes * digits::buckets, 0);
+	for(auto it = first; it != last; ++it){
+		const auto k = key(*it);
+		for(std::size_t p = 0; p < digits::passes; ++p){
+			++counts[p * digits::buckets + digits::digit(k, p)];
 		}
+	}
 
-		// Copy values back out
-		iter = first;
-		for(size_type j = 0; j < ten; ++j){
-			iter = std::copy(pocket[j].cbegin(),pocket[j].cend(),iter);
-			pocket[j].clear();
+	// Ping-pong between the input and scratch buffer
+	bool in_buffer = false;
+	for(std::size_t p = 0; p < digits::passes; ++p){
+		auto offsets = counts.data() + p * digits::buckets;
+		if( not radix_offsets<digits::buckets>(offsets, n) ){
+			continue; // All keys share this digit
+		}
+		if( in_buffer ){
+			radix_scatter<digits>(buffer, buffer + n, first, offsets, p, key);
+		}
+		else {
+			radix_scatter<digits>(first, last, buffer, offsets, p, key);
 		}
+		in_buffer = not in_buffer;
+	}
+	if( in_buffer ){
+		std::move(buffer, buffer + n, first);
+	}
+}
+
+/// Scratch buffer able to hold distance(first,last) values
+/**
+ * Default constructs the buffer when possible, otherwise the
+ * values are copied so non default constructible records
+ * can still be sorted.
+ */
+template<typename RandomIt>
+auto radix_buffer(RandomIt first, RandomIt last) {
+	using value_type = typename std::iterator_traits<RandomIt>::value_type;
+	if constexpr ( std::is_default_constructible<value_type>::value ) {
+		return std::vector<value_type>(std::distance(first, last));
+	}
+	else {
+		return std::vector<value_type>(first, last);
 	}
 }
 
+} /* namespace detail */
+} /* namespace xstd */
+/// @endcond
+
+
+namespace xstd {
+
+/// Order preserving map of a value onto an unsigned key
+/**
+ * Maps integer, floating point and enumeration values onto an
+ * unsigned integer of the same width such that the unsigned
+ * ordering of the keys matches the ordering of the values.
+ * - Unsigned integers are returned unchanged
+ * - Signed integers have the sign bit flipped
+ * - IEEE-754 values have all bits flipped when negative or
+ *   only the sign bit flipped when positive
+ * - Enumerations use the key of their underlying type
+ *
+ * Floating point keys order -0.0 before +0.0 and place NaN
+ * values at the extremes according to their sign bit.
+ *
+ * \param value[in] Value to convert into a key
+ *
+ * \returns Unsigned key with ordering of value
+ */
+template<typename T>
+constexpr auto radix_key(const T value) noexcept {
+	if constexpr ( std::is_enum<T>::value ) {
+		return radix_key(static_cast<std::underlying_type_t<T>>(value));
+	}
+	else if constexpr ( std::is_unsigned<T>::value ) {
+		STATIC_ASSERT(not std::is_same<T, bool>::value, "Radix key of bool");
+		return value;
+	}
+	else if constexpr ( std::is_integral<T>::value ) {
+		using key_type = std::make_unsigned_t<T>;
+		constexpr key_type sign_bit = key_type(1) << std::numeric_limits<T>::digits;
+		return static_cast<key_type>(static_cast<key_type>(value) ^ sign_bit);
+	}
+	else {
+		STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "Radix key requires integer or IEEE-754 type");
+		using key_type = typename detail::radix_unsigned<sizeof(T)>::type;
+		constexpr key_type sign_bit = key_type(1) << (std::numeric_limits<key_type>::digits - 1);
+		const auto bits = std::bit_cast<key_type>(value);
+		return static_cast<key_type>((bits & sign_bit) ? ~bits : (bits | sign_bit));
+	}
+}
+
+/// Unsigned key type returned by radix_key for T
+template<typename T>
+using radix_key_t = decltype(radix_key(std::declval<T>()));
+
+
+/// Radix sort of values using Bits wide digits
+/**
+ * Sorts the integer, floating point or enumeration values within
+ * [first,last) into ascending order using an LSD radix sort with
+ * digits of RadixBits bits. A single scratch buffer the size of
+ * the range is allocated.
+ *
+ * \code
+ * std::vector<std::uint32_t> a = ...;
+ * xstd::radix_sort<16>(a.begin(), a.end()); // 2 passes of 16 bits
+ * \endcode
+ *
+ * \tparam RadixBits Width of each digit in bits (1-16)
+ *
+ * \param first[in] Start of range to sort
+ * \param last[in] One past end of range to sort
+ */
+template<std::size_t RadixBits, typename RandomIt>
+void radix_sort(RandomIt first, RandomIt last){
+	using value_type = typename std::iterator_traits<RandomIt>::value_type;
+	auto buffer = detail::radix_buffer(first, last);
+	detail::lsd_radix_sort<RadixBits>(first, last, buffer.begin(), [](const value_type& val){
+		return radix_key(val);
+	});
+}
+
+/// Radix sort of values
+/**
+ * Sorts the integer, floating point or enumeration values within
+ * [first,last) into ascending order using an LSD radix sort. The
+ * digit width is chosen based on the size of the value type.
+ *
+ * \param first[in] Start of range to sort
+ * \param last[in] One past end of range to sort
+ */
+template<typename RandomIt>
+void radix_sort(RandomIt first, RandomIt last){
+	using value_type = typename std::iterator_traits<RandomIt>::value_type;
+	using key_type   = radix_key_t<value_type>;
+	radix_sort<detail::radix_default_bits<key_type>()>(first, last);
+}
+
+/// Radix sort of records by an extracted key using Bits wide digits
+/**
+ * Sorts the records within [first,last) into ascending order of
+ * the key returned by key_fn. Whole records are moved during each
+ * pass while the key is extracted again when needed. The key may be
+ * any type supported by xstd::radix_key. The sort is stable.
+ *
+ * \code
+ * struct Score { std::uint32_t id; double value; };
+ * std::vector<Score> s = ...;
+ * xstd::radix_sort(s.begin(), s.end(), [](const Score& x){return x.value;});
+ * \endcode
+ *
+ * \tparam RadixBits Width of each digit in bits (1-16)
+ *
+ * \param first[in] Start of range to sort
+ * \param last[in] One past end of range to sort
+ * \param key_fn[in] Function returning the key of a record
+ */
+template<std::size_t RadixBits, typename RandomIt, typename KeyFunction>
+void radix_sort(RandomIt first, RandomIt last, KeyFunction key_fn){
+	using value_type = typename std::iterator_traits<RandomIt>::value_type;
+	auto buffer = detail::radix_buffer(first, last);
+	detail::lsd_radix_sort<RadixBits>(first, last, buffer.begin(), [&key_fn](const value_type& val){
+		return radix_key(key_fn(val));
+	});
+}
+
+/// Radix sort of records by an extracted key
+/**
+ * Sorts the records within [first,last) into ascending order of
+ * the key returned by key_fn. The digit width is chosen based on
+ * the size of the key. The sort is stable.
+ *
+ * \param first[in] Start of range to sort
+ * \param last[in] One past end of range to sort
+ * \param key_fn[in] Function returning the key of a record
+ */
+template<typename RandomIt, typename KeyFunction>
+void radix_sort(RandomIt first, RandomIt last, KeyFunction key_fn){
+	using value_type = typename std::iterator_traits<RandomIt>::value_type;
+	using key_type   = radix_key_t<std::invoke_result_t<KeyFunction&, const value_type&>>;
+	radix_sort<detail::radix_default_bits<key_type>()>(first, last, key_fn);
+}
+
 } /* namespace xstd */
 
 #endif /* INCLUDE_XSTD_ALGORITHM_RADIX_SORT_HPP_ */
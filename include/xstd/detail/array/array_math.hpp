@@ -9,11 +9,22 @@
 #define ARRAY_MATH_HPP_
 
 #include "xstd/assert.hpp"
+#include "xstd/detail/config/inline.hpp"
+#include "xstd/detail/config/simd.hpp"
 
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstdlib>
+#include <functional>
+#include <limits>
 #include <type_traits>
+#include <utility>
+
+#if defined(XSTD_HAS_AVX)
+#include <immintrin.h>
+#endif
 
 /**
  * \file
@@ -24,8 +35,11 @@
  *
  * \details
  * Provides template functions for math operations on std::array<>.
- * The operations are inefficient and the user should consider some
- * type of TMP lazy evaluation library if performance is a concern.
+ * Every operation is expanded over a std::index_sequence so loops
+ * are fully unrolled and all functions can be used within constant
+ * expressions. When compiled with AVX the element wise operations
+ * on std::array<double,4> and std::array<float,8> are performed on
+ * a single SIMD register outside of constant evaluation.
  *
  * Note:
  * All functions are added into xstd namespace so any code using the
@@ -35,20 +49,188 @@
 
 namespace xstd {
 
+/// @cond SKIP_DETAIL
+namespace detail {
+
+template<typename T>
+constexpr T array_abs(const T x) noexcept {
+	if constexpr ( std::is_unsigned<T>::value ) {
+		return x;
+	}
+	else {
+		return (x < T(0)) ? -x : x;
+	}
+}
+
+/// Square root usable within constant expressions
+template<typename T>
+constexpr T array_sqrt(const T x) noexcept {
+	if( std::is_constant_evaluated() ){
+		using real_type = std::conditional_t<std::is_floating_point<T>::value, T, double>;
+		const auto v = static_cast<real_type>(x);
+		if( v < real_type(0) ){
+			return static_cast<T>(std::numeric_limits<real_type>::quiet_NaN());
+		}
+		if( (v == real_type(0)) || (v == std::numeric_limits<real_type>::infinity()) || (v != v) ){
+			return x;
+		}
+
+		// Newton iterations decrease monotonically from above the root
+		real_type cur = (v > real_type(1)) ? v : real_type(1);
+		while( true ){
+			const real_type next = real_type(0.5) * (cur + v / cur);
+			if( not (next < cur) ){
+				break;
+			}
+			cur = next;
+		}
+		return static_cast<T>(cur);
+	}
+	using std::sqrt;
+	return static_cast<T>(sqrt(x));
+}
+
+template<typename R, std::size_t N, typename T>
+constexpr std::array<R,N> array_fill(const T& value) noexcept {
+	std::array<R,N> ans{};
+	ans.fill(static_cast<R>(value));
+	return ans;
+}
+
+template<typename R, typename Op, typename T, std::size_t N, std::size_t... I>
+constexpr std::array<R,N> array_map(const Op& op, const std::array<T,N>& a, std::index_sequence<I...>) noexcept {
+	return {{ static_cast<R>(op(a[I]))... }};
+}
+
+template<typename R, typename Op, typename T1, typename T2, std::size_t N, std::size_t... I>
+constexpr std::array<R,N> array_zip(const Op& op, const std::array<T1,N>& a, const std::array<T2,N>& b, std::index_sequence<I...>) noexcept {
+	return {{ static_cast<R>(op(a[I], b[I]))... }};
+}
+
+template<typename T1, typename T2, std::size_t N, std::size_t... I>
+constexpr void array_assign(std::array<T1,N>& a, const std::array<T2,N>& b, std::index_sequence<I...>) noexcept {
+	((a[I] = static_cast<T1>(b[I])), ...);
+}
+
+template<typename R, typename T1, typename T2, std::size_t N, std::size_t... I>
+constexpr R array_dot(const std::array<T1,N>& a, const std::array<T2,N>& b, std::index_sequence<I...>) noexcept {
+	return (R(0) + ... + (a[I] * b[I]));
+}
+
+template<typename T, std::size_t N, std::size_t... I>
+constexpr T array_asum(const std::array<T,N>& a, std::index_sequence<I...>) noexcept {
+	return (T(0) + ... + array_abs(a[I]));
+}
+
+template<typename T, std::size_t N, std::size_t... I>
+constexpr T array_amax(const std::array<T,N>& a, std::index_sequence<I...>) noexcept {
+	T ans(0);
+	((ans = std::max(ans, array_abs(a[I]))), ...);
+	return ans;
+}
+
+/// Element wise minimum matching std::min(a,b)
+struct array_min_op {
+	template<typename T1, typename T2>
+	constexpr auto operator()(const T1& a, const T2& b) const noexcept {
+		using R = std::common_type_t<T1,T2>;
+		return (static_cast<R>(b) < static_cast<R>(a)) ? static_cast<R>(b) : static_cast<R>(a);
+	}
+};
+
+/// Element wise maximum matching std::max(a,b)
+struct array_max_op {
+	template<typename T1, typename T2>
+	constexpr auto operator()(const T1& a, const T2& b) const noexcept {
+		using R = std::common_type_t<T1,T2>;
+		return (static_cast<R>(a) < static_cast<R>(b)) ? static_cast<R>(b) : static_cast<R>(a);
+	}
+};
+
+/// Fold the values of an array from the left with Op
+template<typename Op, typename T, std::size_t N, std::size_t... I>
+constexpr T array_fold(const std::array<T,N>& a, std::index_sequence<I...>) noexcept {
+	T ans = a[0];
+	((ans = Op()(ans, a[I + 1])), ...);
+	return ans;
+}
+
+
+#if defined(XSTD_HAS_AVX)
+
+/// Arrays filling one AVX register
+template<typename T, std::size_t N>
+struct array_simd : std::false_type {};
+
+template<>
+struct array_simd<double,4> : std::true_type {
+	static XSTD_FORCE_INLINE __m256d load(const std::array<double,4>& a) noexcept { return _mm256_loadu_pd(a.data()); }
+	static XSTD_FORCE_INLINE void store(std::array<double,4>& a, __m256d v) noexcept { _mm256_storeu_pd(a.data(), v); }
+	static XSTD_FORCE_INLINE __m256d apply(std::plus<>,       __m256d a, __m256d b) noexcept { return _mm256_add_pd(a, b); }
+	static XSTD_FORCE_INLINE __m256d apply(std::minus<>,      __m256d a, __m256d b) noexcept { return _mm256_sub_pd(a, b); }
+	static XSTD_FORCE_INLINE __m256d apply(std::multiplies<>, __m256d a, __m256d b) noexcept { return _mm256_mul_pd(a, b); }
+	static XSTD_FORCE_INLINE __m256d apply(std::divides<>,    __m256d a, __m256d b) noexcept { return _mm256_div_pd(a, b); }
+	static XSTD_FORCE_INLINE __m256d apply(array_min_op,      __m256d a, __m256d b) noexcept { return _mm256_min_pd(b, a); }
+	static XSTD_FORCE_INLINE __m256d apply(array_max_op,      __m256d a, __m256d b) noexcept { return _mm256_max_pd(b, a); }
+};
+
+template<>
+struct array_simd<float,8> : std::true_type {
+	static XSTD_FORCE_INLINE __m256 load(const std::array<float,8>& a) noexcept { return _mm256_loadu_ps(a.data()); }
+	static XSTD_FORCE_INLINE void store(std::array<float,8>& a, __m256 v) noexcept { _mm256_storeu_ps(a.data(), v); }
+	static XSTD_FORCE_INLINE __m256 apply(std::plus<>,       __m256 a, __m256 b) noexcept { return _mm256_add_ps(a, b); }
+	static XSTD_FORCE_INLINE __m256 apply(std::minus<>,      __m256 a, __m256 b) noexcept { return _mm256_sub_ps(a, b); }
+	static XSTD_FORCE_INLINE __m256 apply(std::multiplies<>, __m256 a, __m256 b) noexcept { return _mm256_mul_ps(a, b); }
+	static XSTD_FORCE_INLINE __m256 apply(std::divides<>,    __m256 a, __m256 b) noexcept { return _mm256_div_ps(a, b); }
+	static XSTD_FORCE_INLINE __m256 apply(array_min_op,      __m256 a, __m256 b) noexcept { return _mm256_min_ps(b, a); }
+	static XSTD_FORCE_INLINE __m256 apply(array_max_op,      __m256 a, __m256 b) noexcept { return _mm256_max_ps(b, a); }
+};
+
+#endif // defined(XSTD_HAS_AVX)
+
+/// Element wise binary operation of two arrays
+/**
+ * Arrays of the same type filling one SIMD register are computed
+ * with a single instruction outside of constant evaluation.
+ */
+template<typename Op, typename T1, typename T2, std::size_t N>
+constexpr std::array<std::common_type_t<T1,T2>,N>
+array_binary(const std::array<T1,N>& a, const std::array<T2,N>& b) noexcept {
+	using R = std::common_type_t<T1,T2>;
+#if defined(XSTD_HAS_AVX)
+	if constexpr ( std::is_same<T1,T2>::value && array_simd<R,N>::value ) {
+		if( not std::is_constant_evaluated() ){
+			using simd = array_simd<R,N>;
+			std::array<R,N> ans;
+			simd::store(ans, simd::apply(Op(), simd::load(a), simd::load(b)));
+			return ans;
+		}
+	}
+#endif
+	return array_zip<R>(Op(), a, b, std::make_index_sequence<N>());
+}
+
+/// Element wise binary operation with a scalar broadcast to every element
+template<typename Op, typename T1, typename T2, std::size_t N>
+constexpr std::array<std::common_type_t<T1,T2>,N>
+array_binary(const std::array<T1,N>& a, const T2& b) noexcept {
+	using R = std::common_type_t<T1,T2>;
+	return array_binary<Op>(a, array_fill<R,N>(b));
+}
+
+} /* namespace detail */
+/// @endcond
+
 // ============================================================
 //                    Unary Operations
 // ============================================================
 template<typename T, std::size_t N>
-std::array<T,N> operator -(const std::array<T,N>& a) noexcept{
-	std::array<T,N> ans;
-	for(std::size_t i = 0; i < N; ++i){
-		ans[i] = -a[i];
-	}
-	return ans;
+constexpr std::array<T,N> operator -(const std::array<T,N>& a) noexcept{
+	return detail::array_map<T>(std::negate<>(), a, std::make_index_sequence<N>());
 }
 
 template<typename T1, std::size_t N>
-std::array<T1,N> operator +(const std::array<T1,N>& a) noexcept{
+constexpr std::array<T1,N> operator +(const std::array<T1,N>& a) noexcept{
 	return a;
 }
 
@@ -57,100 +239,79 @@ std::array<T1,N> operator +(const std::array<T1,N>& a) noexcept{
 // ============================================================
 
 template<typename T1, typename T2, std::size_t N>
-void operator +=(std::array<T1,N>& a, const T2& b) noexcept{
+constexpr void operator +=(std::array<T1,N>& a, const T2& b) noexcept{
 	STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
-	for(std::size_t i = 0; i < N; ++i){
-		a[i] += b;
-	}
+	detail::array_assign(a, detail::array_binary<std::plus<>>(a, b), std::make_index_sequence<N>());
 }
 
 template<typename T1, typename T2, std::size_t N>
-void operator -=(std::array<T1,N>& a, const T2& b) noexcept{
+constexpr void operator -=(std::array<T1,N>& a, const T2& b) noexcept{
 	STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
-	for(std::size_t i = 0; i < N; ++i){
-		a[i] -= b;
-	}
+	detail::array_assign(a, detail::array_binary<std::minus<>>(a, b), std::make_index_sequence<N>());
 }
 
 template<typename T1, typename T2, std::size_t N>
-void operator *=(std::array<T1,N>& a, const T2& b) noexcept{
+constexpr void operator *=(std::array<T1,N>& a, const T2& b) noexcept{
 	STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
-	for(std::size_t i = 0; i < N; ++i){
-		a[i] *= b;
-	}
+	detail::array_assign(a, detail::array_binary<std::multiplies<>>(a, b), std::make_index_sequence<N>());
 }
 
 template<typename T1, typename T2, std::size_t N>
-void operator /=(std::array<T1,N>& a, const T2& b) noexcept{
+constexpr void operator /=(std::array<T1,N>& a, const T2& b) noexcept{
 	STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
-	for(std::size_t i = 0; i < N; ++i){
-		a[i] /= b;
-	}
+	detail::array_assign(a, detail::array_binary<std::divides<>>(a, b), std::make_index_sequence<N>());
 }
 
 template<typename T1, typename T2, std::size_t N>
-std::array<std::common_type_t<T1,T2>,N>
+constexpr std::array<std::common_type_t<T1,T2>,N>
 operator +(const std::array<T1,N>& a, const T2& b) noexcept{
-	std::array<std::common_type_t<T1,T2>,N> ans(a);
-	ans += b;
-	return ans;
+	return detail::array_binary<std::plus<>>(a, b);
 }
 
 template<typename T1, typename T2, std::size_t N>
-std::array<std::common_type_t<T1,T2>,N>
+constexpr std::array<std::common_type_t<T1,T2>,N>
 operator +(const T2& b, const std::array<T1,N>& a) noexcept{
-	std::array<std::common_type_t<T1,T2>,N> ans(a);
-	ans += b;
-	return ans;
+	using R = std::common_type_t<T1,T2>;
+	return detail::array_binary<std::plus<>>(detail::array_fill<R,N>(b), a);
 }
 
 template<typename T1, typename T2, std::size_t N>
-std::array<std::common_type_t<T1,T2>,N>
+constexpr std::array<std::common_type_t<T1,T2>,N>
 operator -(const std::array<T1,N>& a, const T2& b) noexcept{
-	std::array<std::common_type_t<T1,T2>,N> ans(a);
-	ans -= b;
-	return ans;
+	return detail::array_binary<std::minus<>>(a, b);
 }
 
 template<typename T1, typename T2, std::size_t N>
-std::array<std::common_type_t<T1,T2>,N>
+constexpr std::array<std::common_type_t<T1,T2>,N>
 operator -(const T2& b, const std::array<T1,N>& a) noexcept{
-	std::array<std::common_type_t<T1,T2>,N> ans(-a);
-	ans += b;
-	return ans;
+	using R = std::common_type_t<T1,T2>;
+	return detail::array_binary<std::minus<>>(detail::array_fill<R,N>(b), a);
 }
 
 template<typename T1, typename T2, std::size_t N>
-std::array<std::common_type_t<T1,T2>,N>
+constexpr std::array<std::common_type_t<T1,T2>,N>
 operator *(const std::array<T1,N>& a, const T2& b) noexcept{
-	std::array<std::common_type_t<T1,T2>,N> ans(a);
-	ans *= b;
-	return ans;
+	return detail::array_binary<std::multiplies<>>(a, b);
 }
 
 template<typename T1, typename T2, std::size_t N>
-std::array<std::common_type_t<T1,T2>,N>
+constexpr std::array<std::common_type_t<T1,T2>,N>
 operator *(const T2& b, const std::array<T1,N>& a) noexcept{
-	std::array<std::common_type_t<T1,T2>,N> ans(a);
-	ans *= b;
-	return ans;
+	using R = std::common_type_t<T1,T2>;
+	return detail::array_binary<std::multiplies<>>(detail::array_fill<R,N>(b), a);
 }
 
 template<typename T1, typename T2, std::size_t N>
-std::array<std::common_type_t<T1,T2>,N>
+constexpr std::array<std::common_type_t<T1,T2>,N>
 operator /(const std::array<T1,N>& a, const T2& b) noexcept{
-	std::array<std::common_type_t<T1,T2>,N> ans(a);
-	ans /= b;
-	return ans;
+	return detail::array_binary<std::divides<>>(a, b);
 }
 
 template<typename T1, std::size_t N, typename T2>
-std::array<std::common_type_t<T1,T2>,N>
+constexpr std::array<std::common_type_t<T1,T2>,N>
 operator /(const T2& b, const std::array<T1,N>& a) noexcept{
-	std::array<std::common_type_t<T1,T2>,N> ans;
-	ans.fill(b);
-	ans /= a;
-	return ans;
+	using R = std::common_type_t<T1,T2>;
+	return detail::array_binary<std::divides<>>(detail::array_fill<R,N>(b), a);
 }
 
 
@@ -160,67 +321,85 @@ operator /(const T2& b, const std::array<T1,N>& a) noexcept{
 
 
 template<typename T1, typename T2, std::size_t N>
-void operator +=(std::array<T1,N>& a, const std::array<T2,N>& b) noexcept{
+constexpr void operator +=(std::array<T1,N>& a, const std::array<T2,N>& b) noexcept{
 	STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
-	for(std::size_t i = 0; i < N; ++i){
-		a[i] += b[i];
-	}
+	detail::array_assign(a, detail::array_binary<std::plus<>>(a, b), std::make_index_sequence<N>());
 }
 
 template<typename T1, typename T2, std::size_t N>
-void operator -=(std::array<T1,N>& a, const std::array<T2,N>& b) noexcept{
+constexpr void operator -=(std::array<T1,N>& a, const std::array<T2,N>& b) noexcept{
 	STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
-	for(std::size_t i = 0; i < N; ++i){
-		a[i] -= b[i];
-	}
+	detail::array_assign(a, detail::array_binary<std::minus<>>(a, b), std::make_index_sequence<N>());
 }
 
 template<typename T1, typename T2, std::size_t N>
-void operator *=(std::array<T1,N>& a, const std::array<T2,N>& b) noexcept{
+constexpr void operator *=(std::array<T1,N>& a, const std::array<T2,N>& b) noexcept{
 	STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
-	for(std::size_t i = 0; i < N; ++i){
-		a[i] *= b[i];
-	}
+	detail::array_assign(a, detail::array_binary<std::multiplies<>>(a, b), std::make_index_sequence<N>());
 }
 
 template<typename T1, typename T2, std::size_t N>
-void operator /=(std::array<T1,N>& a, const std::array<T2,N>& b) noexcept{
+constexpr void operator /=(std::array<T1,N>& a, const std::array<T2,N>& b) noexcept{
 	STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
-	for(std::size_t i = 0; i < N; ++i){
-		a[i] /= b[i];
-	}
+	detail::array_assign(a, detail::array_binary<std::divides<>>(a, b), std::make_index_sequence<N>());
 }
 
 template<typename T1, typename T2, std::size_t N>
-std::array<std::common_type_t<T1,T2>,N>
+constexpr std::array<std::common_type_t<T1,T2>,N>
 operator +(const std::array<T1,N>& a, const std::array<T2,N>& b) noexcept{
-	std::array<std::common_type_t<T1,T2>,N> ans(a);
-	ans += b;
-	return ans;
+	return detail::array_binary<std::plus<>>(a, b);
 }
 
 template<typename T1, typename T2, std::size_t N>
-std::array<std::common_type_t<T1,T2>,N>
+constexpr std::array<std::common_type_t<T1,T2>,N>
 operator -(const std::array<T1,N>& a, const std::array<T2,N>& b) noexcept{
-	std::array<std::common_type_t<T1,T2>,N> ans(a);
-	ans -= b;
-	return ans;
+	return detail::array_binary<std::minus<>>(a, b);
 }
 
 template<typename T1, typename T2, std::size_t N>
-std::array<std::common_type_t<T1,T2>,N>
+constexpr std::array<std::common_type_t<T1,T2>,N>
 operator *(const std::array<T1,N>& a, const std::array<T2,N>& b) noexcept{
-	std::array<std::common_type_t<T1,T2>,N> ans(a);
-	ans *= b;
-	return ans;
+	return detail::array_binary<std::multiplies<>>(a, b);
 }
 
 template<typename T1, typename T2, std::size_t N>
-std::array<std::common_type_t<T1,T2>,N>
+constexpr std::array<std::common_type_t<T1,T2>,N>
 operator /(const std::array<T1,N>& a, const std::array<T2,N>& b) noexcept{
-	std::array<std::common_type_t<T1,T2>,N> ans(a);
-	ans /= b;
-	return ans;
+	return detail::array_binary<std::divides<>>(a, b);
+}
+
+/// Element wise minimum of two arrays
+/**
+ * Both arrays share one value type so the overload is preferred
+ * over std::min found by argument dependent lookup.
+ */
+template<typename T, std::size_t N>
+constexpr std::array<T,N>
+min(const std::array<T,N>& a, const std::array<T,N>& b) noexcept{
+	return detail::array_binary<detail::array_min_op>(a, b);
+}
+
+/// Element wise maximum of two arrays
+template<typename T, std::size_t N>
+constexpr std::array<T,N>
+max(const std::array<T,N>& a, const std::array<T,N>& b) noexcept{
+	return detail::array_binary<detail::array_max_op>(a, b);
+}
+
+/// Smallest value within an array
+template<typename T, std::size_t N>
+constexpr T
+min(const std::array<T,N>& a) noexcept{
+	STATIC_ASSERT(N > 0, "Array must not be empty");
+	return detail::array_fold<detail::array_min_op>(a, std::make_index_sequence<N - 1>());
+}
+
+/// Largest value within an array
+template<typename T, std::size_t N>
+constexpr T
+max(const std::array<T,N>& a) noexcept{
+	STATIC_ASSERT(N > 0, "Array must not be empty");
+	return detail::array_fold<detail::array_max_op>(a, std::make_index_sequence<N - 1>());
 }
 
 
@@ -230,54 +409,39 @@ operator /(const std::array<T1,N>& a, const std::array<T2,N>& b) noexcept{
 
 
 template<typename T1, typename T2, std::size_t N>
-std::common_type_t<T1,T2>
+constexpr std::common_type_t<T1,T2>
 dot_product(const std::array<T1,N>& a, const std::array<T2,N>& b) noexcept{
-	std::common_type_t<T1,T2> ans(0);
-	for(std::size_t i = 0; i < N; ++i){
-		ans += (a[i] * b[i]);
-	}
-	return ans;
+	return detail::array_dot<std::common_type_t<T1,T2>>(a, b, std::make_index_sequence<N>());
 }
 
 template<typename T1, typename T2, std::size_t N>
-std::array<std::common_type_t<T1,T2>,N>
+constexpr std::array<std::common_type_t<T1,T2>,N>
 cross_product(const std::array<T1,N>& a, const std::array<T2,N>& b) noexcept{
 	STATIC_ASSERT(3 == N, "Must be Size 3");
-	std::array<std::common_type_t<T1,T2>,N> ans;
-	ans[0] = a[1]*b[2] - a[2]*b[1];
-	ans[1] = a[2]*b[0] - a[0]*b[2];
-	ans[2] = a[0]*b[1] - a[1]*b[0];
-	return ans;
+	using R = std::common_type_t<T1,T2>;
+	return {{
+		static_cast<R>(a[1]*b[2] - a[2]*b[1]),
+		static_cast<R>(a[2]*b[0] - a[0]*b[2]),
+		static_cast<R>(a[0]*b[1] - a[1]*b[0])
+	}};
 }
 
 template<typename T, std::size_t N>
-T
+constexpr T
 norm1(const std::array<T,N>& a) noexcept{
-	using std::abs;
-	T ans(0);
-	for(std::size_t i = 0; i < N; ++i){
-		ans += abs(a[i]);
-	}
-	return ans;
+	return detail::array_asum(a, std::make_index_sequence<N>());
 }
 
 template<typename T, std::size_t N>
-T
+constexpr T
 norm2(const std::array<T,N>& a) noexcept{
-	using std::sqrt;
-	return sqrt(dot_product(a,a));
+	return detail::array_sqrt(dot_product(a,a));
 }
 
 template<typename T, std::size_t N>
-T
+constexpr T
 norm_inf(const std::array<T,N>& a) noexcept{
-	using std::abs;
-	using std::max;
-	T ans(0);
-	for(std::size_t i = 0; i < N; ++i){
-		ans = max(ans, abs(a[i]));
-	}
-	return ans;
+	return detail::array_amax(a, std::make_index_sequence<N>());
 }
 
 
@@ -6,27 +6,52 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace xstd {
 
+/// Tag selecting the generator constructor of const_array
+struct const_array_generate_t {
+    explicit const_array_generate_t() = default;
+};
+
+inline constexpr const_array_generate_t const_array_generate{};
+
 /// Constant array that models std::array
 /**
- * A std::array like class with all member function 
+ * A std::array like class with all member function
  * as constexpr. The data is immutable once set.
- * 
+ *
+ * Tables are built at compile time from a generator called
+ * with every index. Declaring the result as a static constexpr
+ * variable places it within read-only storage aligned to a
+ * cache line so a lookup never straddles two lines needlessly.
+ *
  * Usage:
  * \code
  * template <std::size_t... Ints>
  * struct fixed_array {
- * 
- *     using cast_type = const_array<std::size_t, sizeof...(Ints)>
+ *
+ *     using cast_type = const_array<std::size_t, sizeof...(Ints)>;
  *     static constexpr cast_type array_ = cast_type({Ints...});
  * };
+ *
+ * static constexpr auto squares = make_const_array<256>([](std::size_t i) {
+ *     return static_cast<std::uint32_t>(i * i);
+ * });
  * \endcode
- * 
+ *
+ * \tparam T Type held within array
+ * \tparam N Number of values
+ * \tparam Alignment Alignment in bytes of the values (default is a cache line)
  */
-template <class T, std::size_t N>
+template <class T, std::size_t N, std::size_t Alignment = 64>
 class const_array {
    public:
     using size_type = std::size_t;
@@ -41,8 +66,23 @@ class const_array {
     using reverse_iterator = std::reverse_iterator<const_iterator>;
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
-    constexpr const_reference at()(std::size_t idx) const {
-        assert (idx < N); // C++14 allows
+    static constexpr std::size_t alignment = std::max(Alignment, alignof(T));
+
+    /// Construct from a list of N values
+    constexpr const_array(const T (&values)[N > 0 ? N : 1])
+        : const_array(values, std::make_index_sequence<N>()) {
+    }
+
+    /// Construct with the values gen(0), gen(1), ..., gen(N-1)
+    template <class Generator>
+    constexpr const_array(const_array_generate_t, Generator&& gen)
+        : const_array(gen, std::make_index_sequence<N>(), 0) {
+    }
+
+    constexpr const_reference at(std::size_t idx) const {
+        if (idx >= N) {
+            throw std::out_of_range("const_array::at");
+        }
         return data_[idx];
     }
 
@@ -107,37 +147,71 @@ class const_array {
     }
 
    private:
-    const T data_[N > 0 ? N : 1];
+    alignas(alignment) const T data_[N > 0 ? N : 1];
+
+    template <std::size_t... I>
+    constexpr const_array(const T (&values)[N > 0 ? N : 1], std::index_sequence<I...>)
+        : data_{values[I]...} {
+    }
+
+    template <class Generator, std::size_t... I>
+    constexpr const_array(Generator& gen, std::index_sequence<I...>, int)
+        : data_{static_cast<T>(std::invoke(gen, I))...} {
+    }
 };
 
-template <class T, std::size_t N>
-inline bool operator==(const const_array<T, N>& lhs, const const_array<T, N>& rhs) {
+/// Build a const_array<T,N> holding gen(0), gen(1), ..., gen(N-1)
+/**
+ * \code
+ * static constexpr auto crc_table = make_const_array<std::uint32_t, 256>([](std::size_t i) {
+ *     auto c = static_cast<std::uint32_t>(i);
+ *     for (int k = 0; k < 8; ++k) {
+ *         c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+ *     }
+ *     return c;
+ * });
+ * \endcode
+ */
+template <class T, std::size_t N, std::size_t Alignment = 64, class Generator>
+constexpr const_array<T, N, Alignment> make_const_array(Generator&& gen) {
+    return const_array<T, N, Alignment>(const_array_generate, std::forward<Generator>(gen));
+}
+
+/// Build a const_array of the type returned by gen
+template <std::size_t N, class Generator>
+constexpr auto make_const_array(Generator&& gen) {
+    using value_type = std::remove_cvref_t<std::invoke_result_t<Generator&, std::size_t>>;
+    return make_const_array<value_type, N>(std::forward<Generator>(gen));
+}
+
+template <class T, std::size_t N, std::size_t A>
+constexpr bool operator==(const const_array<T, N, A>& lhs, const const_array<T, N, A>& rhs) {
     return std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
 }
 
-template <class T, std::size_t N>
-inline bool operator!=(const const_array<T, N>& lhs, const const_array<T, N>& rhs) {
+template <class T, std::size_t N, std::size_t A>
+constexpr bool operator!=(const const_array<T, N, A>& lhs, const const_array<T, N, A>& rhs) {
     return !(lhs == rhs);
 }
 
-template <class T, std::size_t N>
-inline bool operator<(const const_array<T, N>& lhs, const const_array<T, N>& rhs) {
+template <class T, std::size_t N, std::size_t A>
+constexpr bool operator<(const const_array<T, N, A>& lhs, const const_array<T, N, A>& rhs) {
     return std::lexicographical_compare(lhs.begin(), lhs.end(),
                                         rhs.begin(), rhs.end());
 }
 
-template <class T, std::size_t N>
-inline bool operator<=(const const_array<T, N>& lhs, const const_array<T, N>& rhs) {
+template <class T, std::size_t N, std::size_t A>
+constexpr bool operator<=(const const_array<T, N, A>& lhs, const const_array<T, N, A>& rhs) {
     return !(lhs > rhs);
 }
 
-template <class T, std::size_t N>
-inline bool operator>(const const_array<T, N>& lhs, const const_array<T, N>& rhs) {
+template <class T, std::size_t N, std::size_t A>
+constexpr bool operator>(const const_array<T, N, A>& lhs, const const_array<T, N, A>& rhs) {
     return rhs < lhs;
 }
 
-template <class T, std::size_t N>
-inline bool operator>=(const const_array<T, N>& lhs, const const_array<T, N>& rhs) {
+template <class T, std::size_t N, std::size_t A>
+constexpr bool operator>=(const const_array<T, N, A>& lhs, const const_array<T, N, A>& rhs) {
     return !(lhs < rhs);
 }
 
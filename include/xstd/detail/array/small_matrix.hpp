@@ -0,0 +1,752 @@
+/**
+ * \file       small_matrix.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_ARRAY_SMALL_MATRIX_HPP_
+#define INCLUDE_XSTD_DETAIL_ARRAY_SMALL_MATRIX_HPP_
+
+
+#include "xstd/assert.hpp"
+#include "xstd/detail/array/array_math.hpp"
+#include "xstd/detail/array/soa_array.hpp"
+#include "xstd/detail/config/inline.hpp"
+#include "xstd/detail/config/restrict.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * small_matrix.hpp
+ *
+ * \brief
+ * Fixed size matrices layered on std::array
+ *
+ * \details
+ * A small_matrix<T,R,C> is an aggregate of R rows each being a
+ * std::array<T,C> so the rows work directly with array_math.hpp.
+ * All operations are constexpr and unrolled over index sequences.
+ * The product accumulates whole rows of the result as scaled rows
+ * of the right operand so each output row stays within registers.
+ * Determinant and inverse use closed form cofactor expressions up
+ * to 4x4 and Gauss-Jordan elimination with partial pivoting above.
+ *
+ * A small_matrix_batch stores many matrices with every entry in its
+ * own lane (see soa_array.hpp). The batched kernels evaluate the
+ * same straight line expressions for consecutive matrices so the
+ * compiler places neighbouring matrices within SIMD lanes.
+ */
+
+namespace xstd {
+
+/// Fixed size row major matrix
+/**
+ * \code
+ * constexpr xstd::small_matrix<double,2> J = {1, 2,
+ *                                            3, 4};
+ * constexpr auto det = xstd::determinant(J); // -2
+ * auto Jinv = xstd::inverse(J);
+ * auto x    = Jinv * std::array<double,2>{1, 1};
+ * \endcode
+ *
+ * \tparam T Type of each entry
+ * \tparam R Number of rows
+ * \tparam C Number of columns
+ */
+template<typename T, std::size_t R, std::size_t C = R>
+struct small_matrix {
+
+	// ====================================================
+	// Types
+	// ====================================================
+
+	using value_type = T;
+	using size_type  = std::size_t;
+	using row_type   = std::array<T,C>;
+
+	// ====================================================
+	// Data
+	// ====================================================
+
+	std::array<row_type,R> elems;
+
+	// ====================================================
+	// Construction
+	// ====================================================
+
+	/// Matrix with every entry set to value
+	static constexpr small_matrix filled(const T& value) noexcept {
+		small_matrix ans{};
+		for(auto& r : ans.elems){
+			r.fill(value);
+		}
+		return ans;
+	}
+
+	/// Identity matrix (ones on the main diagonal)
+	static constexpr small_matrix identity() noexcept {
+		small_matrix ans{};
+		for(size_type i = 0; (i < R) && (i < C); ++i){
+			ans.elems[i][i] = T(1);
+		}
+		return ans;
+	}
+
+	// ====================================================
+	// Access
+	// ====================================================
+
+	static constexpr size_type rows() noexcept {
+		return R;
+	}
+
+	static constexpr size_type cols() noexcept {
+		return C;
+	}
+
+	constexpr T& operator()(const size_type i, const size_type j) noexcept {
+		return elems[i][j];
+	}
+
+	constexpr const T& operator()(const size_type i, const size_type j) const noexcept {
+		return elems[i][j];
+	}
+
+	constexpr row_type& row(const size_type i) noexcept {
+		return elems[i];
+	}
+
+	constexpr const row_type& row(const size_type i) const noexcept {
+		return elems[i];
+	}
+
+	constexpr std::array<T,R> column(const size_type j) const noexcept {
+		std::array<T,R> ans{};
+		for(size_type i = 0; i < R; ++i){
+			ans[i] = elems[i][j];
+		}
+		return ans;
+	}
+
+	friend constexpr bool operator==(const small_matrix& a, const small_matrix& b) noexcept {
+		return a.elems == b.elems;
+	}
+};
+
+
+/// @cond SKIP_DETAIL
+namespace detail {
+
+template<typename T, std::size_t R, std::size_t C, typename Op, std::size_t... I>
+constexpr small_matrix<T,R,C> matrix_rows(Op op, std::index_sequence<I...>) noexcept {
+	return {{{ op(I)... }}};
+}
+
+/// Row i of a*b as the sum of a(i,k) * b.row(k)
+template<typename T, std::size_t R, std::size_t K, std::size_t C, std::size_t... Ks>
+constexpr std::array<T,C> matrix_product_row(const small_matrix<T,R,K>& a, const small_matrix<T,K,C>& b, const std::size_t i, std::index_sequence<Ks...>) noexcept {
+	std::array<T,C> acc{};
+	((acc += a(i,Ks) * b.row(Ks)), ...);
+	return acc;
+}
+
+template<typename T, std::size_t R, std::size_t C, std::size_t... Is>
+constexpr std::array<T,R> matrix_vector(const small_matrix<T,R,C>& a, const std::array<T,C>& x, std::index_sequence<Is...>) noexcept {
+	return {{ dot_product(a.row(Is), x)... }};
+}
+
+/// Entries of batched kernels are register width arrays of values
+template<typename T>
+struct is_matrix_pack : std::false_type {};
+
+template<typename T, std::size_t W>
+struct is_matrix_pack<std::array<T,W>> : std::true_type {};
+
+/// Entry holding value (broadcast to every lane of a pack)
+template<typename T, typename V>
+constexpr T matrix_entry(const V& value) noexcept {
+	if constexpr ( is_matrix_pack<T>::value ) {
+		return array_fill<typename T::value_type, std::tuple_size<T>::value>(value);
+	}
+	else {
+		return static_cast<T>(value);
+	}
+}
+
+/// True when an entry (every lane of a pack) is non-zero
+template<typename T>
+constexpr bool matrix_nonzero(const T& value) noexcept {
+	if constexpr ( is_matrix_pack<T>::value ) {
+		for(const auto& v : value){
+			if( v == 0 ){
+				return false;
+			}
+		}
+		return true;
+	}
+	else {
+		return value != T(0);
+	}
+}
+
+/// Multiply every entry by s without broadcasting packs over rows
+template<typename T, std::size_t R, std::size_t C>
+constexpr void matrix_scale_entries(small_matrix<T,R,C>& m, const T& s) noexcept {
+	for(std::size_t i = 0; i < R; ++i){
+		for(std::size_t j = 0; j < C; ++j){
+			m(i,j) = m(i,j) * s;
+		}
+	}
+}
+
+/// Closed form determinant (N <= 4)
+template<typename T, std::size_t N>
+constexpr T closed_form_determinant(const small_matrix<T,N,N>& m) noexcept {
+	if constexpr ( N == 1 ) {
+		return m(0,0);
+	}
+	else if constexpr ( N == 2 ) {
+		return m(0,0)*m(1,1) - m(0,1)*m(1,0);
+	}
+	else if constexpr ( N == 3 ) {
+		return m(0,0)*(m(1,1)*m(2,2) - m(1,2)*m(2,1))
+		     - m(0,1)*(m(1,0)*m(2,2) - m(1,2)*m(2,0))
+		     + m(0,2)*(m(1,0)*m(2,1) - m(1,1)*m(2,0));
+	}
+	else {
+		const T s0 = m(0,0)*m(1,1) - m(0,1)*m(1,0);
+		const T s1 = m(0,0)*m(1,2) - m(0,2)*m(1,0);
+		const T s2 = m(0,0)*m(1,3) - m(0,3)*m(1,0);
+		const T s3 = m(0,1)*m(1,2) - m(0,2)*m(1,1);
+		const T s4 = m(0,1)*m(1,3) - m(0,3)*m(1,1);
+		const T s5 = m(0,2)*m(1,3) - m(0,3)*m(1,2);
+		const T c5 = m(2,2)*m(3,3) - m(2,3)*m(3,2);
+		const T c4 = m(2,1)*m(3,3) - m(2,3)*m(3,1);
+		const T c3 = m(2,1)*m(3,2) - m(2,2)*m(3,1);
+		const T c2 = m(2,0)*m(3,3) - m(2,3)*m(3,0);
+		const T c1 = m(2,0)*m(3,2) - m(2,2)*m(3,0);
+		const T c0 = m(2,0)*m(3,1) - m(2,1)*m(3,0);
+		return s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0;
+	}
+}
+
+/// Closed form inverse through the adjugate (N <= 4)
+template<typename T, std::size_t N>
+constexpr small_matrix<T,N,N> closed_form_inverse(const small_matrix<T,N,N>& m) noexcept {
+	small_matrix<T,N,N> r{};
+	const T one = matrix_entry<T>(1);
+	if constexpr ( N == 1 ) {
+		ASSERT(matrix_nonzero(m(0,0)));
+		r(0,0) = one / m(0,0);
+	}
+	else if constexpr ( N == 2 ) {
+		const T det = m(0,0)*m(1,1) - m(0,1)*m(1,0);
+		ASSERT(matrix_nonzero(det));
+		const T inv = one / det;
+		r(0,0) =  m(1,1) * inv;
+		r(0,1) = -m(0,1) * inv;
+		r(1,0) = -m(1,0) * inv;
+		r(1,1) =  m(0,0) * inv;
+	}
+	else if constexpr ( N == 3 ) {
+		r(0,0) = m(1,1)*m(2,2) - m(1,2)*m(2,1);
+		r(0,1) = m(0,2)*m(2,1) - m(0,1)*m(2,2);
+		r(0,2) = m(0,1)*m(1,2) - m(0,2)*m(1,1);
+		r(1,0) = m(1,2)*m(2,0) - m(1,0)*m(2,2);
+		r(1,1) = m(0,0)*m(2,2) - m(0,2)*m(2,0);
+		r(1,2) = m(0,2)*m(1,0) - m(0,0)*m(1,2);
+		r(2,0) = m(1,0)*m(2,1) - m(1,1)*m(2,0);
+		r(2,1) = m(0,1)*m(2,0) - m(0,0)*m(2,1);
+		r(2,2) = m(0,0)*m(1,1) - m(0,1)*m(1,0);
+		const T det = m(0,0)*r(0,0) + m(0,1)*r(1,0) + m(0,2)*r(2,0);
+		ASSERT(matrix_nonzero(det));
+		matrix_scale_entries(r, one / det);
+	}
+	else {
+		const T s0 = m(0,0)*m(1,1) - m(0,1)*m(1,0);
+		const T s1 = m(0,0)*m(1,2) - m(0,2)*m(1,0);
+		const T s2 = m(0,0)*m(1,3) - m(0,3)*m(1,0);
+		const T s3 = m(0,1)*m(1,2) - m(0,2)*m(1,1);
+		const T s4 = m(0,1)*m(1,3) - m(0,3)*m(1,1);
+		const T s5 = m(0,2)*m(1,3) - m(0,3)*m(1,2);
+		const T c5 = m(2,2)*m(3,3) - m(2,3)*m(3,2);
+		const T c4 = m(2,1)*m(3,3) - m(2,3)*m(3,1);
+		const T c3 = m(2,1)*m(3,2) - m(2,2)*m(3,1);
+		const T c2 = m(2,0)*m(3,3) - m(2,3)*m(3,0);
+		const T c1 = m(2,0)*m(3,2) - m(2,2)*m(3,0);
+		const T c0 = m(2,0)*m(3,1) - m(2,1)*m(3,0);
+		const T det = s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0;
+		ASSERT(matrix_nonzero(det));
+		r(0,0) =  m(1,1)*c5 - m(1,2)*c4 + m(1,3)*c3;
+		r(0,1) = -m(0,1)*c5 + m(0,2)*c4 - m(0,3)*c3;
+		r(0,2) =  m(3,1)*s5 - m(3,2)*s4 + m(3,3)*s3;
+		r(0,3) = -m(2,1)*s5 + m(2,2)*s4 - m(2,3)*s3;
+		r(1,0) = -m(1,0)*c5 + m(1,2)*c2 - m(1,3)*c1;
+		r(1,1) =  m(0,0)*c5 - m(0,2)*c2 + m(0,3)*c1;
+		r(1,2) = -m(3,0)*s5 + m(3,2)*s2 - m(3,3)*s1;
+		r(1,3) =  m(2,0)*s5 - m(2,2)*s2 + m(2,3)*s1;
+		r(2,0) =  m(1,0)*c4 - m(1,1)*c2 + m(1,3)*c0;
+		r(2,1) = -m(0,0)*c4 + m(0,1)*c2 - m(0,3)*c0;
+		r(2,2) =  m(3,0)*s4 - m(3,1)*s2 + m(3,3)*s0;
+		r(2,3) = -m(2,0)*s4 + m(2,1)*s2 - m(2,3)*s0;
+		r(3,0) = -m(1,0)*c3 + m(1,1)*c1 - m(1,2)*c0;
+		r(3,1) =  m(0,0)*c3 - m(0,1)*c1 + m(0,2)*c0;
+		r(3,2) = -m(3,0)*s3 + m(3,1)*s1 - m(3,2)*s0;
+		r(3,3) =  m(2,0)*s3 - m(2,1)*s1 + m(2,2)*s0;
+		matrix_scale_entries(r, one / det);
+	}
+	return r;
+}
+
+/// Row of the largest magnitude entry in column k at or below row k
+template<typename T, std::size_t N>
+constexpr std::size_t pivot_row(const small_matrix<T,N,N>& m, const std::size_t k) noexcept {
+	std::size_t p = k;
+	for(std::size_t i = k + 1; i < N; ++i){
+		if( array_abs(m(i,k)) > array_abs(m(p,k)) ){
+			p = i;
+		}
+	}
+	return p;
+}
+
+/// Determinant by LU factorization with partial pivoting
+template<typename T, std::size_t N>
+constexpr T pivoted_determinant(small_matrix<T,N,N> m) noexcept {
+	T det(1);
+	for(std::size_t k = 0; k < N; ++k){
+		const auto p = pivot_row(m, k);
+		if( m(p,k) == T(0) ){
+			return T(0);
+		}
+		if( p != k ){
+			std::swap(m.row(p), m.row(k));
+			det = -det;
+		}
+		det *= m(k,k);
+		for(std::size_t i = k + 1; i < N; ++i){
+			const T f = m(i,k) / m(k,k);
+			m.row(i) -= f * m.row(k);
+		}
+	}
+	return det;
+}
+
+/// Inverse by Gauss-Jordan elimination with partial pivoting
+template<typename T, std::size_t N>
+constexpr small_matrix<T,N,N> pivoted_inverse(small_matrix<T,N,N> m) noexcept {
+	auto r = small_matrix<T,N,N>::identity();
+	for(std::size_t k = 0; k < N; ++k){
+		const auto p = pivot_row(m, k);
+		ASSERT(m(p,k) != T(0));
+		if( p != k ){
+			std::swap(m.row(p), m.row(k));
+			std::swap(r.row(p), r.row(k));
+		}
+		const T inv = T(1) / m(k,k);
+		m.row(k) *= inv;
+		r.row(k) *= inv;
+		for(std::size_t i = 0; i < N; ++i){
+			if( i != k ){
+				const T f = m(i,k);
+				m.row(i) -= f * m.row(k);
+				r.row(i) -= f * r.row(k);
+			}
+		}
+	}
+	return r;
+}
+
+} /* namespace detail */
+/// @endcond
+
+
+// ============================================================
+//                   Element Wise Operations
+// ============================================================
+
+template<typename T, std::size_t R, std::size_t C>
+constexpr small_matrix<T,R,C> operator -(const small_matrix<T,R,C>& a) noexcept {
+	return detail::matrix_rows<T,R,C>([&](const std::size_t i){ return -a.row(i); }, std::make_index_sequence<R>());
+}
+
+template<typename T, std::size_t R, std::size_t C>
+constexpr small_matrix<T,R,C> operator +(const small_matrix<T,R,C>& a, const small_matrix<T,R,C>& b) noexcept {
+	return detail::matrix_rows<T,R,C>([&](const std::size_t i){ return a.row(i) + b.row(i); }, std::make_index_sequence<R>());
+}
+
+template<typename T, std::size_t R, std::size_t C>
+constexpr small_matrix<T,R,C> operator -(const small_matrix<T,R,C>& a, const small_matrix<T,R,C>& b) noexcept {
+	return detail::matrix_rows<T,R,C>([&](const std::size_t i){ return a.row(i) - b.row(i); }, std::make_index_sequence<R>());
+}
+
+template<typename T, std::size_t R, std::size_t C>
+constexpr small_matrix<T,R,C> operator *(const small_matrix<T,R,C>& a, const T& s) noexcept {
+	return detail::matrix_rows<T,R,C>([&](const std::size_t i){ return a.row(i) * s; }, std::make_index_sequence<R>());
+}
+
+template<typename T, std::size_t R, std::size_t C>
+constexpr small_matrix<T,R,C> operator *(const T& s, const small_matrix<T,R,C>& a) noexcept {
+	return a * s;
+}
+
+template<typename T, std::size_t R, std::size_t C>
+constexpr small_matrix<T,R,C> operator /(const small_matrix<T,R,C>& a, const T& s) noexcept {
+	return detail::matrix_rows<T,R,C>([&](const std::size_t i){ return a.row(i) / s; }, std::make_index_sequence<R>());
+}
+
+template<typename T, std::size_t R, std::size_t C>
+constexpr small_matrix<T,R,C>& operator +=(small_matrix<T,R,C>& a, const small_matrix<T,R,C>& b) noexcept {
+	for(std::size_t i = 0; i < R; ++i){
+		a.row(i) += b.row(i);
+	}
+	return a;
+}
+
+template<typename T, std::size_t R, std::size_t C>
+constexpr small_matrix<T,R,C>& operator -=(small_matrix<T,R,C>& a, const small_matrix<T,R,C>& b) noexcept {
+	for(std::size_t i = 0; i < R; ++i){
+		a.row(i) -= b.row(i);
+	}
+	return a;
+}
+
+template<typename T, std::size_t R, std::size_t C>
+constexpr small_matrix<T,R,C>& operator *=(small_matrix<T,R,C>& a, const T& s) noexcept {
+	for(std::size_t i = 0; i < R; ++i){
+		a.row(i) *= s;
+	}
+	return a;
+}
+
+
+// ============================================================
+//                Linear Algebra Operations
+// ============================================================
+
+/// Matrix product
+template<typename T, std::size_t R, std::size_t K, std::size_t C>
+constexpr small_matrix<T,R,C> operator *(const small_matrix<T,R,K>& a, const small_matrix<T,K,C>& b) noexcept {
+	return detail::matrix_rows<T,R,C>([&](const std::size_t i){
+		return detail::matrix_product_row(a, b, i, std::make_index_sequence<K>());
+	}, std::make_index_sequence<R>());
+}
+
+/// Matrix vector product
+template<typename T, std::size_t R, std::size_t C>
+constexpr std::array<T,R> operator *(const small_matrix<T,R,C>& a, const std::array<T,C>& x) noexcept {
+	return detail::matrix_vector(a, x, std::make_index_sequence<R>());
+}
+
+template<typename T, std::size_t R, std::size_t C>
+constexpr small_matrix<T,C,R> transpose(const small_matrix<T,R,C>& a) noexcept {
+	return detail::matrix_rows<T,C,R>([&](const std::size_t j){ return a.column(j); }, std::make_index_sequence<C>());
+}
+
+template<typename T, std::size_t N>
+constexpr T trace(const small_matrix<T,N,N>& a) noexcept {
+	T ans(0);
+	for(std::size_t i = 0; i < N; ++i){
+		ans += a(i,i);
+	}
+	return ans;
+}
+
+/// Determinant (closed form up to 4x4)
+template<typename T, std::size_t N>
+constexpr T determinant(const small_matrix<T,N,N>& a) noexcept {
+	if constexpr ( N <= 4 ) {
+		return detail::closed_form_determinant(a);
+	}
+	else {
+		STATIC_ASSERT(std::is_floating_point<T>::value, "Determinant above 4x4 requires floating point values");
+		return detail::pivoted_determinant(a);
+	}
+}
+
+/// Inverse (closed form up to 4x4)
+/**
+ * The matrix must not be singular.
+ */
+template<typename T, std::size_t N>
+constexpr small_matrix<T,N,N> inverse(const small_matrix<T,N,N>& a) noexcept {
+	STATIC_ASSERT(std::is_floating_point<T>::value, "Inverse requires floating point values");
+	if constexpr ( N <= 4 ) {
+		return detail::closed_form_inverse(a);
+	}
+	else {
+		return detail::pivoted_inverse(a);
+	}
+}
+
+
+// ============================================================
+//                      Batched Matrices
+// ============================================================
+
+/// Many small matrices stored entry by entry in aligned lanes
+/**
+ * Entry (i,j) of every matrix is stored contiguously so the
+ * batched operations evaluate consecutive matrices within the
+ * lanes of SIMD registers.
+ *
+ * \code
+ * xstd::small_matrix_batch<double,3> J(n), Jinv(n);
+ * ...
+ * xstd::inverse(J, Jinv);
+ * auto detJ = xstd::determinant(J);
+ * \endcode
+ */
+template<typename T, std::size_t R, std::size_t C = R, std::size_t Alignment = 64>
+class small_matrix_batch final {
+public:
+	using value_type   = small_matrix<T,R,C>;
+	using size_type    = std::size_t;
+	using storage_type = soa_array<T,R*C,Alignment>;
+
+	small_matrix_batch() = default;
+
+	explicit small_matrix_batch(const size_type count) : entries_(count) {
+	}
+
+	size_type size() const noexcept {
+		return entries_.size();
+	}
+
+	[[nodiscard]] bool empty() const noexcept {
+		return entries_.empty();
+	}
+
+	void resize(const size_type count) {
+		entries_.resize(count);
+	}
+
+	void push_back(const value_type& m) {
+		entries_.push_back(flatten_(m));
+	}
+
+	/// Copy of matrix n
+	value_type get(const size_type n) const noexcept {
+		value_type m{};
+		for(size_type i = 0; i < R; ++i){
+			for(size_type j = 0; j < C; ++j){
+				m(i,j) = entries_.data(i*C + j)[n];
+			}
+		}
+		return m;
+	}
+
+	/// Store matrix n
+	void set(const size_type n, const value_type& m) noexcept {
+		for(size_type i = 0; i < R; ++i){
+			for(size_type j = 0; j < C; ++j){
+				entries_.data(i*C + j)[n] = m(i,j);
+			}
+		}
+	}
+
+	/// Lane holding entry (i,j) of every matrix
+	T* data(const size_type i, const size_type j) noexcept {
+		return entries_.data(i*C + j);
+	}
+
+	const T* data(const size_type i, const size_type j) const noexcept {
+		return entries_.data(i*C + j);
+	}
+
+private:
+	storage_type entries_;
+
+	static std::array<T,R*C> flatten_(const value_type& m) noexcept {
+		std::array<T,R*C> ans{};
+		for(size_type i = 0; i < R; ++i){
+			for(size_type j = 0; j < C; ++j){
+				ans[i*C + j] = m(i,j);
+			}
+		}
+		return ans;
+	}
+};
+/// @cond SKIP_DETAIL
+namespace detail {
+
+#if defined(XSTD_HAS_AVX)
+inline constexpr std::size_t batch_register_bytes = 32;
+#else
+inline constexpr std::size_t batch_register_bytes = 16;
+#endif
+
+/// Matrices evaluated together within one SIMD register
+template<typename T>
+inline constexpr std::size_t batch_width = (sizeof(T) < batch_register_bytes) ? (batch_register_bytes / sizeof(T)) : 1;
+
+template<typename T>
+using batch_pack = std::array<T,batch_width<T>>;
+
+/// Call kernel(n,E{}) with packs of matrices and then the remaining single matrices
+/**
+ * Entry type E is batch_pack<T> while full packs remain so the
+ * closed form expressions use the SIMD operations of array_math.hpp
+ * and then T for each remaining matrix.
+ */
+template<typename T, typename Kernel>
+void batch_for_each(const std::size_t count, Kernel&& kernel) {
+	constexpr auto W = batch_width<T>;
+	std::size_t n = 0;
+	for(; n + W <= count; n += W){
+		kernel(n, batch_pack<T>{});
+	}
+	for(; n < count; ++n){
+		kernel(n, T{});
+	}
+}
+
+/// Load entry type E starting at lane position n
+template<typename E, typename T>
+XSTD_FORCE_INLINE E batch_load(const T* XSTD_RESTRICT lane, const std::size_t n) noexcept {
+	if constexpr ( is_matrix_pack<E>::value ) {
+		E ans;
+		std::copy_n(lane + n, ans.size(), ans.begin());
+		return ans;
+	}
+	else {
+		return lane[n];
+	}
+}
+
+/// Store entry type E starting at lane position n
+template<typename E, typename T>
+XSTD_FORCE_INLINE void batch_store(T* XSTD_RESTRICT lane, const std::size_t n, const E& value) noexcept {
+	if constexpr ( is_matrix_pack<E>::value ) {
+		std::copy_n(value.begin(), value.size(), lane + n);
+	}
+	else {
+		lane[n] = value;
+	}
+}
+
+template<typename E, typename T, std::size_t R, std::size_t C, std::size_t A>
+XSTD_FORCE_INLINE small_matrix<E,R,C> batch_load(const small_matrix_batch<T,R,C,A>& batch, const std::size_t n) noexcept {
+	small_matrix<E,R,C> m;
+	for(std::size_t i = 0; i < R; ++i){
+		for(std::size_t j = 0; j < C; ++j){
+			m(i,j) = batch_load<E>(batch.data(i,j), n);
+		}
+	}
+	return m;
+}
+
+template<typename E, typename T, std::size_t R, std::size_t C, std::size_t A>
+XSTD_FORCE_INLINE void batch_store(small_matrix_batch<T,R,C,A>& batch, const std::size_t n, const small_matrix<E,R,C>& m) noexcept {
+	for(std::size_t i = 0; i < R; ++i){
+		for(std::size_t j = 0; j < C; ++j){
+			batch_store(batch.data(i,j), n, m(i,j));
+		}
+	}
+}
+
+/// Matrix product using only entry by entry operations
+template<typename E, std::size_t R, std::size_t K, std::size_t C>
+XSTD_FORCE_INLINE small_matrix<E,R,C> entry_product(const small_matrix<E,R,K>& a, const small_matrix<E,K,C>& b) noexcept {
+	small_matrix<E,R,C> c;
+	for(std::size_t i = 0; i < R; ++i){
+		for(std::size_t j = 0; j < C; ++j){
+			E sum = a(i,0) * b(0,j);
+			for(std::size_t k = 1; k < K; ++k){
+				sum = sum + a(i,k) * b(k,j);
+			}
+			c(i,j) = sum;
+		}
+	}
+	return c;
+}
+
+} /* namespace detail */
+/// @endcond
+
+/// Product of every pair of matrices (c[n] = a[n] * b[n])
+/**
+ * The result may be stored into either operand.
+ */
+template<typename T, std::size_t R, std::size_t K, std::size_t C, std::size_t A>
+void multiply(const small_matrix_batch<T,R,K,A>& a, const small_matrix_batch<T,K,C,A>& b, small_matrix_batch<T,R,C,A>& c) {
+	ASSERT(a.size() == b.size());
+	c.resize(a.size());
+	detail::batch_for_each<T>(a.size(), [&](const std::size_t n, auto entry){
+		using E = decltype(entry);
+		const auto an = detail::batch_load<E>(a, n);
+		const auto bn = detail::batch_load<E>(b, n);
+		detail::batch_store(c, n, detail::entry_product(an, bn));
+	});
+}
+
+/// Product of every matrix with its vector (y[n] = a[n] * x[n])
+template<typename T, std::size_t R, std::size_t C, std::size_t A>
+void multiply(const small_matrix_batch<T,R,C,A>& a, const soa_array<T,C,A>& x, soa_array<T,R,A>& y) {
+	ASSERT(a.size() == x.size());
+	y.resize(a.size());
+	detail::batch_for_each<T>(a.size(), [&](const std::size_t n, auto entry){
+		using E = decltype(entry);
+		const auto an = detail::batch_load<E>(a, n);
+		small_matrix<E,C,1> xn;
+		for(std::size_t j = 0; j < C; ++j){
+			xn(j,0) = detail::batch_load<E>(x.data(j), n);
+		}
+		const auto yn = detail::entry_product(an, xn);
+		for(std::size_t i = 0; i < R; ++i){
+			detail::batch_store(y.data(i), n, yn(i,0));
+		}
+	});
+}
+
+/// Determinant of every matrix
+template<typename T, std::size_t N, std::size_t A>
+std::vector<T> determinant(const small_matrix_batch<T,N,N,A>& a) {
+	std::vector<T> ans(a.size());
+	if constexpr ( N <= 4 ) {
+		detail::batch_for_each<T>(a.size(), [&](const std::size_t n, auto entry){
+			using E = decltype(entry);
+			detail::batch_store(ans.data(), n, detail::closed_form_determinant(detail::batch_load<E>(a, n)));
+		});
+	}
+	else {
+		for(std::size_t n = 0; n < a.size(); ++n){
+			ans[n] = determinant(a.get(n));
+		}
+	}
+	return ans;
+}
+
+/// Inverse of every matrix (b[n] = inverse(a[n]))
+/**
+ * Matrices up to 4x4 are inverted a SIMD register width at a time.
+ * Larger matrices require pivoting and are inverted one at a time.
+ * The result may be stored into the operand.
+ */
+template<typename T, std::size_t N, std::size_t A>
+void inverse(const small_matrix_batch<T,N,N,A>& a, small_matrix_batch<T,N,N,A>& b) {
+	STATIC_ASSERT(std::is_floating_point<T>::value, "Inverse requires floating point values");
+	b.resize(a.size());
+	if constexpr ( N <= 4 ) {
+		detail::batch_for_each<T>(a.size(), [&](const std::size_t n, auto entry){
+			using E = decltype(entry);
+			detail::batch_store(b, n, detail::closed_form_inverse(detail::batch_load<E>(a, n)));
+		});
+	}
+	else {
+		for(std::size_t n = 0; n < a.size(); ++n){
+			b.set(n, inverse(a.get(n)));
+		}
+	}
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_ARRAY_SMALL_MATRIX_HPP_ */
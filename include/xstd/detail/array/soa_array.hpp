@@ -0,0 +1,710 @@
+/**
+ * \file       soa_array.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_ARRAY_SOA_ARRAY_HPP_
+#define INCLUDE_XSTD_DETAIL_ARRAY_SOA_ARRAY_HPP_
+
+
+#include "xstd/assert.hpp"
+#include "xstd/detail/array/array_math.hpp"
+#include "xstd/detail/config/restrict.hpp"
+#include "xstd/detail/memory/aligned.hpp"
+#include "xstd/detail/memory/allocator/aligned_allocator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * soa_array.hpp
+ *
+ * \brief
+ * Structure of arrays container of small fixed size arrays
+ *
+ * \details
+ * Holds a sequence of std::array<T,N> values with each of the N
+ * components stored within its own contiguous and aligned lane.
+ * Element access returns a proxy reference which converts to and
+ * assigns from std::array<T,N> and works with the operators of
+ * array_math.hpp so per element code reads the same as for a
+ * std::vector<std::array<T,N>>.
+ *
+ * The bulk operations of the container (compound operators,
+ * dot_product, cross_product, norm2, ...) loop over the lanes so
+ * consecutive elements share a SIMD register instead of the N
+ * components of a single element.
+ */
+
+namespace xstd {
+
+template<typename Container>
+class soa_reference;
+
+template<typename Container>
+class soa_iterator;
+
+/// @cond SKIP_DETAIL
+namespace detail {
+
+template<typename T>
+struct is_soa_reference : std::false_type {};
+
+template<typename Container>
+struct is_soa_reference<soa_reference<Container>> : std::true_type {};
+
+/// Value of a proxy reference or the argument itself
+template<typename T>
+constexpr decltype(auto) soa_value(const T& value) {
+	if constexpr ( is_soa_reference<T>::value ) {
+		return value.value();
+	}
+	else {
+		return (value);
+	}
+}
+
+/// Operand of at least one proxy reference
+template<typename L, typename R>
+concept soa_operands = is_soa_reference<L>::value || is_soa_reference<R>::value;
+
+} /* namespace detail */
+/// @endcond
+
+
+/// Proxy reference to a single element within a soa_array
+/**
+ * Behaves like a reference to std::array<T,N>. Assignment writes
+ * the values into the lanes instead of rebinding the proxy.
+ */
+template<typename Container>
+class soa_reference final {
+	using container_type = std::remove_const_t<Container>;
+	static constexpr bool is_const = std::is_const<Container>::value;
+
+public:
+	using size_type   = std::size_t;
+	using value_type  = typename container_type::value_type;
+	using scalar_type = std::conditional_t<is_const, const typename container_type::scalar_type, typename container_type::scalar_type>;
+
+	soa_reference(Container* container, const size_type index) noexcept
+		: container_(container), index_(index) {
+	}
+
+	soa_reference(const soa_reference& other) = default;
+
+	/// Write values of another element
+	soa_reference& operator=(const soa_reference& other) requires (not is_const) {
+		this->assign_(other.value());
+		return *this;
+	}
+
+	/// Write values of another element
+	template<typename C>
+	const soa_reference& operator=(const soa_reference<C>& other) const requires (not is_const) {
+		this->assign_(other.value());
+		return *this;
+	}
+
+	/// Write values of an array
+	const soa_reference& operator=(const value_type& value) const requires (not is_const) {
+		this->assign_(value);
+		return *this;
+	}
+
+	/// Read element into an array
+	value_type value() const noexcept {
+		value_type ans;
+		for(size_type k = 0; k < ans.size(); ++k){
+			ans[k] = (*this)[k];
+		}
+		return ans;
+	}
+
+	operator value_type() const noexcept {
+		return this->value();
+	}
+
+	/// Component k of the element
+	scalar_type& operator[](const size_type k) const noexcept {
+		return container_->data(k)[index_];
+	}
+
+	static constexpr size_type size() noexcept {
+		return container_type::extent;
+	}
+
+	template<typename R>
+	const soa_reference& operator+=(const R& b) const requires (not is_const) {
+		auto v = this->value();
+		v += detail::soa_value(b);
+		this->assign_(v);
+		return *this;
+	}
+
+	template<typename R>
+	const soa_reference& operator-=(const R& b) const requires (not is_const) {
+		auto v = this->value();
+		v -= detail::soa_value(b);
+		this->assign_(v);
+		return *this;
+	}
+
+	template<typename R>
+	const soa_reference& operator*=(const R& b) const requires (not is_const) {
+		auto v = this->value();
+		v *= detail::soa_value(b);
+		this->assign_(v);
+		return *this;
+	}
+
+	template<typename R>
+	const soa_reference& operator/=(const R& b) const requires (not is_const) {
+		auto v = this->value();
+		v /= detail::soa_value(b);
+		this->assign_(v);
+		return *this;
+	}
+
+	friend void swap(const soa_reference& a, const soa_reference& b) requires (not is_const) {
+		const auto tmp = a.value();
+		a = b.value();
+		b = tmp;
+	}
+
+	template<typename C>
+	friend bool operator==(const soa_reference& a, const soa_reference<C>& b) noexcept {
+		return a.value() == b.value();
+	}
+
+	friend bool operator==(const soa_reference& a, const value_type& b) noexcept {
+		return a.value() == b;
+	}
+
+private:
+	Container* container_;
+	size_type  index_;
+
+	void assign_(const value_type& value) const {
+		for(size_type k = 0; k < value.size(); ++k){
+			container_->data(k)[index_] = value[k];
+		}
+	}
+};
+
+
+/// Random access iterator over the elements of a soa_array
+template<typename Container>
+class soa_iterator final {
+	using container_type = std::remove_const_t<Container>;
+
+public:
+	using iterator_category = std::random_access_iterator_tag;
+	using iterator_concept  = std::random_access_iterator_tag;
+	using value_type        = typename container_type::value_type;
+	using difference_type   = std::ptrdiff_t;
+	using reference         = soa_reference<Container>;
+	using pointer           = void;
+
+	soa_iterator() noexcept = default;
+
+	soa_iterator(Container* container, const std::size_t index) noexcept
+		: container_(container), index_(static_cast<difference_type>(index)) {
+	}
+
+	/// Conversion of a mutable iterator into a const iterator
+	template<typename C>
+	requires (std::is_const<Container>::value && std::is_same<C, container_type>::value)
+	soa_iterator(const soa_iterator<C>& other) noexcept
+		: container_(other.container_), index_(other.index_) {
+	}
+
+	reference operator*() const noexcept {
+		return reference(container_, static_cast<std::size_t>(index_));
+	}
+
+	reference operator[](const difference_type n) const noexcept {
+		return reference(container_, static_cast<std::size_t>(index_ + n));
+	}
+
+	soa_iterator& operator++() noexcept { ++index_; return *this; }
+	soa_iterator& operator--() noexcept { --index_; return *this; }
+	soa_iterator  operator++(int) noexcept { auto tmp = *this; ++index_; return tmp; }
+	soa_iterator  operator--(int) noexcept { auto tmp = *this; --index_; return tmp; }
+	soa_iterator& operator+=(const difference_type n) noexcept { index_ += n; return *this; }
+	soa_iterator& operator-=(const difference_type n) noexcept { index_ -= n; return *this; }
+
+	friend soa_iterator operator+(soa_iterator it, const difference_type n) noexcept { return it += n; }
+	friend soa_iterator operator+(const difference_type n, soa_iterator it) noexcept { return it += n; }
+	friend soa_iterator operator-(soa_iterator it, const difference_type n) noexcept { return it -= n; }
+
+	friend difference_type operator-(const soa_iterator& a, const soa_iterator& b) noexcept {
+		return a.index_ - b.index_;
+	}
+
+	friend bool operator==(const soa_iterator& a, const soa_iterator& b) noexcept {
+		return a.index_ == b.index_;
+	}
+
+	friend auto operator<=>(const soa_iterator& a, const soa_iterator& b) noexcept {
+		return a.index_ <=> b.index_;
+	}
+
+private:
+	template<typename C>
+	friend class soa_iterator;
+
+	Container*      container_ = nullptr;
+	difference_type index_     = 0;
+};
+
+
+/// Structure of arrays container of std::array<T,N> values
+/**
+ * Stores each component of the arrays within its own lane
+ * allocated with xstd::aligned_allocator.
+ *
+ * \code
+ * xstd::soa_array<double,3> x(1'000'000);
+ * xstd::soa_array<double,3> v(1'000'000);
+ * x[0] = std::array<double,3>{1, 2, 3};
+ * x.axpy(dt, v);                   // x = dt*v + x lane by lane
+ * auto len = xstd::norm2(x[0]);    // array_math on one element
+ * auto all = xstd::norm2(x);       // norm of every element
+ * \endcode
+ *
+ * \tparam T Type of each component
+ * \tparam N Number of components of each element
+ * \tparam Alignment Alignment in bytes of every lane
+ */
+template<typename T, std::size_t N, std::size_t Alignment = 64>
+class soa_array final {
+	STATIC_ASSERT(N > 0, "Must have at least one component");
+
+public:
+
+	// ====================================================
+	// Types
+	// ====================================================
+
+	using scalar_type     = T;
+	using value_type      = std::array<T,N>;
+	using size_type       = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using allocator_type  = aligned_allocator<T,Alignment>;
+	using lane_type       = std::vector<T,allocator_type>;
+	using reference       = soa_reference<soa_array>;
+	using const_reference = soa_reference<const soa_array>;
+	using iterator        = soa_iterator<soa_array>;
+	using const_iterator  = soa_iterator<const soa_array>;
+
+	static constexpr size_type extent    = N;
+	static constexpr size_type alignment = std::max(Alignment, alignof(T));
+
+	// ====================================================
+	// Constructors
+	// ====================================================
+
+	soa_array() = default;
+
+	explicit soa_array(const size_type count) {
+		this->resize(count);
+	}
+
+	soa_array(const size_type count, const value_type& value) {
+		this->resize(count, value);
+	}
+
+	soa_array(std::initializer_list<value_type> init) {
+		this->reserve(init.size());
+		for(const auto& value : init){
+			this->push_back(value);
+		}
+	}
+
+	// ====================================================
+	// Element Access
+	// ====================================================
+
+	reference operator[](const size_type i) noexcept {
+		return reference(this, i);
+	}
+
+	const_reference operator[](const size_type i) const noexcept {
+		return const_reference(this, i);
+	}
+
+	reference at(const size_type i) {
+		if( i >= this->size() ){
+			throw std::out_of_range("soa_array::at");
+		}
+		return (*this)[i];
+	}
+
+	const_reference at(const size_type i) const {
+		if( i >= this->size() ){
+			throw std::out_of_range("soa_array::at");
+		}
+		return (*this)[i];
+	}
+
+	/// Aligned data of component lane k
+	T* data(const size_type k) noexcept {
+		return assume_aligned<alignment>(lanes_[k].data());
+	}
+
+	const T* data(const size_type k) const noexcept {
+		return assume_aligned<alignment>(lanes_[k].data());
+	}
+
+	/// Contiguous values of component lane k
+	std::span<T> lane(const size_type k) noexcept {
+		return std::span<T>(lanes_[k].data(), lanes_[k].size());
+	}
+
+	std::span<const T> lane(const size_type k) const noexcept {
+		return std::span<const T>(lanes_[k].data(), lanes_[k].size());
+	}
+
+	// ====================================================
+	// Iterators
+	// ====================================================
+
+	iterator begin() noexcept { return iterator(this, 0); }
+	iterator end() noexcept { return iterator(this, this->size()); }
+	const_iterator begin() const noexcept { return const_iterator(this, 0); }
+	const_iterator end() const noexcept { return const_iterator(this, this->size()); }
+	const_iterator cbegin() const noexcept { return this->begin(); }
+	const_iterator cend() const noexcept { return this->end(); }
+
+	// ====================================================
+	// Capacity
+	// ====================================================
+
+	[[nodiscard]] bool empty() const noexcept {
+		return lanes_[0].empty();
+	}
+
+	size_type size() const noexcept {
+		return lanes_[0].size();
+	}
+
+	size_type capacity() const noexcept {
+		return lanes_[0].capacity();
+	}
+
+	void reserve(const size_type count) {
+		for(auto& lane : lanes_){
+			lane.reserve(count);
+		}
+	}
+
+	// ====================================================
+	// Modifiers
+	// ====================================================
+
+	void clear() noexcept {
+		for(auto& lane : lanes_){
+			lane.clear();
+		}
+	}
+
+	void resize(const size_type count) {
+		for(auto& lane : lanes_){
+			lane.resize(count);
+		}
+	}
+
+	void resize(const size_type count, const value_type& value) {
+		for(size_type k = 0; k < N; ++k){
+			lanes_[k].resize(count, value[k]);
+		}
+	}
+
+	void push_back(const value_type& value) {
+		for(size_type k = 0; k < N; ++k){
+			lanes_[k].push_back(value[k]);
+		}
+	}
+
+	void pop_back() {
+		ASSERT(not this->empty());
+		for(auto& lane : lanes_){
+			lane.pop_back();
+		}
+	}
+
+	void swap(soa_array& other) noexcept {
+		lanes_.swap(other.lanes_);
+	}
+
+	// ====================================================
+	// Bulk Operations
+	// ====================================================
+
+	soa_array& operator+=(const soa_array& b) noexcept {
+		return this->apply_(b, [](T& x, const T y){ x += y; });
+	}
+
+	soa_array& operator-=(const soa_array& b) noexcept {
+		return this->apply_(b, [](T& x, const T y){ x -= y; });
+	}
+
+	soa_array& operator*=(const soa_array& b) noexcept {
+		return this->apply_(b, [](T& x, const T y){ x *= y; });
+	}
+
+	soa_array& operator/=(const soa_array& b) noexcept {
+		return this->apply_(b, [](T& x, const T y){ x /= y; });
+	}
+
+	/// Add array to every element
+	soa_array& operator+=(const value_type& b) noexcept {
+		return this->apply_(b, [](T& x, const T y){ x += y; });
+	}
+
+	soa_array& operator-=(const value_type& b) noexcept {
+		return this->apply_(b, [](T& x, const T y){ x -= y; });
+	}
+
+	soa_array& operator*=(const value_type& b) noexcept {
+		return this->apply_(b, [](T& x, const T y){ x *= y; });
+	}
+
+	soa_array& operator/=(const value_type& b) noexcept {
+		return this->apply_(b, [](T& x, const T y){ x /= y; });
+	}
+
+	/// Scale every component of every element
+	soa_array& operator*=(const T& b) noexcept {
+		value_type v;
+		v.fill(b);
+		return (*this) *= v;
+	}
+
+	soa_array& operator/=(const T& b) noexcept {
+		value_type v;
+		v.fill(b);
+		return (*this) /= v;
+	}
+
+	/// Add scaled elements of x (this = a*x + this)
+	soa_array& axpy(const T& a, const soa_array& x) noexcept {
+		return this->apply_(x, [a](T& y, const T v){ y += a * v; });
+	}
+
+private:
+	std::array<lane_type,N> lanes_;
+
+	template<typename Op>
+	soa_array& apply_(const soa_array& b, Op op) noexcept {
+		ASSERT(this->size() == b.size());
+		const auto n = this->size();
+		if( this == &b ){
+			for(size_type k = 0; k < N; ++k){
+				T* x = this->data(k);
+				for(size_type i = 0; i < n; ++i){
+					op(x[i], x[i]);
+				}
+			}
+			return *this;
+		}
+		for(size_type k = 0; k < N; ++k){
+			T* XSTD_RESTRICT       x = this->data(k);
+			const T* XSTD_RESTRICT y = b.data(k);
+			for(size_type i = 0; i < n; ++i){
+				op(x[i], y[i]);
+			}
+		}
+		return *this;
+	}
+
+	template<typename Op>
+	soa_array& apply_(const value_type& b, Op op) noexcept {
+		const auto n = this->size();
+		for(size_type k = 0; k < N; ++k){
+			T* XSTD_RESTRICT x = this->data(k);
+			const T          y = b[k];
+			for(size_type i = 0; i < n; ++i){
+				op(x[i], y);
+			}
+		}
+		return *this;
+	}
+};
+
+template<typename T, std::size_t N, std::size_t A>
+bool operator==(const soa_array<T,N,A>& a, const soa_array<T,N,A>& b) noexcept {
+	if( a.size() != b.size() ){
+		return false;
+	}
+	for(std::size_t k = 0; k < N; ++k){
+		for(std::size_t i = 0; i < a.size(); ++i){
+			if( not (a.data(k)[i] == b.data(k)[i]) ){
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+
+// ============================================================
+//            Bulk Operations Across Elements
+// ============================================================
+
+/// Dot product of every pair of elements
+template<typename T, std::size_t N, std::size_t A>
+std::vector<T> dot_product(const soa_array<T,N,A>& a, const soa_array<T,N,A>& b){
+	ASSERT(a.size() == b.size());
+	const auto n = a.size();
+	std::vector<T> ans(n, T(0));
+	T* XSTD_RESTRICT r = ans.data();
+	for(std::size_t k = 0; k < N; ++k){
+		const T* XSTD_RESTRICT x = a.data(k);
+		const T* XSTD_RESTRICT y = b.data(k);
+		for(std::size_t i = 0; i < n; ++i){
+			r[i] += x[i] * y[i];
+		}
+	}
+	return ans;
+}
+
+/// Euclidean norm of every element
+template<typename T, std::size_t N, std::size_t A>
+std::vector<T> norm2(const soa_array<T,N,A>& a){
+	using std::sqrt;
+	auto ans = dot_product(a, a);
+	for(auto& v : ans){
+		v = sqrt(v);
+	}
+	return ans;
+}
+
+/// Cross product of every pair of elements
+template<typename T, std::size_t A>
+soa_array<T,3,A> cross_product(const soa_array<T,3,A>& a, const soa_array<T,3,A>& b){
+	ASSERT(a.size() == b.size());
+	const auto n = a.size();
+	soa_array<T,3,A> ans(n);
+	const T* XSTD_RESTRICT a0 = a.data(0);
+	const T* XSTD_RESTRICT a1 = a.data(1);
+	const T* XSTD_RESTRICT a2 = a.data(2);
+	const T* XSTD_RESTRICT b0 = b.data(0);
+	const T* XSTD_RESTRICT b1 = b.data(1);
+	const T* XSTD_RESTRICT b2 = b.data(2);
+	T* XSTD_RESTRICT r0 = ans.data(0);
+	T* XSTD_RESTRICT r1 = ans.data(1);
+	T* XSTD_RESTRICT r2 = ans.data(2);
+	for(std::size_t i = 0; i < n; ++i){
+		r0[i] = a1[i]*b2[i] - a2[i]*b1[i];
+		r1[i] = a2[i]*b0[i] - a0[i]*b2[i];
+		r2[i] = a0[i]*b1[i] - a1[i]*b0[i];
+	}
+	return ans;
+}
+
+
+// ============================================================
+//          array_math Operators on Proxy References
+// ============================================================
+
+template<typename Container>
+auto operator -(const soa_reference<Container>& a){
+	return -a.value();
+}
+
+template<typename Container>
+auto operator +(const soa_reference<Container>& a){
+	return a.value();
+}
+
+template<typename L, typename R>
+requires detail::soa_operands<L,R>
+auto operator +(const L& a, const R& b){
+	return detail::soa_value(a) + detail::soa_value(b);
+}
+
+template<typename L, typename R>
+requires detail::soa_operands<L,R>
+auto operator -(const L& a, const R& b){
+	return detail::soa_value(a) - detail::soa_value(b);
+}
+
+template<typename L, typename R>
+requires detail::soa_operands<L,R>
+auto operator *(const L& a, const R& b){
+	return detail::soa_value(a) * detail::soa_value(b);
+}
+
+template<typename L, typename R>
+requires detail::soa_operands<L,R>
+auto operator /(const L& a, const R& b){
+	return detail::soa_value(a) / detail::soa_value(b);
+}
+
+template<typename L, typename R>
+requires detail::soa_operands<L,R>
+auto dot_product(const L& a, const R& b){
+	return dot_product(detail::soa_value(a), detail::soa_value(b));
+}
+
+template<typename L, typename R>
+requires detail::soa_operands<L,R>
+auto cross_product(const L& a, const R& b){
+	return cross_product(detail::soa_value(a), detail::soa_value(b));
+}
+
+template<typename L, typename R>
+requires detail::soa_operands<L,R>
+auto min(const L& a, const R& b){
+	return min(detail::soa_value(a), detail::soa_value(b));
+}
+
+template<typename L, typename R>
+requires detail::soa_operands<L,R>
+auto max(const L& a, const R& b){
+	return max(detail::soa_value(a), detail::soa_value(b));
+}
+
+template<typename Container>
+auto min(const soa_reference<Container>& a){
+	return min(a.value());
+}
+
+template<typename Container>
+auto max(const soa_reference<Container>& a){
+	return max(a.value());
+}
+
+template<typename Container>
+auto norm1(const soa_reference<Container>& a){
+	return norm1(a.value());
+}
+
+template<typename Container>
+auto norm2(const soa_reference<Container>& a){
+	return norm2(a.value());
+}
+
+template<typename Container>
+auto norm_inf(const soa_reference<Container>& a){
+	return norm_inf(a.value());
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_ARRAY_SOA_ARRAY_HPP_ */
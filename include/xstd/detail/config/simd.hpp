@@ -0,0 +1,84 @@
+/*
+ * simd.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+#ifndef INCLUDE_XSTD_CONFIG_SIMD_HPP_
+#define INCLUDE_XSTD_CONFIG_SIMD_HPP_
+
+#include "xstd/detail/config/compiler.hpp"
+
+/**
+ * \file
+ * simd.hpp
+ *
+ * \brief
+ * Detect the SIMD instruction sets enabled at compile time
+ *
+ * \details
+ * Defines a flag for each instruction set the compiler has been
+ * told it may target (i.e. -msse2, -mavx2, -march=native, etc.).
+ * Code guarded by these flags may use the intrinsics directly.
+ */
+
+// =====================================================
+// x86 Architecture
+// =====================================================
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define XSTD_ARCH_X86 1
+#endif
+
+// =====================================================
+// x86 Instruction Sets
+// =====================================================
+#if defined(XSTD_ARCH_X86)
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define XSTD_HAS_SSE2 1
+#endif
+
+#if defined(__AVX__)
+#define XSTD_HAS_AVX 1
+#endif
+
+#if defined(__AVX2__)
+#define XSTD_HAS_AVX2 1
+#endif
+
+#if defined(__AVX512F__)
+#define XSTD_HAS_AVX512F 1
+#endif
+
+#if defined(__FMA__)
+#define XSTD_HAS_FMA 1
+#endif
+
+#if defined(__BMI2__)
+#define XSTD_HAS_BMI2 1
+#endif
+
+#endif // defined(XSTD_ARCH_X86)
+
+
+// =====================================================
+// Per Function Target Instruction Sets
+// =====================================================
+//
+// Functions marked XSTD_TARGET("avx2,fma") may use the intrinsics
+// of the listed instruction sets without compiling the whole
+// program for them. They must only be called once the CPU was
+// checked to support them (see XSTD_CPU_SUPPORTS).
+//
+#if defined(XSTD_ARCH_X86) && defined(__GNUC__)
+#define XSTD_HAS_TARGET_DISPATCH 1
+#define XSTD_TARGET(isa) __attribute__((target(isa)))
+#define XSTD_CPU_SUPPORTS(isa) __builtin_cpu_supports(isa)
+#else
+#define XSTD_TARGET(isa)
+#define XSTD_CPU_SUPPORTS(isa) 0
+#endif
+
+
+#endif /* INCLUDE_XSTD_CONFIG_SIMD_HPP_ */
@@ -122,13 +122,13 @@ struct zip_iterator {
 	}
 
 	value_tuple operator[](const difference_type n) {
-		return xstd::transform(iterators_, [n](auto iter) -> decltype(*iter)& {
+		return xstd::transform(iterators_, [n](auto iter) -> decltype(iter[n]) {
 			return iter[n];
 		});
 	}
 
 	reference_tuple operator*(){
-		return xstd::transform(iterators_, [](auto iter) -> decltype(*iter)& {
+		return xstd::transform(iterators_, [](auto iter) -> decltype(*iter) {
 			return *iter;
 		});
 	}
@@ -41,9 +41,9 @@ public:
 
 		using value_type         = T;
 		using pointer            = value_type*;
-		using const_pointer      = const pointer;
+		using const_pointer      = const value_type*;
 		using void_pointer       = void*;
-		using const_void_pointer = const void_pointer;
+		using const_void_pointer = const void*;
 		using reference          = typename ::std::add_lvalue_reference<value_type>::type;
 		using const_reference    = typename ::std::add_lvalue_reference<const value_type>::type;
 		using size_type          = std::size_t;
@@ -0,0 +1,294 @@
+/**
+ * \file       cardinality.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_SET_CARDINALITY_HPP_
+#define INCLUDE_XSTD_DETAIL_SET_CARDINALITY_HPP_
+
+
+#include "xstd/assert.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+/**
+ * \file
+ * cardinality.hpp
+ *
+ * \brief
+ * Probabilistic estimators for very large sets
+ *
+ * \details
+ * Sketches summarizing a set within a fixed amount of memory
+ * independent of the number of values inserted. Values are hashed
+ * with std::hash followed by a 64-bit finalizer so integer keys
+ * (which std::hash commonly maps to themselves) are well mixed.
+ * - xstd::hyperloglog estimates the number of distinct values
+ * - xstd::minhash estimates the Jaccard similarity of two sets
+ */
+
+/// @cond SKIP_DETAIL
+namespace xstd {
+namespace detail {
+
+/// SplitMix64 finalizer mixing all input bits into every output bit
+constexpr std::uint64_t splitmix64(std::uint64_t x) noexcept {
+	x += 0x9e3779b97f4a7c15ULL;
+	x  = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	x  = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+	return x ^ (x >> 31);
+}
+
+/// Well mixed 64-bit hash of a value
+template<typename T>
+std::uint64_t sketch_hash(const T& value) {
+	return splitmix64(static_cast<std::uint64_t>(std::hash<T>()(value)));
+}
+
+} /* namespace detail */
+} /* namespace xstd */
+/// @endcond
+
+
+namespace xstd {
+
+/// HyperLogLog estimator of the number of distinct values
+/**
+ * Keeps 2^Precision one byte registers holding the longest run of
+ * leading zero bits seen within the hashes routed to each register.
+ * The relative standard error of the estimate is about
+ * 1.04/sqrt(2^Precision) (0.8% for the default of 14 which uses
+ * 16 KiB). Sketches of the same precision can be merged to
+ * estimate the size of a union.
+ *
+ * \code
+ * xstd::hyperloglog<> a, b;
+ * a.insert(docs_a.begin(), docs_a.end());
+ * b.insert(docs_b.begin(), docs_b.end());
+ * auto common = xstd::intersection_estimate(a, b);
+ * \endcode
+ *
+ * \tparam Precision Number of hash bits selecting the register (4-18)
+ */
+template<std::size_t Precision = 14>
+class hyperloglog final {
+	STATIC_ASSERT((Precision >= 4) && (Precision <= 18), "HyperLogLog precision must be within [4,18]");
+
+public:
+
+	// ====================================================
+	// Types
+	// ====================================================
+
+	using size_type = std::size_t;
+
+	static constexpr size_type num_registers = size_type(1) << Precision;
+
+	// ====================================================
+	// Constructors
+	// ====================================================
+
+	hyperloglog() : registers_(num_registers, 0) {
+	}
+
+	// ====================================================
+	// Modification
+	// ====================================================
+
+	/** Insert a value */
+	template<typename T>
+	void insert(const T& value) {
+		this->insert_hash(detail::sketch_hash(value));
+	}
+
+	/** Insert every value within [first,last) */
+	template<typename InputIt>
+	void insert(InputIt first, InputIt last) {
+		for(; first != last; ++first){
+			this->insert(*first);
+		}
+	}
+
+	/** Insert a well mixed 64-bit hash */
+	void insert_hash(const std::uint64_t hash) noexcept {
+		const auto index = static_cast<size_type>(hash >> (64 - Precision));
+		const auto rest  = hash << Precision;
+		const auto rank  = static_cast<std::uint8_t>((rest == 0) ? (64 - Precision + 1) : (std::countl_zero(rest) + 1));
+		registers_[index] = std::max(registers_[index], rank);
+	}
+
+	/** Merge another sketch into this one (estimates the union) */
+	void merge(const hyperloglog& other) noexcept {
+		for(size_type i = 0; i < num_registers; ++i){
+			registers_[i] = std::max(registers_[i], other.registers_[i]);
+		}
+	}
+
+	/** Remove all values */
+	void clear() noexcept {
+		std::fill(registers_.begin(), registers_.end(), 0);
+	}
+
+	// ====================================================
+	// Query
+	// ====================================================
+
+	/** Estimated number of distinct values inserted */
+	double estimate() const noexcept {
+		const double m = static_cast<double>(num_registers);
+		double    sum   = 0;
+		size_type zeros = 0;
+		for(const auto r : registers_){
+			sum   += std::ldexp(1.0, -static_cast<int>(r));
+			zeros += (r == 0);
+		}
+		const double alpha = 0.7213 / (1.0 + 1.079 / m);
+		const double raw   = alpha * m * m / sum;
+
+		// Linear counting is more accurate for small sets
+		if( (raw <= 2.5 * m) && (zeros > 0) ){
+			return m * std::log(m / static_cast<double>(zeros));
+		}
+		return raw;
+	}
+
+
+	// ====================================================
+	// PRIVATE
+	// ====================================================
+
+private:
+	std::vector<std::uint8_t> registers_;
+
+};
+
+/// Estimated number of distinct values within both sketched sets
+/**
+ * Uses |A ∩ B| = |A| + |B| - |A ∪ B| so the absolute error is
+ * relative to the size of the union and small intersections of
+ * large sets are poorly resolved.
+ */
+template<std::size_t Precision>
+double intersection_estimate(const hyperloglog<Precision>& a, const hyperloglog<Precision>& b){
+	auto both = a;
+	both.merge(b);
+	return std::max(0.0, a.estimate() + b.estimate() - both.estimate());
+}
+
+
+/// MinHash signature estimating the Jaccard similarity of sets
+/**
+ * Keeps the minimum of NumHashes independent hash functions over
+ * the values inserted. The probability that two sets share the
+ * same minimum for a hash function equals their Jaccard index so
+ * the fraction of matching minima estimates it with a standard
+ * error of about 1/sqrt(NumHashes).
+ *
+ * \code
+ * xstd::minhash<> a, b;
+ * a.insert(doc_a.begin(), doc_a.end());
+ * b.insert(doc_b.begin(), doc_b.end());
+ * double sim = a.jaccard(b);
+ * \endcode
+ *
+ * \tparam NumHashes Number of hash functions within the signature
+ */
+template<std::size_t NumHashes = 128>
+class minhash final {
+	STATIC_ASSERT(NumHashes > 0, "MinHash requires at least one hash function");
+
+public:
+
+	// ====================================================
+	// Types
+	// ====================================================
+
+	using size_type = std::size_t;
+
+	// ====================================================
+	// Constructors
+	// ====================================================
+
+	minhash() noexcept {
+		this->clear();
+	}
+
+	// ====================================================
+	// Modification
+	// ====================================================
+
+	/** Insert a value */
+	template<typename T>
+	void insert(const T& value) {
+		this->insert_hash(detail::sketch_hash(value));
+	}
+
+	/** Insert every value within [first,last) */
+	template<typename InputIt>
+	void insert(InputIt first, InputIt last) {
+		for(; first != last; ++first){
+			this->insert(*first);
+		}
+	}
+
+	/** Insert a well mixed 64-bit hash */
+	void insert_hash(const std::uint64_t hash) noexcept {
+		for(size_type i = 0; i < NumHashes; ++i){
+			const auto h = detail::splitmix64(hash ^ (0x9e3779b97f4a7c15ULL * (i + 1)));
+			signature_[i] = std::min(signature_[i], h);
+		}
+	}
+
+	/** Merge another signature into this one (signature of the union) */
+	void merge(const minhash& other) noexcept {
+		for(size_type i = 0; i < NumHashes; ++i){
+			signature_[i] = std::min(signature_[i], other.signature_[i]);
+		}
+	}
+
+	/** Remove all values */
+	void clear() noexcept {
+		signature_.fill(std::numeric_limits<std::uint64_t>::max());
+	}
+
+	// ====================================================
+	// Query
+	// ====================================================
+
+	/** Estimated Jaccard index of the two sets */
+	double jaccard(const minhash& other) const noexcept {
+		size_type same = 0;
+		for(size_type i = 0; i < NumHashes; ++i){
+			same += (signature_[i] == other.signature_[i]);
+		}
+		return static_cast<double>(same) / static_cast<double>(NumHashes);
+	}
+
+	/** Minimum hash values */
+	const std::array<std::uint64_t, NumHashes>& signature() const noexcept {
+		return signature_;
+	}
+
+
+	// ====================================================
+	// PRIVATE
+	// ====================================================
+
+private:
+	std::array<std::uint64_t, NumHashes> signature_;
+
+};
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_SET_CARDINALITY_HPP_ */
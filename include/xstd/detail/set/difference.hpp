@@ -0,0 +1,92 @@
+/**
+ * \file       difference.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_SET_DIFFERENCE_HPP_
+#define INCLUDE_XSTD_DETAIL_SET_DIFFERENCE_HPP_
+
+
+#include "xstd/detail/algorithm/gallop_search.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <tuple>
+#include <utility>
+
+
+/// @cond SKIP_DETAIL
+namespace xstd {
+namespace detail {
+
+/// Remove values of first found within any of the exclusion ranges
+template<bool Unique, typename Output, typename First, typename Iterators, std::size_t... I>
+void sorted_difference(Output& out, const First& first, [[maybe_unused]] Iterators its, const Iterators& ends, std::index_sequence<I...>) {
+	[[maybe_unused]] auto excluded = [&](const auto& value, auto& cur, const auto& end){
+		cur = gallop_lower_bound(cur, end, value);
+		return (cur != end) && (not (value < *cur));
+	};
+
+	auto it = std::cbegin(first);
+	const auto last = std::cend(first);
+	while( it != last ){
+		const auto& value = *it;
+		if( not (excluded(value, std::get<I>(its), std::get<I>(ends)) || ...) ){
+			out.insert(std::cend(out), value);
+		}
+		++it;
+		if constexpr ( Unique ) {
+			while( (it != last) && (not (value < *it)) ){
+				++it;
+			}
+		}
+	}
+}
+
+} /* namespace detail */
+} /* namespace xstd */
+/// @endcond
+
+
+namespace xstd {
+
+/// Set Difference taking multiple sorted containers
+/**
+ * Writes the values of first which are not found within any of
+ * the other containers. Every container is read once from front to
+ * back and containers with random access iterators are advanced
+ * with a galloping search so short exclusion lists against a long
+ * first container (or the reverse) are cheap.
+ *
+ * With Unique set (default) duplicate values within first are
+ * written once. Otherwise every copy not excluded is written.
+ *
+ * \code
+ * std::vector<int> out;
+ * xstd::Difference(out, candidates, blocked, deleted);
+ * \endcode
+ *
+ * \tparam Unique Write each distinct value of first once
+ *
+ * \param out[inout] Output container to build difference within
+ * \param first[in] Sorted container of values to keep
+ * \param others[in] Variable argument array of sorted containers to exclude
+ *
+ * \returns The new output container with difference
+ */
+template<bool Unique = true, typename Output, typename FirstType, typename... SortedType>
+requires std::ranges::forward_range<const FirstType> && (std::ranges::input_range<const SortedType> && ...)
+Output Difference(Output& out, const FirstType& first, const SortedType& ...others){
+	detail::sorted_difference<Unique>(out, first,
+			std::make_tuple( std::cbegin(others)... ),
+			std::make_tuple( std::cend(others)... ),
+			std::index_sequence_for<SortedType...>());
+	return out;
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_SET_DIFFERENCE_HPP_ */
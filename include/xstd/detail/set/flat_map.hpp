@@ -0,0 +1,485 @@
+/**
+ * \file       flat_map.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_SET_FLAT_MAP_HPP_
+#define INCLUDE_XSTD_DETAIL_SET_FLAT_MAP_HPP_
+
+
+#include "xstd/detail/set/flat_search.hpp"
+#include "xstd/detail/vector/bounded_vector.hpp"
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * flat_map.hpp
+ *
+ * \brief
+ * Associative map stored as contiguous sorted key-value pairs
+ *
+ * \details
+ * Models std::map while keeping the pairs sorted by key within a
+ * single sequence container. Lookups are a search over contiguous
+ * memory and the whole table costs one allocation, or none when
+ * the container is a bounded_vector. Insertion and removal shift
+ * the following pairs so the map suits small or read mostly tables.
+ */
+
+namespace xstd {
+
+/// Sorted contiguous map that models std::map
+/**
+ * Unlike std::map the value_type is std::pair<Key,T> so the pairs
+ * can be shifted within the container. The key of an element must
+ * never be modified through an iterator. Insertion and removal
+ * invalidate all iterators.
+ *
+ * \code
+ * xstd::bounded_flat_map<int,double,16> table; // on the stack
+ * table[3] = 1.5;
+ * if( table.contains(3) ){ ... }
+ * \endcode
+ *
+ * \tparam Key Type of keys
+ * \tparam T Type of mapped values
+ * \tparam Compare Ordering of the keys
+ * \tparam Container Random access container of std::pair<Key,T>
+ * \tparam Search Policy performing the lower_bound of every lookup
+ */
+template<typename Key,
+         typename T,
+         typename Compare   = std::less<Key>,
+         typename Container = std::vector<std::pair<Key,T>>,
+         typename Search    = binary_search_policy>
+class flat_map final {
+
+public:
+
+	// ====================================================
+	// Types
+	// ====================================================
+
+	using key_type               = Key;
+	using mapped_type            = T;
+	using value_type             = std::pair<Key,T>;
+	using key_compare            = Compare;
+	using container_type         = Container;
+	using search_policy          = Search;
+	using size_type              = typename Container::size_type;
+	using difference_type        = typename Container::difference_type;
+	using reference              = value_type&;
+	using const_reference        = const value_type&;
+	using iterator               = typename Container::iterator;
+	using const_iterator         = typename Container::const_iterator;
+	using reverse_iterator       = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	static_assert(std::is_same<typename Container::value_type, value_type>::value,
+	              "Container must hold std::pair<Key,T>");
+
+	/// Orders pairs by key
+	class value_compare {
+	public:
+		bool operator()(const value_type& a, const value_type& b) const {
+			return comp_(a.first, b.first);
+		}
+
+	private:
+		friend class flat_map;
+
+		explicit value_compare(const key_compare& comp) : comp_(comp) {
+		}
+
+		key_compare comp_;
+	};
+
+	// ====================================================
+	// Constructors
+	// ====================================================
+
+	flat_map() = default;
+
+	explicit flat_map(const key_compare& comp)
+		: c_(), comp_(comp) {
+	}
+
+	/// Take values of a container keeping the first of equal keys
+	explicit flat_map(container_type c, const key_compare& comp = key_compare())
+		: c_(std::move(c)), comp_(comp) {
+		detail::flat_sort_unique(c_, c_.begin(), this->value_comp());
+	}
+
+	/// Take values of a container already sorted with unique keys
+	flat_map(sorted_unique_t, container_type c, const key_compare& comp = key_compare())
+		: c_(std::move(c)), comp_(comp) {
+	}
+
+	template<std::input_iterator InputIt>
+	flat_map(InputIt first, InputIt last, const key_compare& comp = key_compare())
+		: c_(), comp_(comp) {
+		this->insert(first, last);
+	}
+
+	flat_map(std::initializer_list<value_type> init, const key_compare& comp = key_compare())
+		: flat_map(init.begin(), init.end(), comp) {
+	}
+
+	flat_map& operator=(std::initializer_list<value_type> ilist) {
+		this->clear();
+		this->insert(ilist.begin(), ilist.end());
+		return *this;
+	}
+
+	// ====================================================
+	// Element Access
+	// ====================================================
+
+	mapped_type& at(const key_type& key) {
+		auto it = this->find(key);
+		if( it == this->end() ){
+			throw std::out_of_range("flat_map::at");
+		}
+		return it->second;
+	}
+
+	const mapped_type& at(const key_type& key) const {
+		auto it = this->find(key);
+		if( it == this->end() ){
+			throw std::out_of_range("flat_map::at");
+		}
+		return it->second;
+	}
+
+	mapped_type& operator[](const key_type& key) {
+		return this->try_emplace(key).first->second;
+	}
+
+	mapped_type& operator[](key_type&& key) {
+		return this->try_emplace(std::move(key)).first->second;
+	}
+
+	// ====================================================
+	// Iterators
+	// ====================================================
+
+	iterator begin() noexcept { return c_.begin(); }
+	iterator end() noexcept { return c_.end(); }
+	const_iterator begin() const noexcept { return c_.begin(); }
+	const_iterator end() const noexcept { return c_.end(); }
+	const_iterator cbegin() const noexcept { return c_.cbegin(); }
+	const_iterator cend() const noexcept { return c_.cend(); }
+
+	reverse_iterator rbegin() noexcept { return reverse_iterator(this->end()); }
+	reverse_iterator rend() noexcept { return reverse_iterator(this->begin()); }
+	const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(this->end()); }
+	const_reverse_iterator rend() const noexcept { return const_reverse_iterator(this->begin()); }
+	const_reverse_iterator crbegin() const noexcept { return this->rbegin(); }
+	const_reverse_iterator crend() const noexcept { return this->rend(); }
+
+	// ====================================================
+	// Capacity
+	// ====================================================
+
+	[[nodiscard]] bool empty() const noexcept {
+		return c_.empty();
+	}
+
+	size_type size() const noexcept {
+		return c_.size();
+	}
+
+	size_type max_size() const noexcept {
+		return c_.max_size();
+	}
+
+	// ====================================================
+	// Modifiers
+	// ====================================================
+
+	template<typename... Args>
+	std::pair<iterator,bool> emplace(Args&&... args) {
+		value_type value(std::forward<Args>(args)...);
+		auto it = this->lower_bound(value.first);
+		if( (it != this->end()) && (not comp_(value.first, it->first)) ){
+			return {it, false};
+		}
+		return {c_.insert(it, std::move(value)), true};
+	}
+
+	std::pair<iterator,bool> insert(const value_type& value) {
+		return this->emplace(value);
+	}
+
+	std::pair<iterator,bool> insert(value_type&& value) {
+		return this->emplace(std::move(value));
+	}
+
+	/// Insert values keeping existing keys
+	/**
+	 * Appends the values then sorts and merges them so inserting
+	 * m values costs O(m log m + n) instead of O(m n). Containers
+	 * of fixed capacity insert each value in place so nothing is
+	 * allocated and duplicates never exceed the capacity.
+	 */
+	template<std::input_iterator InputIt>
+	void insert(InputIt first, InputIt last) {
+		if constexpr ( detail::flat_fixed_capacity<container_type>::value ) {
+			for(; first != last; ++first){
+				this->emplace(*first);
+			}
+		}
+		else {
+			const auto old_size = c_.size();
+			for(; first != last; ++first){
+				c_.emplace_back(*first);
+			}
+			detail::flat_sort_unique(c_, c_.begin() + old_size, this->value_comp());
+		}
+	}
+
+	void insert(std::initializer_list<value_type> ilist) {
+		this->insert(ilist.begin(), ilist.end());
+	}
+
+	template<typename... Args>
+	std::pair<iterator,bool> try_emplace(const key_type& key, Args&&... args) {
+		return this->try_emplace_(key, std::forward<Args>(args)...);
+	}
+
+	template<typename... Args>
+	std::pair<iterator,bool> try_emplace(key_type&& key, Args&&... args) {
+		return this->try_emplace_(std::move(key), std::forward<Args>(args)...);
+	}
+
+	template<typename M>
+	std::pair<iterator,bool> insert_or_assign(const key_type& key, M&& obj) {
+		auto ans = this->try_emplace(key, std::forward<M>(obj));
+		if( not ans.second ){
+			ans.first->second = std::forward<M>(obj);
+		}
+		return ans;
+	}
+
+	template<typename M>
+	std::pair<iterator,bool> insert_or_assign(key_type&& key, M&& obj) {
+		auto ans = this->try_emplace(std::move(key), std::forward<M>(obj));
+		if( not ans.second ){
+			ans.first->second = std::forward<M>(obj);
+		}
+		return ans;
+	}
+
+	iterator erase(iterator pos) {
+		return c_.erase(pos);
+	}
+
+	iterator erase(const_iterator pos) {
+		return c_.erase(pos);
+	}
+
+	iterator erase(const_iterator first, const_iterator last) {
+		return c_.erase(first, last);
+	}
+
+	size_type erase(const key_type& key) {
+		auto it = this->find(key);
+		if( it == this->end() ){
+			return 0;
+		}
+		c_.erase(it);
+		return 1;
+	}
+
+	void clear() noexcept {
+		c_.clear();
+	}
+
+	void swap(flat_map& other) noexcept {
+		using std::swap;
+		swap(c_, other.c_);
+		swap(comp_, other.comp_);
+	}
+
+	/// Remove and return the underlying container
+	container_type extract() && {
+		container_type ans = std::move(c_);
+		c_.clear();
+		return ans;
+	}
+
+	/// Replace the underlying container with sorted unique values
+	void replace(container_type&& c) {
+		c_ = std::move(c);
+	}
+
+	// ====================================================
+	// Lookup
+	// ====================================================
+
+	iterator find(const key_type& key) { return this->find_(key); }
+	const_iterator find(const key_type& key) const { return this->find_(key); }
+	size_type count(const key_type& key) const { return this->contains(key) ? 1 : 0; }
+	bool contains(const key_type& key) const { return this->find_(key) != this->end(); }
+	iterator lower_bound(const key_type& key) { return this->lower_bound_(key); }
+	const_iterator lower_bound(const key_type& key) const { return this->lower_bound_(key); }
+	iterator upper_bound(const key_type& key) { return this->upper_bound_(key); }
+	const_iterator upper_bound(const key_type& key) const { return this->upper_bound_(key); }
+
+	std::pair<iterator,iterator> equal_range(const key_type& key) {
+		return {this->lower_bound_(key), this->upper_bound_(key)};
+	}
+
+	std::pair<const_iterator,const_iterator> equal_range(const key_type& key) const {
+		return {this->lower_bound_(key), this->upper_bound_(key)};
+	}
+
+	// Heterogeneous lookup with a transparent comparison
+
+	template<typename K> requires detail::transparent_compare<Compare>
+	iterator find(const K& key) { return this->find_(key); }
+
+	template<typename K> requires detail::transparent_compare<Compare>
+	const_iterator find(const K& key) const { return this->find_(key); }
+
+	template<typename K> requires detail::transparent_compare<Compare>
+	size_type count(const K& key) const { return this->contains(key) ? 1 : 0; }
+
+	template<typename K> requires detail::transparent_compare<Compare>
+	bool contains(const K& key) const { return this->find_(key) != this->end(); }
+
+	template<typename K> requires detail::transparent_compare<Compare>
+	iterator lower_bound(const K& key) { return this->lower_bound_(key); }
+
+	template<typename K> requires detail::transparent_compare<Compare>
+	const_iterator lower_bound(const K& key) const { return this->lower_bound_(key); }
+
+	template<typename K> requires detail::transparent_compare<Compare>
+	iterator upper_bound(const K& key) { return this->upper_bound_(key); }
+
+	template<typename K> requires detail::transparent_compare<Compare>
+	const_iterator upper_bound(const K& key) const { return this->upper_bound_(key); }
+
+	// ====================================================
+	// Observers
+	// ====================================================
+
+	key_compare key_comp() const {
+		return comp_;
+	}
+
+	value_compare value_comp() const {
+		return value_compare(comp_);
+	}
+
+	const container_type& container() const noexcept {
+		return c_;
+	}
+
+private:
+	container_type                    c_;
+	[[no_unique_address]] key_compare comp_;
+
+	template<typename K>
+	iterator lower_bound_(const K& key) {
+		return Search()(c_.begin(), c_.end(), key, [this](const value_type& v, const K& k){
+			return comp_(v.first, k);
+		});
+	}
+
+	template<typename K>
+	const_iterator lower_bound_(const K& key) const {
+		return Search()(c_.begin(), c_.end(), key, [this](const value_type& v, const K& k){
+			return comp_(v.first, k);
+		});
+	}
+
+	template<typename K>
+	iterator upper_bound_(const K& key) {
+		return Search()(c_.begin(), c_.end(), key, [this](const value_type& v, const K& k){
+			return not comp_(k, v.first);
+		});
+	}
+
+	template<typename K>
+	const_iterator upper_bound_(const K& key) const {
+		return Search()(c_.begin(), c_.end(), key, [this](const value_type& v, const K& k){
+			return not comp_(k, v.first);
+		});
+	}
+
+	template<typename K>
+	iterator find_(const K& key) {
+		auto it = this->lower_bound_(key);
+		return ((it != this->end()) && (not comp_(key, it->first))) ? it : this->end();
+	}
+
+	template<typename K>
+	const_iterator find_(const K& key) const {
+		auto it = this->lower_bound_(key);
+		return ((it != this->end()) && (not comp_(key, it->first))) ? it : this->end();
+	}
+
+	template<typename K, typename... Args>
+	std::pair<iterator,bool> try_emplace_(K&& key, Args&&... args) {
+		auto it = this->lower_bound_(key);
+		if( (it != this->end()) && (not comp_(key, it->first)) ){
+			return {it, false};
+		}
+		it = c_.emplace(it,
+		                std::piecewise_construct,
+		                std::forward_as_tuple(std::forward<K>(key)),
+		                std::forward_as_tuple(std::forward<Args>(args)...));
+		return {it, true};
+	}
+};
+
+
+/// Flat map held entirely within a bounded_vector
+template<typename Key, typename T, std::size_t N, typename Compare = std::less<Key>, typename Search = binary_search_policy>
+using bounded_flat_map = flat_map<Key, T, Compare, bounded_vector<std::pair<Key,T>,N>, Search>;
+
+
+// ================================================================
+//                        Free Functions
+// ================================================================
+
+template<typename K, typename T, typename C, typename S, typename P>
+bool operator==(const flat_map<K,T,C,S,P>& lhs, const flat_map<K,T,C,S,P>& rhs) {
+	return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<typename K, typename T, typename C, typename S, typename P>
+auto operator<=>(const flat_map<K,T,C,S,P>& lhs, const flat_map<K,T,C,S,P>& rhs) {
+	return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<typename K, typename T, typename C, typename S, typename P>
+void swap(flat_map<K,T,C,S,P>& lhs, flat_map<K,T,C,S,P>& rhs) noexcept {
+	lhs.swap(rhs);
+}
+
+template<typename K, typename T, typename C, typename S, typename P, typename Pred>
+typename flat_map<K,T,C,S,P>::size_type erase_if(flat_map<K,T,C,S,P>& c, Pred pred) {
+	auto it = std::remove_if(c.begin(), c.end(), pred);
+	const auto count = static_cast<std::size_t>(c.end() - it);
+	c.erase(it, c.end());
+	return count;
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_SET_FLAT_MAP_HPP_ */
@@ -0,0 +1,112 @@
+/**
+ * \file       flat_search.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_SET_FLAT_SEARCH_HPP_
+#define INCLUDE_XSTD_DETAIL_SET_FLAT_SEARCH_HPP_
+
+
+#include "xstd/detail/algorithm/branchless_search.hpp"
+#include "xstd/detail/vector/bounded_vector.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+/**
+ * \file
+ * flat_search.hpp
+ *
+ * \brief
+ * Search policies and helpers shared by flat_set and flat_map
+ *
+ * \details
+ * A search policy is a function object with the signature of
+ * std::lower_bound used by the flat containers for every lookup.
+ * Small tables of cheap keys are usually fastest with the
+ * branchless search while large tables or expensive keys favor
+ * the classic binary search which does fewer comparisons.
+ */
+
+namespace xstd {
+
+/// Tag selecting constructors which take already sorted unique values
+struct sorted_unique_t {
+	explicit sorted_unique_t() = default;
+};
+
+inline constexpr sorted_unique_t sorted_unique{};
+
+
+/// Lookup with std::lower_bound
+struct binary_search_policy {
+	template<typename RandomIt, typename T, typename Compare>
+	RandomIt operator()(RandomIt first, RandomIt last, const T& value, Compare comp) const {
+		return std::lower_bound(first, last, value, comp);
+	}
+};
+
+/// Lookup with xstd::branchless_lower_bound
+struct branchless_search_policy {
+	template<typename RandomIt, typename T, typename Compare>
+	RandomIt operator()(RandomIt first, RandomIt last, const T& value, Compare comp) const {
+		return branchless_lower_bound(first, last, value, comp);
+	}
+};
+
+
+/// @cond SKIP_DETAIL
+namespace detail {
+
+template<typename Compare>
+concept transparent_compare = requires { typename Compare::is_transparent; };
+
+/// Containers with storage fixed at compile time
+template<typename Container>
+struct flat_fixed_capacity : std::false_type {};
+
+template<typename T, std::size_t N, bool I>
+struct flat_fixed_capacity<bounded_vector<T,N,I>> : std::true_type {};
+
+/// Sort values of a container and remove all but the first of equivalent values
+/**
+ * Values before mid must already be sorted and unique. Containers
+ * of fixed capacity are merged by rotating each value into place
+ * since std::stable_sort and std::inplace_merge take temporary
+ * buffers from the heap.
+ */
+template<typename Container, typename Less>
+void flat_sort_unique(Container& c, typename Container::iterator mid, Less less){
+	if constexpr ( flat_fixed_capacity<Container>::value ) {
+		auto sorted_end = mid;
+		for(auto it = mid; it != c.end(); ++it){
+			auto pos = std::upper_bound(c.begin(), sorted_end, *it, less);
+			if( (pos != c.begin()) && (not less(*std::prev(pos), *it)) ){
+				continue;
+			}
+			std::iter_swap(sorted_end, it);
+			std::rotate(pos, sorted_end, std::next(sorted_end));
+			++sorted_end;
+		}
+		c.erase(sorted_end, c.end());
+	}
+	else {
+		std::stable_sort(mid, c.end(), less);
+		std::inplace_merge(c.begin(), mid, c.end(), less);
+		auto equivalent = [&](const auto& a, const auto& b){
+			return not less(a, b);
+		};
+		c.erase(std::unique(c.begin(), c.end(), equivalent), c.end());
+	}
+}
+
+} /* namespace detail */
+/// @endcond
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_SET_FLAT_SEARCH_HPP_ */
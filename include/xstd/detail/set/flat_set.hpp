@@ -0,0 +1,331 @@
+/**
+ * \file       flat_set.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_SET_FLAT_SET_HPP_
+#define INCLUDE_XSTD_DETAIL_SET_FLAT_SET_HPP_
+
+
+#include "xstd/detail/set/flat_search.hpp"
+#include "xstd/detail/vector/bounded_vector.hpp"
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * flat_set.hpp
+ *
+ * \brief
+ * Associative set stored as contiguous sorted values
+ *
+ * \details
+ * Models std::set while keeping the values sorted within a single
+ * sequence container. The sorted values can be handed directly to
+ * the set algorithms of this library (intersection, union, ...).
+ */
+
+namespace xstd {
+
+/// Sorted contiguous set that models std::set
+/**
+ * Insertion and removal invalidate all iterators.
+ *
+ * \tparam Key Type of values
+ * \tparam Compare Ordering of the values
+ * \tparam Container Random access container of Key
+ * \tparam Search Policy performing the lower_bound of every lookup
+ */
+template<typename Key,
+         typename Compare   = std::less<Key>,
+         typename Container = std::vector<Key>,
+         typename Search    = binary_search_policy>
+class flat_set final {
+
+public:
+
+	// ====================================================
+	// Types
+	// ====================================================
+
+	using key_type               = Key;
+	using value_type             = Key;
+	using key_compare            = Compare;
+	using value_compare          = Compare;
+	using container_type         = Container;
+	using search_policy          = Search;
+	using size_type              = typename Container::size_type;
+	using difference_type        = typename Container::difference_type;
+	using reference              = value_type&;
+	using const_reference        = const value_type&;
+	using iterator               = typename Container::const_iterator;
+	using const_iterator         = typename Container::const_iterator;
+	using reverse_iterator       = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	static_assert(std::is_same<typename Container::value_type, value_type>::value,
+	              "Container must hold Key");
+
+	// ====================================================
+	// Constructors
+	// ====================================================
+
+	flat_set() = default;
+
+	explicit flat_set(const key_compare& comp)
+		: c_(), comp_(comp) {
+	}
+
+	/// Take values of a container keeping the first of equal values
+	explicit flat_set(container_type c, const key_compare& comp = key_compare())
+		: c_(std::move(c)), comp_(comp) {
+		detail::flat_sort_unique(c_, c_.begin(), comp_);
+	}
+
+	/// Take values of a container already sorted and unique
+	flat_set(sorted_unique_t, container_type c, const key_compare& comp = key_compare())
+		: c_(std::move(c)), comp_(comp) {
+	}
+
+	template<std::input_iterator InputIt>
+	flat_set(InputIt first, InputIt last, const key_compare& comp = key_compare())
+		: c_(), comp_(comp) {
+		this->insert(first, last);
+	}
+
+	flat_set(std::initializer_list<value_type> init, const key_compare& comp = key_compare())
+		: flat_set(init.begin(), init.end(), comp) {
+	}
+
+	flat_set& operator=(std::initializer_list<value_type> ilist) {
+		this->clear();
+		this->insert(ilist.begin(), ilist.end());
+		return *this;
+	}
+
+	// ====================================================
+	// Iterators
+	// ====================================================
+
+	const_iterator begin() const noexcept { return c_.begin(); }
+	const_iterator end() const noexcept { return c_.end(); }
+	const_iterator cbegin() const noexcept { return c_.cbegin(); }
+	const_iterator cend() const noexcept { return c_.cend(); }
+
+	const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(this->end()); }
+	const_reverse_iterator rend() const noexcept { return const_reverse_iterator(this->begin()); }
+	const_reverse_iterator crbegin() const noexcept { return this->rbegin(); }
+	const_reverse_iterator crend() const noexcept { return this->rend(); }
+
+	// ====================================================
+	// Capacity
+	// ====================================================
+
+	[[nodiscard]] bool empty() const noexcept {
+		return c_.empty();
+	}
+
+	size_type size() const noexcept {
+		return c_.size();
+	}
+
+	size_type max_size() const noexcept {
+		return c_.max_size();
+	}
+
+	// ====================================================
+	// Modifiers
+	// ====================================================
+
+	template<typename... Args>
+	std::pair<iterator,bool> emplace(Args&&... args) {
+		value_type value(std::forward<Args>(args)...);
+		auto it = this->lower_bound_(value);
+		if( (it != c_.end()) && (not comp_(value, *it)) ){
+			return {it, false};
+		}
+		return {c_.insert(it, std::move(value)), true};
+	}
+
+	std::pair<iterator,bool> insert(const value_type& value) {
+		return this->emplace(value);
+	}
+
+	std::pair<iterator,bool> insert(value_type&& value) {
+		return this->emplace(std::move(value));
+	}
+
+	/// Insert values by appending then sorting and merging
+	/**
+	 * Containers of fixed capacity insert each value in place so
+	 * nothing is allocated.
+	 */
+	template<std::input_iterator InputIt>
+	void insert(InputIt first, InputIt last) {
+		if constexpr ( detail::flat_fixed_capacity<container_type>::value ) {
+			for(; first != last; ++first){
+				this->emplace(*first);
+			}
+		}
+		else {
+			const auto old_size = c_.size();
+			for(; first != last; ++first){
+				c_.emplace_back(*first);
+			}
+			detail::flat_sort_unique(c_, c_.begin() + old_size, comp_);
+		}
+	}
+
+	void insert(std::initializer_list<value_type> ilist) {
+		this->insert(ilist.begin(), ilist.end());
+	}
+
+	iterator erase(const_iterator pos) {
+		return c_.erase(pos);
+	}
+
+	iterator erase(const_iterator first, const_iterator last) {
+		return c_.erase(first, last);
+	}
+
+	size_type erase(const key_type& key) {
+		auto it = this->find_(key);
+		if( it == c_.end() ){
+			return 0;
+		}
+		c_.erase(it);
+		return 1;
+	}
+
+	void clear() noexcept {
+		c_.clear();
+	}
+
+	void swap(flat_set& other) noexcept {
+		using std::swap;
+		swap(c_, other.c_);
+		swap(comp_, other.comp_);
+	}
+
+	/// Remove and return the underlying container
+	container_type extract() && {
+		container_type ans = std::move(c_);
+		c_.clear();
+		return ans;
+	}
+
+	/// Replace the underlying container with sorted unique values
+	void replace(container_type&& c) {
+		c_ = std::move(c);
+	}
+
+	// ====================================================
+	// Lookup
+	// ====================================================
+
+	const_iterator find(const key_type& key) const { return this->find_(key); }
+	size_type count(const key_type& key) const { return this->contains(key) ? 1 : 0; }
+	bool contains(const key_type& key) const { return this->find_(key) != this->end(); }
+	const_iterator lower_bound(const key_type& key) const { return this->lower_bound_(key); }
+	const_iterator upper_bound(const key_type& key) const { return this->upper_bound_(key); }
+
+	std::pair<const_iterator,const_iterator> equal_range(const key_type& key) const {
+		return {this->lower_bound_(key), this->upper_bound_(key)};
+	}
+
+	// Heterogeneous lookup with a transparent comparison
+
+	template<typename K> requires detail::transparent_compare<Compare>
+	const_iterator find(const K& key) const { return this->find_(key); }
+
+	template<typename K> requires detail::transparent_compare<Compare>
+	size_type count(const K& key) const { return this->contains(key) ? 1 : 0; }
+
+	template<typename K> requires detail::transparent_compare<Compare>
+	bool contains(const K& key) const { return this->find_(key) != this->end(); }
+
+	template<typename K> requires detail::transparent_compare<Compare>
+	const_iterator lower_bound(const K& key) const { return this->lower_bound_(key); }
+
+	template<typename K> requires detail::transparent_compare<Compare>
+	const_iterator upper_bound(const K& key) const { return this->upper_bound_(key); }
+
+	// ====================================================
+	// Observers
+	// ====================================================
+
+	key_compare key_comp() const {
+		return comp_;
+	}
+
+	value_compare value_comp() const {
+		return comp_;
+	}
+
+	const container_type& container() const noexcept {
+		return c_;
+	}
+
+private:
+	container_type                    c_;
+	[[no_unique_address]] key_compare comp_;
+
+	template<typename K>
+	const_iterator lower_bound_(const K& key) const {
+		return Search()(c_.begin(), c_.end(), key, [this](const value_type& v, const K& k){
+			return comp_(v, k);
+		});
+	}
+
+	template<typename K>
+	const_iterator upper_bound_(const K& key) const {
+		return Search()(c_.begin(), c_.end(), key, [this](const value_type& v, const K& k){
+			return not comp_(k, v);
+		});
+	}
+
+	template<typename K>
+	const_iterator find_(const K& key) const {
+		auto it = this->lower_bound_(key);
+		return ((it != c_.end()) && (not comp_(key, *it))) ? it : c_.end();
+	}
+};
+
+
+/// Flat set held entirely within a bounded_vector
+template<typename Key, std::size_t N, typename Compare = std::less<Key>, typename Search = binary_search_policy>
+using bounded_flat_set = flat_set<Key, Compare, bounded_vector<Key,N>, Search>;
+
+
+// ================================================================
+//                        Free Functions
+// ================================================================
+
+template<typename K, typename C, typename S, typename P>
+bool operator==(const flat_set<K,C,S,P>& lhs, const flat_set<K,C,S,P>& rhs) {
+	return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<typename K, typename C, typename S, typename P>
+auto operator<=>(const flat_set<K,C,S,P>& lhs, const flat_set<K,C,S,P>& rhs) {
+	return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<typename K, typename C, typename S, typename P>
+void swap(flat_set<K,C,S,P>& lhs, flat_set<K,C,S,P>& rhs) noexcept {
+	lhs.swap(rhs);
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_SET_FLAT_SET_HPP_ */
@@ -8,7 +8,164 @@
 #ifndef INCLUDE_XSTD_SET_INTERSECTION_HPP_
 #define INCLUDE_XSTD_SET_INTERSECTION_HPP_
 
-#include "xstd/tuple.hpp"
+#include "xstd/assert.hpp"
+#include "xstd/detail/algorithm/gallop_search.hpp"
+#include "xstd/detail/config/simd.hpp"
+#include "xstd/detail/set/simd_intersection.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+/// @cond SKIP_DETAIL
+namespace xstd {
+namespace detail {
+
+/// Larger list length at which galloping beats the SIMD merge
+constexpr std::size_t intersection_simd_max_ratio = 32;
+
+/// True if both ranges are contiguous arrays of the same 32-bit integer
+template<typename A, typename B>
+constexpr bool intersection_simd_capable() {
+#if defined(XSTD_HAS_SSE2)
+	if constexpr ( std::ranges::contiguous_range<const A> && std::ranges::contiguous_range<const B> ) {
+		using a_type = std::ranges::range_value_t<const A>;
+		using b_type = std::ranges::range_value_t<const B>;
+		return std::is_same<a_type, b_type>::value && std::is_integral<a_type>::value && (sizeof(a_type) == 4);
+	}
+#endif
+	return false;
+}
+
+/// Galloping k-way intersection of sorted ranges
+/**
+ * Each round gallops every cursor to the first value not less
+ * than the current candidate. A cursor landing past the candidate
+ * raises it. A round in which no cursor raised the candidate found
+ * a value present in every range.
+ */
+template<typename Emit, typename Iterators, std::size_t... I>
+void gallop_intersection(Emit& emit, Iterators its, const Iterators& ends, std::index_sequence<I...>) {
+	using value_type = std::common_type_t<typename std::iterator_traits<std::tuple_element_t<I, Iterators>>::value_type...>;
+
+	if( ((std::get<I>(its) == std::get<I>(ends)) || ...) ){
+		return;
+	}
+
+	// Gallop cursor I to candidate returning true if exhausted
+	value_type candidate = *std::get<0>(its);
+	bool       raised    = false;
+	auto advance = [&](auto& cur, const auto& end){
+		cur = gallop_lower_bound(cur, end, candidate);
+		if( cur == end ){
+			return true;
+		}
+		if( candidate < *cur ){
+			candidate = *cur;
+			raised    = true;
+		}
+		return false;
+	};
+
+	while( true ){
+		raised = false;
+		if( (advance(std::get<I>(its), std::get<I>(ends)) || ...) ){
+			return;
+		}
+		if( not raised ){
+			emit(candidate);
+			if( ((++std::get<I>(its) == std::get<I>(ends)) || ...) ){
+				return;
+			}
+			candidate = *std::get<0>(its);
+		}
+	}
+}
+
+/// Position within one of a runtime number of sorted ranges
+template<typename Iterator>
+struct intersection_cursor {
+	Iterator    cur;
+	Iterator    end;
+	std::size_t size;
+};
+
+/// Number of cursors held on the stack before allocating
+constexpr std::size_t intersection_stack_cursors = 64;
+
+/// Intersection of cursors ordered smallest range first
+/**
+ * The smallest range proposes each candidate and every other
+ * range gallops toward it. A range landing past the candidate
+ * moves the smallest range forward to the new value.
+ */
+template<typename Cursor, typename OutputIt>
+std::size_t cursor_intersection(Cursor* cursors, const std::size_t num_cursors, OutputIt& d_first, const std::size_t max_count) {
+	auto& lead = cursors[0];
+	std::size_t count = 0;
+	while( (count < max_count) && (lead.cur != lead.end) ){
+		const auto candidate = *lead.cur;
+		std::size_t i = 1;
+		for(; i < num_cursors; ++i){
+			auto& c = cursors[i];
+			c.cur = gallop_lower_bound(c.cur, c.end, candidate);
+			if( c.cur == c.end ){
+				return count;
+			}
+			if( candidate < *c.cur ){
+				lead.cur = gallop_lower_bound(lead.cur, lead.end, *c.cur);
+				break;
+			}
+		}
+		if( i == num_cursors ){
+			*d_first = candidate;
+			++d_first;
+			++count;
+			++lead.cur;
+		}
+	}
+	return count;
+}
+
+/// Call emit with every value found within all sorted ranges
+/**
+ * Selects the SIMD block kernel for two similar length contiguous
+ * 32-bit integer ranges and the galloping engine otherwise.
+ */
+template<typename Emit, typename... SortedType>
+void sorted_intersection(Emit& emit, const SortedType& ...args) {
+	if constexpr ( sizeof...(SortedType) == 2 ) {
+		const auto& [a, b] = std::forward_as_tuple(args...);
+		if constexpr ( intersection_simd_capable<std::remove_cvref_t<decltype(a)>, std::remove_cvref_t<decltype(b)>>() ) {
+			const auto na = static_cast<std::size_t>(std::ranges::size(a));
+			const auto nb = static_cast<std::size_t>(std::ranges::size(b));
+			if( (na < intersection_simd_max_ratio * nb) && (nb < intersection_simd_max_ratio * na) ){
+				const auto pa = std::ranges::data(a);
+				const auto pb = std::ranges::data(b);
+				simd_intersect_sorted(pa, pa + na, pb, pb + nb, emit);
+				return;
+			}
+		}
+	}
+	gallop_intersection(emit,
+			std::make_tuple( std::cbegin(args)... ),
+			std::make_tuple( std::cend(args)... ),
+			std::index_sequence_for<SortedType...>());
+}
+
+} /* namespace detail */
+} /* namespace xstd */
+/// @endcond
+
 
 namespace xstd {
 
@@ -19,46 +176,101 @@ namespace xstd {
  * same time. This is much faster than performing a chain of
  * std::set_intersection calls on the same containers.
  *
+ * Containers with random access iterators are advanced with a
+ * galloping search so the cost is governed by the shortest
+ * container when lengths are skewed. Two contiguous containers of
+ * the same 32-bit integer type with similar lengths are
+ * intersected with SIMD block compares when available.
+ *
  * \param out[inout] Output container to build intersected set within
  * \param args[in] Variable argument array of sorted containers
  *
  * \returns The new output container with intersection
  */
 template<typename Output, typename... SortedType>
+requires (std::ranges::input_range<const SortedType> && ...)
 Output Intersection(Output& out, const SortedType& ...args){
-    using std::max;
-
-	auto its = std::make_tuple( std::cbegin(args)... ); // tuple of begin() iterators
-	const auto ends  = std::make_tuple( std::cend(args)... );   // tuple of end() iterators
-
-	auto not_equal = [](const auto& a, const auto& b){return *a != *b;};
-	while( xstd::all_of(its, ends, not_equal) ) {
-
-	    // Get tuple of dereferenced values
-	    const auto value_tuple = xstd::transform(its, [](const auto& it){return *it;});
-
-	    // Get max value within current tuple
-	    const auto max_value = xstd::max(value_tuple);
-
-	    // Count how many values match the current max_value
-        const auto count = xstd::count_if(value_tuple, [max_value](const auto& val){return (val == max_value);});
-
-        // If all dereferenced iterators equal the same then we have an intersection
-        if( count == std::tuple_size_v<decltype(its)> ){
-            out.insert(std::cend(out), max_value);
-            xstd::for_each(its, [](auto& it){++it;});
-        }
-        else { // No intersection so increment all iterators less than max
-            xstd::for_each(its, [max_value](auto& it){
-                if( *it < max_value ){
-                    ++it;
-                }
-            });
-        }
-	}
+	STATIC_ASSERT(sizeof...(SortedType) > 0, "Intersection requires at least one container");
+
+	auto emit = [&out](const auto& value){
+		out.insert(std::cend(out), value);
+	};
+
+	detail::sorted_intersection(emit, args...);
 	return out;
 }
 
+/// Set Intersection of a runtime number of sorted ranges
+/**
+ * Writes the values found within every range of lists to the
+ * buffer starting at d_first and returns the number written. The
+ * ranges are visited smallest first and the search stops as soon
+ * as any range is exhausted or max_count values were written.
+ * No memory is allocated for up to 64 ranges. An empty list of
+ * ranges has an empty intersection.
+ *
+ * Each range must be sorted in ascending order without duplicate
+ * values.
+ *
+ * \code
+ * std::vector<std::span<const std::uint32_t>> postings = ...;
+ * std::vector<std::uint32_t> hits(100);
+ * auto n = xstd::Intersection(std::span(postings), hits.begin(), hits.size());
+ * \endcode
+ *
+ * \param lists[in] Sorted ranges to intersect
+ * \param d_first[out] Start of output buffer
+ * \param max_count[in] Maximum number of values to write
+ *
+ * \returns Number of values written to d_first
+ */
+template<typename Range, std::size_t Extent, typename OutputIt>
+requires std::ranges::forward_range<const Range>
+std::size_t Intersection(std::span<Range, Extent> lists, OutputIt d_first, const std::size_t max_count = std::numeric_limits<std::size_t>::max()){
+	using iterator = std::ranges::iterator_t<const Range>;
+	using cursor   = detail::intersection_cursor<iterator>;
+
+	const auto k = lists.size();
+	if( (k == 0) || (max_count == 0) ){
+		return 0;
+	}
+
+	std::array<cursor, detail::intersection_stack_cursors> stack_cursors;
+	std::vector<cursor> heap_cursors;
+	cursor* cursors = stack_cursors.data();
+	if( k > stack_cursors.size() ){
+		heap_cursors.resize(k);
+		cursors = heap_cursors.data();
+	}
+
+	for(std::size_t i = 0; i < k; ++i){
+		const auto& list = lists[i];
+		const auto  size = static_cast<std::size_t>(std::ranges::distance(list));
+		if( size == 0 ){
+			return 0;
+		}
+		cursors[i] = cursor{std::ranges::begin(list), std::ranges::end(list), size};
+	}
+	std::sort(cursors, cursors + k, [](const cursor& a, const cursor& b){
+		return a.size < b.size;
+	});
+
+	return detail::cursor_intersection(cursors, k, d_first, max_count);
+}
+
+/// Set Intersection of a runtime number of sorted ranges
+/**
+ * \param lists[in] Sorted ranges to intersect
+ * \param d_first[out] Start of output buffer
+ * \param max_count[in] Maximum number of values to write
+ *
+ * \returns Number of values written to d_first
+ */
+template<typename Range, typename Allocator, typename OutputIt>
+requires std::ranges::forward_range<const Range>
+std::size_t Intersection(const std::vector<Range, Allocator>& lists, OutputIt d_first, const std::size_t max_count = std::numeric_limits<std::size_t>::max()){
+	return Intersection(std::span<const Range>(lists), d_first, max_count);
+}
 
 } /* namespace xstd */
 
@@ -0,0 +1,191 @@
+/**
+ * \file       intersection_count.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_SET_INTERSECTION_COUNT_HPP_
+#define INCLUDE_XSTD_DETAIL_SET_INTERSECTION_COUNT_HPP_
+
+
+#include "xstd/assert.hpp"
+#include "xstd/detail/set/intersection.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * intersection_count.hpp
+ *
+ * \brief
+ * Size of the intersection of sorted containers
+ *
+ * \details
+ * Counts the values common to several sorted containers without
+ * writing them anywhere. Dense integer sets whose values span a
+ * short interval are counted with bitmaps, one bit per value
+ * within the overlap of the containers, combined with a word wise
+ * AND and a popcount. Other inputs use the same galloping and SIMD
+ * engines as xstd::Intersection.
+ */
+
+/// @cond SKIP_DETAIL
+namespace xstd {
+namespace detail {
+
+/// Bitmap used if span of values is below this times the smallest length
+constexpr std::size_t intersection_bitmap_density = 16;
+
+/// True if all ranges are random access integer ranges
+template<typename... SortedType>
+constexpr bool intersection_bitmap_capable() {
+	if constexpr ( (sizeof...(SortedType) > 1) && (std::ranges::random_access_range<const SortedType> && ...) ) {
+		using value_type = std::common_type_t<std::ranges::range_value_t<const SortedType>...>;
+		return std::is_integral<value_type>::value && (not std::is_same<value_type, bool>::value);
+	}
+	return false;
+}
+
+/// Offset of value from lo as an unsigned bit index
+template<typename T>
+std::uint64_t bitmap_offset(const T& value, const T& lo) noexcept {
+	using unsigned_type = std::make_unsigned_t<T>;
+	return static_cast<std::uint64_t>(static_cast<unsigned_type>(static_cast<unsigned_type>(value) - static_cast<unsigned_type>(lo)));
+}
+
+/// Count common values with bitmaps of the window [lo,hi]
+template<typename T, typename... SortedType, std::size_t... I>
+std::size_t bitmap_intersection_count(const T lo, const T hi, std::index_sequence<I...>, const SortedType& ...args) {
+	constexpr std::size_t k = sizeof...(SortedType);
+	const auto num_words = static_cast<std::size_t>(bitmap_offset(hi, lo) / 64 + 1);
+
+	std::vector<std::uint64_t> bits(num_words, 0);
+	std::vector<std::uint64_t> other;
+	std::size_t count = 0;
+
+	auto visit = [&](auto index, const auto& range){
+		const auto first = std::lower_bound(std::ranges::begin(range), std::ranges::end(range), lo);
+		const auto last  = std::upper_bound(first, std::ranges::end(range), hi);
+		if constexpr ( decltype(index)::value == 0 ) {
+			for(auto it = first; it != last; ++it){
+				const auto offset = bitmap_offset(static_cast<T>(*it), lo);
+				bits[offset / 64] |= std::uint64_t(1) << (offset % 64);
+			}
+		}
+		else if constexpr ( decltype(index)::value + 1 < k ) {
+			other.assign(num_words, 0);
+			for(auto it = first; it != last; ++it){
+				const auto offset = bitmap_offset(static_cast<T>(*it), lo);
+				other[offset / 64] |= std::uint64_t(1) << (offset % 64);
+			}
+			for(std::size_t w = 0; w < num_words; ++w){
+				bits[w] &= other[w];
+			}
+		}
+		else {
+			for(auto it = first; it != last; ++it){
+				const auto offset = bitmap_offset(static_cast<T>(*it), lo);
+				count += static_cast<std::size_t>((bits[offset / 64] >> (offset % 64)) & 1);
+			}
+		}
+	};
+	(visit(std::integral_constant<std::size_t, I>(), args), ...);
+	return count;
+}
+
+} /* namespace detail */
+} /* namespace xstd */
+/// @endcond
+
+
+namespace xstd {
+
+/// Number of values found within every sorted container
+/**
+ * Returns the size of the set intersection of the containers
+ * without building it. Each container must be sorted in
+ * ascending order without duplicate values.
+ *
+ * Random access containers of integers whose common values span an
+ * interval shorter than 16 times the smallest container length are
+ * counted with bitmaps. Other inputs are counted with the galloping
+ * and SIMD engines used by xstd::Intersection.
+ *
+ * \code
+ * auto n = xstd::intersection_count(docs_a, docs_b, docs_c);
+ * \endcode
+ *
+ * \param args[in] Variable argument array of sorted containers
+ *
+ * \returns Number of values within every container
+ */
+template<typename... SortedType>
+requires (std::ranges::input_range<const SortedType> && ...)
+std::size_t intersection_count(const SortedType& ...args){
+	STATIC_ASSERT(sizeof...(SortedType) > 0, "intersection_count requires at least one container");
+
+	if constexpr ( detail::intersection_bitmap_capable<SortedType...>() ) {
+		using value_type = std::common_type_t<std::ranges::range_value_t<const SortedType>...>;
+		if( ((std::ranges::empty(args)) || ...) ){
+			return 0;
+		}
+
+		// Window of values which can be common to all
+		const value_type lo = std::max({static_cast<value_type>(*std::ranges::begin(args))...});
+		const value_type hi = std::min({static_cast<value_type>(*std::ranges::rbegin(args))...});
+		if( hi < lo ){
+			return 0;
+		}
+		const auto min_size = std::min({static_cast<std::size_t>(std::ranges::size(args))...});
+		const auto span     = detail::bitmap_offset(hi, lo);
+		if( span / detail::intersection_bitmap_density < min_size ){
+			return detail::bitmap_intersection_count(lo, hi, std::index_sequence_for<SortedType...>(), args...);
+		}
+	}
+
+	std::size_t count = 0;
+	auto emit = [&count](const auto&){
+		++count;
+	};
+	detail::sorted_intersection(emit, args...);
+	return count;
+}
+
+/// Jaccard similarity of two sorted containers
+/**
+ * Returns |A ∩ B| / |A ∪ B| computed exactly from the
+ * intersection count. Two empty containers are identical and
+ * have a similarity of 1. Each container must be sorted in
+ * ascending order without duplicate values. See xstd::minhash for
+ * an estimate from small signatures.
+ *
+ * \param a[in] First sorted container
+ * \param b[in] Second sorted container
+ *
+ * \returns Jaccard index within [0,1]
+ */
+template<typename SortedA, typename SortedB>
+requires std::ranges::forward_range<const SortedA> && std::ranges::forward_range<const SortedB>
+double jaccard_index(const SortedA& a, const SortedB& b){
+	const auto common = intersection_count(a, b);
+	const auto na     = static_cast<std::size_t>(std::ranges::distance(a));
+	const auto nb     = static_cast<std::size_t>(std::ranges::distance(b));
+	const auto total  = na + nb - common;
+	if( total == 0 ){
+		return 1.0;
+	}
+	return static_cast<double>(common) / static_cast<double>(total);
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_SET_INTERSECTION_COUNT_HPP_ */
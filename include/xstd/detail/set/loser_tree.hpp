@@ -0,0 +1,197 @@
+/**
+ * \file       loser_tree.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_SET_LOSER_TREE_HPP_
+#define INCLUDE_XSTD_DETAIL_SET_LOSER_TREE_HPP_
+
+
+#include "xstd/assert.hpp"
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+
+namespace xstd {
+
+/// Tournament tree selecting the smallest head of N sorted sources
+/**
+ * Each of the N sources offers its current value. The tree keeps
+ * the loser of every match within the internal nodes so replacing
+ * the winning value only replays the matches along the path from
+ * its leaf to the root, costing ceil(log2(N)) comparisons per
+ * value merged. A source which is exhausted is closed and loses
+ * every match. Ties are won by the lowest source index which keeps
+ * a merge stable.
+ *
+ * Usage:
+ * \code{.cpp}
+ * xstd::loser_tree<int,3> tree;
+ * tree.set(0, a[0]); tree.set(1, b[0]); tree.close(2);
+ * tree.build();
+ * while( not tree.empty() ){
+ *     auto s = tree.top_source();
+ *     use(tree.top());
+ *     if( more(s) ) tree.replace_top(next(s)); else tree.pop_top();
+ * }
+ * \endcode
+ *
+ * \tparam T Type of value held for each source
+ * \tparam N Number of sources
+ * \tparam Compare Comparison returning true if first argument is less than second
+ */
+template<typename T, std::size_t N, typename Compare = std::less<T>>
+class loser_tree final {
+	STATIC_ASSERT(N > 0, "Loser tree requires at least one source");
+
+public:
+
+	// ====================================================
+	// Types
+	// ====================================================
+
+	using value_type = T;
+	using size_type  = std::size_t;
+
+	// ====================================================
+	// Constructors
+	// ====================================================
+
+	explicit loser_tree(const Compare& comp = Compare()) : comp_(comp) {
+		active_.fill(false);
+		tree_.fill(0);
+	}
+
+	// ====================================================
+	// Initialization
+	// ====================================================
+
+	/** Set the current value of a source
+	 *
+	 * Must be followed by a call to build before querying.
+	 */
+	void set(const size_type source, const value_type& value) {
+		ASSERT( source < N );
+		values_[source] = value;
+		active_[source] = true;
+	}
+
+	/** Mark a source as exhausted
+	 *
+	 * Must be followed by a call to build before querying.
+	 */
+	void close(const size_type source) noexcept {
+		ASSERT( source < N );
+		active_[source] = false;
+	}
+
+	/** Play every match to find the first winner
+	 */
+	void build() {
+		tree_[0] = this->build_(1);
+	}
+
+	// ====================================================
+	// Query
+	// ====================================================
+
+	/** True once every source is exhausted
+	 */
+	bool empty() const noexcept {
+		return not active_[tree_[0]];
+	}
+
+	/** Source holding the smallest value
+	 */
+	size_type top_source() const noexcept {
+		return tree_[0];
+	}
+
+	/** Smallest value of all sources
+	 */
+	const value_type& top() const noexcept {
+		ASSERT( not this->empty() );
+		return values_[tree_[0]];
+	}
+
+	// ====================================================
+	// Modification
+	// ====================================================
+
+	/** Replace the smallest value with the next of its source
+	 */
+	void replace_top(const value_type& value) {
+		ASSERT( not this->empty() );
+		values_[tree_[0]] = value;
+		this->replay_(tree_[0]);
+	}
+
+	/** Close the source holding the smallest value
+	 */
+	void pop_top() {
+		ASSERT( not this->empty() );
+		active_[tree_[0]] = false;
+		this->replay_(tree_[0]);
+	}
+
+
+	// ====================================================
+	// PRIVATE
+	// ====================================================
+
+private:
+	std::array<value_type, N> values_;
+	std::array<bool, N>       active_;
+	std::array<size_type, N>  tree_;   // [0] = winner, [1,N) = losers
+	Compare                   comp_;
+
+	bool beats_(const size_type a, const size_type b) const {
+		if( active_[a] != active_[b] ){
+			return active_[a];
+		}
+		if( not active_[a] ){
+			return a < b;
+		}
+		if( comp_(values_[a], values_[b]) ){
+			return true;
+		}
+		if( comp_(values_[b], values_[a]) ){
+			return false;
+		}
+		return a < b;
+	}
+
+	// Leaf of source s is node N + s
+	size_type build_(const size_type node) {
+		if( node >= N ){
+			return node - N;
+		}
+		const auto left  = this->build_(2 * node);
+		const auto right = this->build_(2 * node + 1);
+		if( this->beats_(left, right) ){
+			tree_[node] = right;
+			return left;
+		}
+		tree_[node] = left;
+		return right;
+	}
+
+	void replay_(size_type winner) {
+		for(size_type node = (N + winner) / 2; node > 0; node /= 2){
+			if( this->beats_(tree_[node], winner) ){
+				std::swap(tree_[node], winner);
+			}
+		}
+		tree_[0] = winner;
+	}
+
+};
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_SET_LOSER_TREE_HPP_ */
@@ -0,0 +1,209 @@
+/**
+ * \file       simd_intersection.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_SET_SIMD_INTERSECTION_HPP_
+#define INCLUDE_XSTD_DETAIL_SET_SIMD_INTERSECTION_HPP_
+
+
+#include "xstd/assert.hpp"
+#include "xstd/detail/config/simd.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <type_traits>
+
+#if defined(XSTD_HAS_SSE2)
+#include <immintrin.h>
+#endif
+
+/**
+ * \file
+ * simd_intersection.hpp
+ *
+ * \brief
+ * Block intersection kernels for sorted 32-bit integer arrays
+ *
+ * \details
+ * Compares a block of W values from each array against all W
+ * rotations of the other block (an all-pairs compare in W
+ * instructions) and collects the matching lanes of the first block
+ * with a movemask. The block whose last value is smaller is then
+ * consumed and the other block advanced past the values it has
+ * already been compared against. Blocks containing a repeated
+ * value (or continuing a run from the value before them) are
+ * merged by the scalar kernel instead, so repeated values keep the
+ * min-count semantics of std::set_intersection. The widest kernel
+ * enabled at compile time is used with narrower kernels and a
+ * scalar merge finishing the remaining values.
+ */
+
+/// @cond SKIP_DETAIL
+namespace xstd {
+namespace detail {
+
+/// Lanes of the first block set within mask in ascending order
+template<typename T, typename Emit>
+inline void simd_emit_mask(const T* block, unsigned mask, Emit& emit) {
+	while( mask != 0 ){
+		emit(block[std::countr_zero(mask)]);
+		mask &= mask - 1;
+	}
+}
+
+/// True if the first block of W values holds equal neighbours
+template<std::size_t W, typename T>
+inline bool simd_first_block_repeats(const T* p) noexcept {
+	for(std::size_t i = 1; i < W; ++i){
+		if( p[i] == p[i - 1] ){
+			return true;
+		}
+	}
+	return false;
+}
+
+/// Scalar merge intersection until either range is exhausted
+template<typename T, typename Emit>
+void scalar_intersect_sorted(const T*& a, const T* a_last, const T*& b, const T* b_last, Emit& emit) {
+	while( (a != a_last) && (b != b_last) ){
+		if( *a < *b ){
+			++a;
+		}
+		else if( *b < *a ){
+			++b;
+		}
+		else {
+			emit(*a);
+			++a;
+			++b;
+		}
+	}
+}
+
+/// Intersection of two sorted arrays of 32-bit integers
+/**
+ * Calls emit(value) for every value found in both [a,a_last) and
+ * [b,b_last) in ascending order. A value repeated in both arrays
+ * is emitted the smaller number of times.
+ */
+template<typename T, typename Emit>
+void simd_intersect_sorted(const T* a, const T* a_last, const T* b, const T* b_last, Emit emit) {
+	STATIC_ASSERT(std::is_integral<T>::value && (sizeof(T) == 4), "SIMD intersection requires 32-bit integers");
+
+#if defined(XSTD_HAS_SSE2)
+	// Bias taking unsigned values into signed compare order
+	constexpr int sign_bias = std::is_signed<T>::value ? 0 : static_cast<int>(0x80000000u);
+	const T* const a_first = a;
+	const T* const b_first = b;
+#endif
+
+#if defined(XSTD_HAS_AVX2)
+	{
+		const auto rotate = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+		const auto bias   = _mm256_set1_epi32(sign_bias);
+		auto repeats = [](const T* p, const T* first){
+			if( p == first ){
+				return simd_first_block_repeats<8>(p);
+			}
+			const auto prev = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p - 1));
+			const auto curr = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+			return _mm256_movemask_epi8(_mm256_cmpeq_epi32(prev, curr)) != 0;
+		};
+		// Number of lanes in v not greater than bound
+		auto count_not_greater = [&bias](__m256i v, const T bound){
+			const auto gt = _mm256_cmpgt_epi32(_mm256_xor_si256(v, bias), _mm256_xor_si256(_mm256_set1_epi32(static_cast<int>(bound)), bias));
+			return 8 - std::popcount(static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(gt))));
+		};
+		while( (a_last - a >= 8) && (b_last - b >= 8) ){
+			if( repeats(a, a_first) || repeats(b, b_first) ){
+				scalar_intersect_sorted(a, a + 8, b, b + 8, emit);
+				continue;
+			}
+			const auto va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a));
+			const auto vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b));
+			auto       rb = vb;
+			auto       eq = _mm256_cmpeq_epi32(va, rb);
+			for(int r = 1; r < 8; ++r){
+				rb = _mm256_permutevar8x32_epi32(rb, rotate);
+				eq = _mm256_or_si256(eq, _mm256_cmpeq_epi32(va, rb));
+			}
+			simd_emit_mask(a, static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(eq))), emit);
+
+			const T a_max = a[7];
+			const T b_max = b[7];
+			if( a_max < b_max ){
+				a += 8;
+				b += count_not_greater(vb, a_max);
+			}
+			else if( b_max < a_max ){
+				a += count_not_greater(va, b_max);
+				b += 8;
+			}
+			else {
+				a += 8;
+				b += 8;
+			}
+		}
+	}
+#endif
+
+#if defined(XSTD_HAS_SSE2)
+	{
+		const auto bias = _mm_set1_epi32(sign_bias);
+		auto repeats = [](const T* p, const T* first){
+			if( p == first ){
+				return simd_first_block_repeats<4>(p);
+			}
+			const auto prev = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p - 1));
+			const auto curr = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			return _mm_movemask_epi8(_mm_cmpeq_epi32(prev, curr)) != 0;
+		};
+		// Number of lanes in v not greater than bound
+		auto count_not_greater = [&bias](__m128i v, const T bound){
+			const auto gt = _mm_cmpgt_epi32(_mm_xor_si128(v, bias), _mm_xor_si128(_mm_set1_epi32(static_cast<int>(bound)), bias));
+			return 4 - std::popcount(static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(gt))));
+		};
+		while( (a_last - a >= 4) && (b_last - b >= 4) ){
+			if( repeats(a, a_first) || repeats(b, b_first) ){
+				scalar_intersect_sorted(a, a + 4, b, b + 4, emit);
+				continue;
+			}
+			const auto va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+			const auto vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+			const auto r1 = _mm_shuffle_epi32(vb, _MM_SHUFFLE(0,3,2,1));
+			const auto r2 = _mm_shuffle_epi32(vb, _MM_SHUFFLE(1,0,3,2));
+			const auto r3 = _mm_shuffle_epi32(vb, _MM_SHUFFLE(2,1,0,3));
+			const auto eq = _mm_or_si128(
+					_mm_or_si128(_mm_cmpeq_epi32(va, vb), _mm_cmpeq_epi32(va, r1)),
+					_mm_or_si128(_mm_cmpeq_epi32(va, r2), _mm_cmpeq_epi32(va, r3)));
+			simd_emit_mask(a, static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(eq))), emit);
+
+			const T a_max = a[3];
+			const T b_max = b[3];
+			if( a_max < b_max ){
+				a += 4;
+				b += count_not_greater(vb, a_max);
+			}
+			else if( b_max < a_max ){
+				a += count_not_greater(va, b_max);
+				b += 4;
+			}
+			else {
+				a += 4;
+				b += 4;
+			}
+		}
+	}
+#endif
+
+	scalar_intersect_sorted(a, a_last, b, b_last, emit);
+}
+
+} /* namespace detail */
+} /* namespace xstd */
+/// @endcond
+
+#endif /* INCLUDE_XSTD_DETAIL_SET_SIMD_INTERSECTION_HPP_ */
@@ -0,0 +1,79 @@
+/**
+ * \file       symmetric_difference.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_SET_SYMMETRIC_DIFFERENCE_HPP_
+#define INCLUDE_XSTD_DETAIL_SET_SYMMETRIC_DIFFERENCE_HPP_
+
+
+#include "xstd/assert.hpp"
+#include "xstd/detail/set/union.hpp"
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+
+
+namespace xstd {
+
+/// Set Symmetric Difference taking multiple sorted containers
+/**
+ * Writes each value found within an odd number of the containers
+ * which for two containers matches std::set_symmetric_difference.
+ * The containers are merged within a single pass using a
+ * tournament (loser) tree.
+ *
+ * With Unique set (default) repeated values within one container
+ * are counted once so the parity counts containers holding the
+ * value. Otherwise every copy is counted and each container must
+ * be free of duplicate values for the result to be a set
+ * symmetric difference.
+ *
+ * \code
+ * std::vector<int> out;
+ * xstd::SymmetricDifference(out, a, b, c);
+ * \endcode
+ *
+ * \tparam Unique Count each container holding a value once
+ *
+ * \param out[inout] Output container to build symmetric difference within
+ * \param args[in] Variable argument array of sorted containers
+ *
+ * \returns The new output container with symmetric difference
+ */
+template<bool Unique = true, typename Output, typename... SortedType>
+requires (std::ranges::input_range<const SortedType> && ...)
+Output SymmetricDifference(Output& out, const SortedType& ...args){
+	STATIC_ASSERT(sizeof...(SortedType) > 0, "SymmetricDifference requires at least one container");
+	using value_type = typename detail::sorted_merge<SortedType...>::value_type;
+
+	detail::sorted_merge<SortedType...> merge(args...);
+	while( not merge.empty() ){
+		const value_type value = merge.top();
+		std::array<bool, sizeof...(SortedType)> seen{};
+		std::size_t count = 0;
+		while( (not merge.empty()) && (not (value < merge.top())) ){
+			if constexpr ( Unique ) {
+				const auto source = merge.top_source();
+				count += static_cast<std::size_t>(not seen[source]);
+				seen[source] = true;
+			}
+			else {
+				++count;
+			}
+			merge.pop();
+		}
+		if( count % 2 == 1 ){
+			out.insert(std::cend(out), value);
+		}
+	}
+	return out;
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_SET_SYMMETRIC_DIFFERENCE_HPP_ */
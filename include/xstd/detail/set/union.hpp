@@ -0,0 +1,144 @@
+/**
+ * \file       union.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_SET_UNION_HPP_
+#define INCLUDE_XSTD_DETAIL_SET_UNION_HPP_
+
+
+#include "xstd/assert.hpp"
+#include "xstd/detail/set/loser_tree.hpp"
+#include "xstd/detail/tuple/algorithm.hpp"
+
+#include <iterator>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+/// @cond SKIP_DETAIL
+namespace xstd {
+namespace detail {
+
+/// Single pass merge of multiple sorted containers
+/**
+ * Holds a cursor into each container and a loser tree of their
+ * current values. Containers may be of different types.
+ */
+template<typename... SortedType>
+class sorted_merge final {
+
+public:
+	using value_type = std::common_type_t<std::ranges::range_value_t<const SortedType>...>;
+	using size_type  = std::size_t;
+
+	explicit sorted_merge(const SortedType& ...args) :
+		cursors_(std::make_pair(std::cbegin(args), std::cend(args))...) {
+		size_type source = 0;
+		xstd::for_each(cursors_, [&](const auto& cursor){
+			if( cursor.first == cursor.second ){
+				tree_.close(source);
+			}
+			else {
+				tree_.set(source, *cursor.first);
+			}
+			++source;
+		});
+		tree_.build();
+	}
+
+	bool empty() const noexcept {
+		return tree_.empty();
+	}
+
+	const value_type& top() const noexcept {
+		return tree_.top();
+	}
+
+	/** Index of the container holding the smallest value */
+	size_type top_source() const noexcept {
+		return tree_.top_source();
+	}
+
+	/** Advance the container holding the smallest value */
+	void pop() {
+		xstd::perform(cursors_, tree_.top_source(), [this](auto& cursor){
+			++cursor.first;
+			if( cursor.first == cursor.second ){
+				tree_.pop_top();
+			}
+			else {
+				tree_.replace_top(*cursor.first);
+			}
+		});
+	}
+
+private:
+	std::tuple<std::pair<std::ranges::iterator_t<const SortedType>, std::ranges::iterator_t<const SortedType>>...> cursors_;
+	loser_tree<value_type, sizeof...(SortedType)> tree_;
+};
+
+} /* namespace detail */
+} /* namespace xstd */
+/// @endcond
+
+
+namespace xstd {
+
+/// Set Union taking multiple sorted containers
+/**
+ * Merges multiple sorted containers within a single pass using a
+ * tournament (loser) tree so every value costs ceil(log2(k))
+ * comparisons for k containers. This is much faster than a chain
+ * of std::set_union calls which re-read the merged values for
+ * every container added.
+ *
+ * With Unique set (default) each distinct value is written once
+ * even if it appears within several containers or several times
+ * within one. Otherwise every value of every container is written
+ * (a stable k-way merge).
+ *
+ * \code
+ * std::vector<int> out;
+ * xstd::Union(out, shard_a, shard_b, shard_c);
+ * xstd::Union<false>(out, runs...);
+ * \endcode
+ *
+ * \tparam Unique Write each distinct value once
+ *
+ * \param out[inout] Output container to build union within
+ * \param args[in] Variable argument array of sorted containers
+ *
+ * \returns The new output container with union
+ */
+template<bool Unique = true, typename Output, typename... SortedType>
+requires (std::ranges::input_range<const SortedType> && ...)
+Output Union(Output& out, const SortedType& ...args){
+	STATIC_ASSERT(sizeof...(SortedType) > 0, "Union requires at least one container");
+	using value_type = typename detail::sorted_merge<SortedType...>::value_type;
+
+	detail::sorted_merge<SortedType...> merge(args...);
+	if( merge.empty() ){
+		return out;
+	}
+
+	value_type last = merge.top();
+	out.insert(std::cend(out), last);
+	merge.pop();
+	while( not merge.empty() ){
+		if( (not Unique) || (last < merge.top()) ){
+			last = merge.top();
+			out.insert(std::cend(out), last);
+		}
+		merge.pop();
+	}
+	return out;
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_SET_UNION_HPP_ */
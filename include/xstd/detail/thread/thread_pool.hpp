@@ -0,0 +1,211 @@
+/**
+ * \file       thread_pool.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_THREAD_THREAD_POOL_HPP_
+#define INCLUDE_XSTD_DETAIL_THREAD_THREAD_POOL_HPP_
+
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+namespace xstd {
+
+/// Fixed size pool of threads executing indexed tasks
+/**
+ * The pool creates its threads once at construction and reuses
+ * them for every call to parallel_for. The calling thread also
+ * executes tasks so a pool of size N creates N-1 threads.
+ * Each call to parallel_for blocks until all tasks completed
+ * which makes consecutive calls act as a barrier between phases
+ * of an algorithm.
+ *
+ * Usage:
+ * \code{.cpp}
+ * xstd::thread_pool pool(8);
+ * std::vector<double> partial(pool.size());
+ * pool.parallel_for(pool.size(), [&](std::size_t task){
+ *     partial[task] = work_on_chunk(task);
+ * });
+ * \endcode
+ *
+ * \note
+ * Tasks must not call parallel_for on the pool executing them.
+ */
+class thread_pool final {
+
+public:
+
+	// ====================================================
+	// Types
+	// ====================================================
+
+	using size_type = std::size_t;
+
+	// ====================================================
+	// Constructors
+	// ====================================================
+
+	thread_pool(const thread_pool& other)            = delete;
+	thread_pool(thread_pool&& other)                 = delete;
+	thread_pool& operator=(const thread_pool& other) = delete;
+	thread_pool& operator=(thread_pool&& other)      = delete;
+
+	/** Construct pool with number of threads
+	 *
+	 * A value of zero uses the hardware concurrency.
+	 */
+	explicit thread_pool(const size_type num_threads = 0) {
+		size_type count = num_threads;
+		if( count == 0 ){
+			count = std::max<size_type>(1, std::thread::hardware_concurrency());
+		}
+		workers_.reserve(count - 1);
+		for(size_type i = 1; i < count; ++i){
+			workers_.emplace_back([this](){ this->worker_loop_(); });
+		}
+	}
+
+	~thread_pool() {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stop_ = true;
+		}
+		start_cv_.notify_all();
+		for(auto& worker : workers_){
+			worker.join();
+		}
+	}
+
+	// ====================================================
+	// Query
+	// ====================================================
+
+	/** Number of threads executing tasks (including caller)
+	 */
+	size_type size() const noexcept {
+		return workers_.size() + 1;
+	}
+
+	// ====================================================
+	// Execution
+	// ====================================================
+
+	/** Execute f(i) for every i in [0,num_tasks)
+	 *
+	 * Tasks are handed out dynamically to the pool threads
+	 * and the calling thread. The call returns once every
+	 * task completed. The first exception thrown by a task
+	 * is rethrown to the caller after all threads stopped.
+	 *
+	 * \param num_tasks[in] Number of tasks to execute
+	 * \param f[in] Function called with each task index
+	 */
+	template<typename Function>
+	void parallel_for(const size_type num_tasks, Function&& f) {
+		if( num_tasks == 0 ){
+			return;
+		}
+		if( workers_.empty() || (num_tasks == 1) ){
+			for(size_type i = 0; i < num_tasks; ++i){
+				f(i);
+			}
+			return;
+		}
+
+		std::lock_guard<std::mutex> submit_lock(submit_mutex_);
+		using function_type = std::remove_reference_t<Function>;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			context_   = const_cast<void*>(static_cast<const void*>(std::addressof(f)));
+			invoke_    = [](void* context, size_type i){ (*static_cast<function_type*>(context))(i); };
+			num_tasks_ = num_tasks;
+			next_task_.store(0, std::memory_order_relaxed);
+			pending_   = workers_.size();
+			error_     = nullptr;
+			++generation_;
+		}
+		start_cv_.notify_all();
+
+		this->run_tasks_();
+
+		std::unique_lock<std::mutex> lock(mutex_);
+		done_cv_.wait(lock, [this](){ return pending_ == 0; });
+		if( error_ ){
+			std::rethrow_exception(error_);
+		}
+	}
+
+
+	// ====================================================
+	// PRIVATE
+	// ====================================================
+
+private:
+	std::vector<std::thread> workers_;
+	std::mutex               submit_mutex_;
+	std::mutex               mutex_;
+	std::condition_variable  start_cv_;
+	std::condition_variable  done_cv_;
+	std::atomic<size_type>   next_task_ = 0;
+	void*                    context_   = nullptr;
+	void                   (*invoke_)(void*, size_type) = nullptr;
+	size_type                num_tasks_  = 0;
+	size_type                pending_    = 0;
+	size_type                generation_ = 0;
+	std::exception_ptr       error_;
+	bool                     stop_       = false;
+
+
+	void run_tasks_() {
+		size_type i;
+		while( (i = next_task_.fetch_add(1, std::memory_order_relaxed)) < num_tasks_ ){
+			try {
+				invoke_(context_, i);
+			}
+			catch(...) {
+				std::lock_guard<std::mutex> lock(mutex_);
+				if( not error_ ){
+					error_ = std::current_exception();
+				}
+			}
+		}
+	}
+
+	void worker_loop_() {
+		size_type seen = 0;
+		std::unique_lock<std::mutex> lock(mutex_);
+		while( true ){
+			start_cv_.wait(lock, [&](){ return stop_ || (generation_ != seen); });
+			if( stop_ ){
+				return;
+			}
+			seen = generation_;
+			lock.unlock();
+			this->run_tasks_();
+			lock.lock();
+			if( --pending_ == 0 ){
+				done_cv_.notify_one();
+			}
+		}
+	}
+
+};
+
+
+} /* namespace xstd */
+
+
+#endif /* INCLUDE_XSTD_DETAIL_THREAD_THREAD_POOL_HPP_ */
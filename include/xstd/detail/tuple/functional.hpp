@@ -10,8 +10,11 @@
 
 
 #include <algorithm> // std::min, std::max, etc.
+#include <array>
 #include <cstddef>   // std::size_t
 #include <tuple>     // std::tuple, etc.
+#include <type_traits>
+#include <utility>
 
 
 /**
@@ -35,6 +38,20 @@
 namespace xstd {
 namespace detail {
 
+template <typename T>
+struct is_std_array : std::false_type {};
+
+template <typename T, std::size_t N>
+struct is_std_array<std::array<T,N>> : std::true_type {};
+
+/// Operators only apply to tuple-like types (std::tuple, std::pair,
+/// ...) so other types within the xstd namespace (iterators,
+/// proxies, ...) are not captured. std::array is left to array_math.
+template <typename T>
+concept tuple_operand =
+		requires { std::tuple_size<std::remove_cvref_t<T>>::value; } &&
+		(not is_std_array<std::remove_cvref_t<T>>::value);
+
 template <typename Tuple1, typename Tuple2>
 struct minimum_tuple_size {
 	static constexpr std::size_t value = std::min(
@@ -102,6 +119,7 @@ namespace xstd {
  * \return Tuple = t1 + t2
  */
 template <typename Tuple1, typename Tuple2>
+requires (::xstd::detail::tuple_operand<Tuple1> && ::xstd::detail::tuple_operand<Tuple2>)
 constexpr auto
 operator+(Tuple1&& t1, Tuple2&& t2) {
 	constexpr auto min_size = ::xstd::detail::minimum_tuple_size_v<Tuple1,Tuple2>;
@@ -124,6 +142,7 @@ operator+(Tuple1&& t1, Tuple2&& t2) {
  * \return Tuple = t1 - t2
  */
 template <typename Tuple1, typename Tuple2>
+requires (::xstd::detail::tuple_operand<Tuple1> && ::xstd::detail::tuple_operand<Tuple2>)
 constexpr auto
 operator-(Tuple1&& t1, Tuple2&& t2) {
 	constexpr auto min_size = ::xstd::detail::minimum_tuple_size_v<Tuple1,Tuple2>;
@@ -146,6 +165,7 @@ operator-(Tuple1&& t1, Tuple2&& t2) {
  * \return Tuple = t1 * t2
  */
 template <typename Tuple1, typename Tuple2>
+requires (::xstd::detail::tuple_operand<Tuple1> && ::xstd::detail::tuple_operand<Tuple2>)
 constexpr auto
 operator*(Tuple1&& t1, Tuple2&& t2) {
 	constexpr auto min_size = ::xstd::detail::minimum_tuple_size_v<Tuple1,Tuple2>;
@@ -168,6 +188,7 @@ operator*(Tuple1&& t1, Tuple2&& t2) {
  * \return Tuple = t1 / t2
  */
 template <typename Tuple1, typename Tuple2>
+requires (::xstd::detail::tuple_operand<Tuple1> && ::xstd::detail::tuple_operand<Tuple2>)
 constexpr auto
 operator/(Tuple1&& t1, Tuple2&& t2) {
 	constexpr auto min_size = ::xstd::detail::minimum_tuple_size_v<Tuple1,Tuple2>;
@@ -190,6 +211,7 @@ operator/(Tuple1&& t1, Tuple2&& t2) {
  * \return Tuple = t1 % t2
  */
 template <typename Tuple1, typename Tuple2>
+requires (::xstd::detail::tuple_operand<Tuple1> && ::xstd::detail::tuple_operand<Tuple2>)
 constexpr auto
 operator%(Tuple1&& t1, Tuple2&& t2) {
 	constexpr auto min_size = ::xstd::detail::minimum_tuple_size_v<Tuple1,Tuple2>;
@@ -210,6 +232,7 @@ operator%(Tuple1&& t1, Tuple2&& t2) {
  * \return Tuple = -t1
  */
 template <typename Tuple1>
+requires ::xstd::detail::tuple_operand<Tuple1>
 constexpr auto
 operator-(Tuple1&& t1){
 	constexpr auto size = std::tuple_size_v<std::remove_reference_t<Tuple1>>;
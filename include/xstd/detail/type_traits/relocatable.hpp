@@ -0,0 +1,113 @@
+/*
+ * relocatable.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+#ifndef INCLUDE_XSTD_TYPE_TRAITS_RELOCATABLE_HPP_
+#define INCLUDE_XSTD_TYPE_TRAITS_RELOCATABLE_HPP_
+
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+
+namespace xstd {
+
+
+/// Detect if a type can be relocated with memcpy
+/**
+ * Relocation moves an object to new storage and ends the life of
+ * the original. A type is trivially relocatable when doing so is
+ * equivalent to copying its bytes and never running the destructor
+ * of the original. Containers use the trait to shift and swap
+ * elements with a single memmove/memcpy.
+ *
+ * Every trivially copyable type is trivially relocatable. Other
+ * types opt-in by specialization when they do not store a pointer
+ * into themselves and are not registered by address elsewhere.
+ *
+ * \code
+ * struct Node {
+ *     std::unique_ptr<int> value;
+ * };
+ *
+ * template<>
+ * struct xstd::is_trivially_relocatable<Node> : std::true_type {};
+ * \endcode
+ */
+template<typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template<typename T, std::size_t N>
+struct is_trivially_relocatable<std::array<T,N>> : is_trivially_relocatable<T> {};
+
+template<typename T, typename U>
+struct is_trivially_relocatable<std::pair<T,U>>
+	: std::bool_constant<is_trivially_relocatable<T>::value && is_trivially_relocatable<U>::value> {};
+
+template<typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+
+/// Relocate [first,last) into uninitialized storage at dest
+/**
+ * The source elements are left destroyed. Unlike std::uninitialized_move
+ * the ranges may overlap in either direction which allows shifting
+ * elements within a single buffer.
+ *
+ * \returns Iterator past the last relocated element
+ */
+template<typename T>
+T* uninitialized_relocate(T* first, T* last, T* dest) {
+	const auto n = static_cast<std::size_t>(last - first);
+	if constexpr ( is_trivially_relocatable_v<T> ) {
+		if( n > 0 ){
+			std::memmove(static_cast<void*>(dest), static_cast<const void*>(first), n * sizeof(T));
+		}
+	}
+	else {
+		if( dest < first ){
+			for(std::size_t i = 0; i < n; ++i){
+				std::construct_at(dest + i, std::move(first[i]));
+				std::destroy_at(first + i);
+			}
+		}
+		else if( dest > first ){
+			for(std::size_t i = n; i-- > 0;){
+				std::construct_at(dest + i, std::move(first[i]));
+				std::destroy_at(first + i);
+			}
+		}
+	}
+	return dest + n;
+}
+
+/// Swap the bytes of n trivially relocatable elements
+template<typename T>
+void swap_relocatable(T* a, T* b, const std::size_t n) noexcept {
+	static_assert(is_trivially_relocatable_v<T>, "Type must be trivially relocatable");
+	constexpr std::size_t chunk = 256;
+	unsigned char buffer[chunk];
+	auto pa = reinterpret_cast<unsigned char*>(a);
+	auto pb = reinterpret_cast<unsigned char*>(b);
+	for(std::size_t bytes = n * sizeof(T); bytes > 0;){
+		const auto count = std::min(bytes, chunk);
+		std::memcpy(buffer, pa, count);
+		std::memcpy(pa, pb, count);
+		std::memcpy(pb, buffer, count);
+		pa    += count;
+		pb    += count;
+		bytes -= count;
+	}
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_TYPE_TRAITS_RELOCATABLE_HPP_ */
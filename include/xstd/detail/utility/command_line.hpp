@@ -8,7 +8,8 @@
 #ifndef SRC_XSTD_COMMAND_LINE_HPP_
 #define SRC_XSTD_COMMAND_LINE_HPP_
 
-#include <map>
+#include "xstd/detail/set/flat_map.hpp"
+
 #include <string>
 
 namespace xstd {
@@ -50,7 +51,7 @@ namespace xstd {
 class CommandLine final {
 
 private:
-	using key_value_type = std::map<std::string,std::string>;
+	using key_value_type = flat_map<std::string,std::string>;
 
 public:
 
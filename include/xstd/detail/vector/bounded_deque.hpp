@@ -0,0 +1,391 @@
+/**
+ * \file       bounded_deque.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_VECTOR_BOUNDED_DEQUE_HPP_
+#define INCLUDE_XSTD_DETAIL_VECTOR_BOUNDED_DEQUE_HPP_
+
+
+#include "xstd/assert.hpp"
+#include "xstd/detail/vector/bounded_ring.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * \file
+ * bounded_deque.hpp
+ *
+ * \brief
+ * Fixed capacity double ended queue that models std::deque
+ *
+ * \details
+ * Stores up to N elements within a bounded_ring so all data is
+ * inside the object and nothing is allocated. The ring storage is
+ * rounded up to the next power of two which keeps indexing to a
+ * single mask while the capacity visible to the user remains N.
+ * Insertion and removal in the middle shift the elements of the
+ * nearer end like std::deque.
+ */
+
+namespace xstd {
+
+/// Stack allocated deque that models std::deque
+/**
+ * \tparam T Type held within deque
+ * \tparam N Maximum size at compile time
+ */
+template<typename T, std::size_t N>
+class bounded_deque final {
+	static_assert(N > 0, "Must have a capacity of at least one");
+
+	using ring_type = bounded_ring<T,std::bit_ceil(N)>;
+
+public:
+
+	// ====================================================
+	// Types
+	// ====================================================
+
+	using value_type             = T;
+	using size_type              = std::size_t;
+	using difference_type        = std::ptrdiff_t;
+	using reference              = value_type&;
+	using const_reference        = const value_type&;
+	using pointer                = value_type*;
+	using const_pointer          = const value_type*;
+	using iterator               = typename ring_type::iterator;
+	using const_iterator         = typename ring_type::const_iterator;
+	using reverse_iterator       = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	// ====================================================
+	// Constructors
+	// ====================================================
+
+	bounded_deque() noexcept = default;
+
+	bounded_deque(const size_type count, const T& value) {
+		this->assign(count, value);
+	}
+
+	explicit bounded_deque(const size_type count) {
+		this->resize(count);
+	}
+
+	template<std::input_iterator InputIt>
+	bounded_deque(InputIt first, InputIt last) {
+		this->assign(first, last);
+	}
+
+	bounded_deque(std::initializer_list<T> init) {
+		this->assign(init.begin(), init.end());
+	}
+
+	bounded_deque(const bounded_deque& other) = default;
+	bounded_deque(bounded_deque&& other) = default;
+	bounded_deque& operator=(const bounded_deque& other) = default;
+	bounded_deque& operator=(bounded_deque&& other) = default;
+	~bounded_deque() = default;
+
+	bounded_deque& operator=(std::initializer_list<T> ilist) {
+		this->assign(ilist.begin(), ilist.end());
+		return *this;
+	}
+
+	void assign(const size_type count, const T& value) {
+		ASSERT(count <= N);
+		const T copy(value); // value may be an element
+		ring_.clear();
+		for(size_type i = 0; i < count; ++i){
+			ring_.push_back(copy);
+		}
+	}
+
+	template<std::input_iterator InputIt>
+	void assign(InputIt first, InputIt last) {
+		ring_.clear();
+		for(; first != last; ++first){
+			this->emplace_back(*first);
+		}
+	}
+
+	void assign(std::initializer_list<T> ilist) {
+		this->assign(ilist.begin(), ilist.end());
+	}
+
+	// ====================================================
+	// Element Access
+	// ====================================================
+
+	reference at(const size_type pos) {
+		if( pos >= this->size() ){
+			throw std::out_of_range("bounded_deque::at");
+		}
+		return ring_[pos];
+	}
+
+	const_reference at(const size_type pos) const {
+		if( pos >= this->size() ){
+			throw std::out_of_range("bounded_deque::at");
+		}
+		return ring_[pos];
+	}
+
+	reference operator[](const size_type pos) noexcept {
+		return ring_[pos];
+	}
+
+	const_reference operator[](const size_type pos) const noexcept {
+		return ring_[pos];
+	}
+
+	reference front() noexcept { return ring_.front(); }
+	const_reference front() const noexcept { return ring_.front(); }
+	reference back() noexcept { return ring_.back(); }
+	const_reference back() const noexcept { return ring_.back(); }
+
+	/// Elements as two contiguous ranges in order
+	auto spans() noexcept { return ring_.spans(); }
+	auto spans() const noexcept { return ring_.spans(); }
+
+	// ====================================================
+	// Iterators
+	// ====================================================
+
+	iterator begin() noexcept { return ring_.begin(); }
+	iterator end() noexcept { return ring_.end(); }
+	const_iterator begin() const noexcept { return ring_.begin(); }
+	const_iterator end() const noexcept { return ring_.end(); }
+	const_iterator cbegin() const noexcept { return ring_.cbegin(); }
+	const_iterator cend() const noexcept { return ring_.cend(); }
+
+	reverse_iterator rbegin() noexcept { return reverse_iterator(this->end()); }
+	reverse_iterator rend() noexcept { return reverse_iterator(this->begin()); }
+	const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(this->end()); }
+	const_reverse_iterator rend() const noexcept { return const_reverse_iterator(this->begin()); }
+	const_reverse_iterator crbegin() const noexcept { return this->rbegin(); }
+	const_reverse_iterator crend() const noexcept { return this->rend(); }
+
+	// ====================================================
+	// Capacity
+	// ====================================================
+
+	[[nodiscard]] bool empty() const noexcept {
+		return ring_.empty();
+	}
+
+	bool full() const noexcept {
+		return ring_.size() == N;
+	}
+
+	size_type size() const noexcept {
+		return ring_.size();
+	}
+
+	static constexpr size_type max_size() noexcept {
+		return N;
+	}
+
+	static constexpr size_type capacity() noexcept {
+		return N;
+	}
+
+	void shrink_to_fit() noexcept {
+	}
+
+	// ====================================================
+	// Modifiers
+	// ====================================================
+
+	void clear() noexcept {
+		ring_.clear();
+	}
+
+	iterator insert(const_iterator pos, const T& value) {
+		return this->emplace(pos, value);
+	}
+
+	iterator insert(const_iterator pos, T&& value) {
+		return this->emplace(pos, std::move(value));
+	}
+
+	iterator insert(const_iterator pos, const size_type count, const T& value) {
+		ASSERT((this->size() + count) <= N);
+		const auto index = pos - this->cbegin();
+		const T copy(value); // value may be an element
+		for(size_type i = 0; i < count; ++i){
+			ring_.push_back(copy);
+		}
+		std::rotate(this->begin() + index, this->end() - count, this->end());
+		return this->begin() + index;
+	}
+
+	template<std::input_iterator InputIt>
+	iterator insert(const_iterator pos, InputIt first, InputIt last) {
+		const auto index = pos - this->cbegin();
+		const auto old_size = this->size();
+		for(; first != last; ++first){
+			this->emplace_back(*first);
+		}
+		std::rotate(this->begin() + index, this->begin() + old_size, this->end());
+		return this->begin() + index;
+	}
+
+	iterator insert(const_iterator pos, std::initializer_list<T> ilist) {
+		return this->insert(pos, ilist.begin(), ilist.end());
+	}
+
+	template<typename... Args>
+	iterator emplace(const_iterator pos, Args&&... args) {
+		ASSERT(not this->full());
+		ASSERT((pos >= this->cbegin()) && (pos <= this->cend()));
+		const auto index = pos - this->cbegin();
+
+		// Grow at the nearer end then move into position
+		if( static_cast<size_type>(index) < (this->size() / 2) ){
+			ring_.emplace_front(std::forward<Args>(args)...);
+			std::rotate(this->begin(), this->begin() + 1, this->begin() + index + 1);
+		}
+		else {
+			ring_.emplace_back(std::forward<Args>(args)...);
+			std::rotate(this->begin() + index, this->end() - 1, this->end());
+		}
+		return this->begin() + index;
+	}
+
+	iterator erase(const_iterator pos) {
+		ASSERT((pos >= this->cbegin()) && (pos < this->cend()));
+		return this->erase(pos, pos + 1);
+	}
+
+	iterator erase(const_iterator first, const_iterator last) {
+		ASSERT((first >= this->cbegin()) && (first <= last) && (last <= this->cend()));
+		const auto index = first - this->cbegin();
+		const auto count = static_cast<size_type>(last - first);
+		const auto after = static_cast<size_type>(this->cend() - last);
+
+		// Close the gap from the nearer end
+		if( static_cast<size_type>(index) < after ){
+			std::move_backward(this->begin(), this->begin() + index, this->begin() + index + count);
+			ring_.pop_front(count);
+		}
+		else {
+			std::move(this->begin() + index + count, this->end(), this->begin() + index);
+			ring_.pop_back(count);
+		}
+		return this->begin() + index;
+	}
+
+	void push_back(const T& value) {
+		this->emplace_back(value);
+	}
+
+	void push_back(T&& value) {
+		this->emplace_back(std::move(value));
+	}
+
+	template<typename... Args>
+	reference emplace_back(Args&&... args) {
+		ASSERT(not this->full());
+		return ring_.emplace_back(std::forward<Args>(args)...);
+	}
+
+	void push_front(const T& value) {
+		this->emplace_front(value);
+	}
+
+	void push_front(T&& value) {
+		this->emplace_front(std::move(value));
+	}
+
+	template<typename... Args>
+	reference emplace_front(Args&&... args) {
+		ASSERT(not this->full());
+		return ring_.emplace_front(std::forward<Args>(args)...);
+	}
+
+	void pop_back() {
+		ring_.pop_back();
+	}
+
+	void pop_front() {
+		ring_.pop_front();
+	}
+
+	void resize(const size_type count) {
+		ASSERT(count <= N);
+		if( count < this->size() ){
+			ring_.pop_back(this->size() - count);
+		}
+		while( this->size() < count ){
+			ring_.emplace_back();
+		}
+	}
+
+	void resize(const size_type count, const value_type& value) {
+		ASSERT(count <= N);
+		if( count < this->size() ){
+			ring_.pop_back(this->size() - count);
+		}
+		while( this->size() < count ){
+			ring_.push_back(value);
+		}
+	}
+
+	void swap(bounded_deque& other) noexcept(noexcept(std::declval<ring_type&>().swap(std::declval<ring_type&>()))) {
+		ring_.swap(other.ring_);
+	}
+
+private:
+	ring_type ring_;
+};
+
+
+// ================================================================
+//                        Free Functions
+// ================================================================
+
+template<typename T, std::size_t N>
+bool operator==(const bounded_deque<T,N>& lhs, const bounded_deque<T,N>& rhs) {
+	return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<typename T, std::size_t N>
+auto operator<=>(const bounded_deque<T,N>& lhs, const bounded_deque<T,N>& rhs) {
+	return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<typename T, std::size_t N>
+void swap(bounded_deque<T,N>& lhs, bounded_deque<T,N>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+	lhs.swap(rhs);
+}
+
+template<typename T, std::size_t N, typename U>
+typename bounded_deque<T,N>::size_type erase(bounded_deque<T,N>& c, const U& value) {
+	auto it = std::remove(c.begin(), c.end(), value);
+	const auto count = static_cast<std::size_t>(c.end() - it);
+	c.erase(it, c.end());
+	return count;
+}
+
+template<typename T, std::size_t N, typename Pred>
+typename bounded_deque<T,N>::size_type erase_if(bounded_deque<T,N>& c, Pred pred) {
+	auto it = std::remove_if(c.begin(), c.end(), pred);
+	const auto count = static_cast<std::size_t>(c.end() - it);
+	c.erase(it, c.end());
+	return count;
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_VECTOR_BOUNDED_DEQUE_HPP_ */
@@ -0,0 +1,465 @@
+/**
+ * \file       bounded_ring.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_VECTOR_BOUNDED_RING_HPP_
+#define INCLUDE_XSTD_DETAIL_VECTOR_BOUNDED_RING_HPP_
+
+
+#include "xstd/assert.hpp"
+#include "xstd/detail/type_traits/relocatable.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \file
+ * bounded_ring.hpp
+ *
+ * \brief
+ * Fixed capacity ring buffer with all data inside the object
+ *
+ * \details
+ * The ring keeps its elements within uninitialized storage for N
+ * values the same way as bounded_vector. Elements are added and
+ * removed at both ends in constant time without ever allocating.
+ * Positions wrap around the storage by masking with N-1 so the
+ * capacity must be a power of two.
+ */
+
+namespace xstd {
+
+/// Random access iterator over the elements of a ring
+/**
+ * The position increases monotonically from the head of the ring
+ * and is masked into the storage on every dereference.
+ */
+template<typename T, std::size_t Mask>
+class ring_iterator final {
+public:
+	using iterator_category = std::random_access_iterator_tag;
+	using iterator_concept  = std::random_access_iterator_tag;
+	using value_type        = std::remove_const_t<T>;
+	using difference_type   = std::ptrdiff_t;
+	using reference         = T&;
+	using pointer           = T*;
+
+	ring_iterator() noexcept = default;
+
+	ring_iterator(T* data, const std::size_t pos) noexcept
+		: data_(data), pos_(pos) {
+	}
+
+	/// Conversion of a mutable iterator into a const iterator
+	template<typename U>
+	requires (std::is_const<T>::value && std::is_same<const U, T>::value)
+	ring_iterator(const ring_iterator<U,Mask>& other) noexcept
+		: data_(other.data_), pos_(other.pos_) {
+	}
+
+	reference operator*() const noexcept {
+		return data_[pos_ & Mask];
+	}
+
+	pointer operator->() const noexcept {
+		return data_ + (pos_ & Mask);
+	}
+
+	reference operator[](const difference_type n) const noexcept {
+		return data_[(pos_ + n) & Mask];
+	}
+
+	ring_iterator& operator++() noexcept { ++pos_; return *this; }
+	ring_iterator& operator--() noexcept { --pos_; return *this; }
+	ring_iterator  operator++(int) noexcept { auto tmp = *this; ++pos_; return tmp; }
+	ring_iterator  operator--(int) noexcept { auto tmp = *this; --pos_; return tmp; }
+	ring_iterator& operator+=(const difference_type n) noexcept { pos_ += n; return *this; }
+	ring_iterator& operator-=(const difference_type n) noexcept { pos_ -= n; return *this; }
+
+	friend ring_iterator operator+(ring_iterator it, const difference_type n) noexcept { return it += n; }
+	friend ring_iterator operator+(const difference_type n, ring_iterator it) noexcept { return it += n; }
+	friend ring_iterator operator-(ring_iterator it, const difference_type n) noexcept { return it -= n; }
+
+	friend difference_type operator-(const ring_iterator& a, const ring_iterator& b) noexcept {
+		return static_cast<difference_type>(a.pos_ - b.pos_);
+	}
+
+	friend bool operator==(const ring_iterator& a, const ring_iterator& b) noexcept {
+		return a.pos_ == b.pos_;
+	}
+
+	friend auto operator<=>(const ring_iterator& a, const ring_iterator& b) noexcept {
+		return (a - b) <=> 0;
+	}
+
+private:
+	template<typename U, std::size_t M>
+	friend class ring_iterator;
+
+	T*          data_ = nullptr;
+	std::size_t pos_  = 0;
+};
+
+
+/// Fixed capacity ring buffer that models a double ended queue
+/**
+ * \code
+ * xstd::bounded_ring<Task,64> work;
+ * work.push_back(task);                // no allocation
+ * auto [a, b] = work.spans();          // contiguous batches
+ * process(a);
+ * process(b);
+ * work.pop_front(a.size() + b.size());
+ * \endcode
+ *
+ * \tparam T Type held within ring
+ * \tparam N Capacity which must be a power of two
+ */
+template<typename T, std::size_t N>
+class bounded_ring final {
+	static_assert(std::has_single_bit(N), "Capacity must be a power of two");
+
+	static constexpr std::size_t mask = N - 1;
+
+public:
+
+	// ====================================================
+	// Types
+	// ====================================================
+
+	using value_type             = T;
+	using size_type              = std::size_t;
+	using difference_type        = std::ptrdiff_t;
+	using reference              = value_type&;
+	using const_reference        = const value_type&;
+	using pointer                = value_type*;
+	using const_pointer          = const value_type*;
+	using iterator               = ring_iterator<T,mask>;
+	using const_iterator         = ring_iterator<const T,mask>;
+	using reverse_iterator       = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	// ====================================================
+	// Constructors
+	// ====================================================
+
+	bounded_ring() noexcept : head_(0), size_(0) {
+	}
+
+	bounded_ring(std::initializer_list<T> init) : bounded_ring() {
+		ASSERT(init.size() <= N);
+		for(const auto& value : init){
+			this->push_back(value);
+		}
+	}
+
+	bounded_ring(const bounded_ring& other) : bounded_ring() {
+		for(const auto& value : other){
+			this->push_back(value);
+		}
+	}
+
+	bounded_ring(bounded_ring&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+		: bounded_ring() {
+		this->take_(other);
+	}
+
+	~bounded_ring() requires std::is_trivially_destructible_v<T> = default;
+
+	~bounded_ring() {
+		this->clear();
+	}
+
+	bounded_ring& operator=(const bounded_ring& other) {
+		if( this != &other ){
+			this->clear();
+			for(const auto& value : other){
+				this->push_back(value);
+			}
+		}
+		return *this;
+	}
+
+	bounded_ring& operator=(bounded_ring&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+		if( this != &other ){
+			this->clear();
+			this->take_(other);
+		}
+		return *this;
+	}
+
+	// ====================================================
+	// Element Access
+	// ====================================================
+
+	reference at(const size_type pos) {
+		if( pos >= size_ ){
+			throw std::out_of_range("bounded_ring::at");
+		}
+		return (*this)[pos];
+	}
+
+	const_reference at(const size_type pos) const {
+		if( pos >= size_ ){
+			throw std::out_of_range("bounded_ring::at");
+		}
+		return (*this)[pos];
+	}
+
+	reference operator[](const size_type pos) noexcept {
+		ASSERT(pos < size_);
+		return this->slot_(head_ + pos);
+	}
+
+	const_reference operator[](const size_type pos) const noexcept {
+		ASSERT(pos < size_);
+		return this->slot_(head_ + pos);
+	}
+
+	reference front() noexcept {
+		ASSERT(not this->empty());
+		return this->slot_(head_);
+	}
+
+	const_reference front() const noexcept {
+		ASSERT(not this->empty());
+		return this->slot_(head_);
+	}
+
+	reference back() noexcept {
+		ASSERT(not this->empty());
+		return this->slot_(head_ + size_ - 1);
+	}
+
+	const_reference back() const noexcept {
+		ASSERT(not this->empty());
+		return this->slot_(head_ + size_ - 1);
+	}
+
+	/// Elements as two contiguous ranges in order
+	/**
+	 * The second range is empty unless the elements wrap around
+	 * the end of the storage.
+	 */
+	std::pair<std::span<T>,std::span<T>> spans() noexcept {
+		const auto first = std::min(size_, N - head_);
+		return {std::span<T>(this->values_() + head_, first),
+		        std::span<T>(this->values_(), size_ - first)};
+	}
+
+	std::pair<std::span<const T>,std::span<const T>> spans() const noexcept {
+		const auto first = std::min(size_, N - head_);
+		return {std::span<const T>(this->values_() + head_, first),
+		        std::span<const T>(this->values_(), size_ - first)};
+	}
+
+	// ====================================================
+	// Iterators
+	// ====================================================
+
+	iterator begin() noexcept { return iterator(this->values_(), head_); }
+	iterator end() noexcept { return iterator(this->values_(), head_ + size_); }
+	const_iterator begin() const noexcept { return const_iterator(this->values_(), head_); }
+	const_iterator end() const noexcept { return const_iterator(this->values_(), head_ + size_); }
+	const_iterator cbegin() const noexcept { return this->begin(); }
+	const_iterator cend() const noexcept { return this->end(); }
+
+	reverse_iterator rbegin() noexcept { return reverse_iterator(this->end()); }
+	reverse_iterator rend() noexcept { return reverse_iterator(this->begin()); }
+	const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(this->end()); }
+	const_reverse_iterator rend() const noexcept { return const_reverse_iterator(this->begin()); }
+	const_reverse_iterator crbegin() const noexcept { return this->rbegin(); }
+	const_reverse_iterator crend() const noexcept { return this->rend(); }
+
+	// ====================================================
+	// Capacity
+	// ====================================================
+
+	[[nodiscard]] bool empty() const noexcept {
+		return size_ == 0;
+	}
+
+	bool full() const noexcept {
+		return size_ == N;
+	}
+
+	size_type size() const noexcept {
+		return size_;
+	}
+
+	static constexpr size_type max_size() noexcept {
+		return N;
+	}
+
+	static constexpr size_type capacity() noexcept {
+		return N;
+	}
+
+	// ====================================================
+	// Modifiers
+	// ====================================================
+
+	void clear() noexcept {
+		if constexpr ( not std::is_trivially_destructible<T>::value ) {
+			auto [a, b] = this->spans();
+			std::destroy(a.begin(), a.end());
+			std::destroy(b.begin(), b.end());
+		}
+		head_ = 0;
+		size_ = 0;
+	}
+
+	void push_back(const T& value) {
+		this->emplace_back(value);
+	}
+
+	void push_back(T&& value) {
+		this->emplace_back(std::move(value));
+	}
+
+	template<typename... Args>
+	reference emplace_back(Args&&... args) {
+		ASSERT(not this->full());
+		auto ptr = std::construct_at(&this->slot_(head_ + size_), std::forward<Args>(args)...);
+		++size_;
+		return *ptr;
+	}
+
+	void push_front(const T& value) {
+		this->emplace_front(value);
+	}
+
+	void push_front(T&& value) {
+		this->emplace_front(std::move(value));
+	}
+
+	template<typename... Args>
+	reference emplace_front(Args&&... args) {
+		ASSERT(not this->full());
+		const auto new_head = (head_ - 1) & mask;
+		auto ptr = std::construct_at(&this->slot_(new_head), std::forward<Args>(args)...);
+		head_ = new_head;
+		++size_;
+		return *ptr;
+	}
+
+	void pop_back() {
+		ASSERT(not this->empty());
+		--size_;
+		std::destroy_at(&this->slot_(head_ + size_));
+	}
+
+	void pop_front() {
+		ASSERT(not this->empty());
+		std::destroy_at(&this->slot_(head_));
+		head_ = (head_ + 1) & mask;
+		--size_;
+	}
+
+	/// Remove the first count elements
+	void pop_front(const size_type count) {
+		ASSERT(count <= size_);
+		if constexpr ( not std::is_trivially_destructible<T>::value ) {
+			std::destroy(this->begin(), this->begin() + count);
+		}
+		head_  = (head_ + count) & mask;
+		size_ -= count;
+		if( size_ == 0 ){
+			head_ = 0;
+		}
+	}
+
+	/// Remove the last count elements
+	void pop_back(const size_type count) {
+		ASSERT(count <= size_);
+		if constexpr ( not std::is_trivially_destructible<T>::value ) {
+			std::destroy(this->end() - count, this->end());
+		}
+		size_ -= count;
+	}
+
+	void swap(bounded_ring& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+		if( this != &other ){
+			bounded_ring tmp(std::move(other));
+			other.take_(*this);
+			this->take_(tmp);
+		}
+	}
+
+private:
+	/// Uninitialized storage for N elements
+	union storage_type {
+		storage_type() noexcept {}
+		~storage_type() requires std::is_trivially_destructible_v<T> = default;
+		~storage_type() {}
+		T values[N];
+	};
+
+	storage_type storage_;
+	size_type    head_;
+	size_type    size_;
+
+	T* values_() noexcept {
+		return storage_.values;
+	}
+
+	const T* values_() const noexcept {
+		return storage_.values;
+	}
+
+	T& slot_(const size_type pos) noexcept {
+		return storage_.values[pos & mask];
+	}
+
+	const T& slot_(const size_type pos) const noexcept {
+		return storage_.values[pos & mask];
+	}
+
+	/// Relocate the elements of other into this empty ring
+	void take_(bounded_ring& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+		ASSERT(this->empty());
+		auto [a, b] = other.spans();
+		auto dest = uninitialized_relocate(a.data(), a.data() + a.size(), this->values_());
+		uninitialized_relocate(b.data(), b.data() + b.size(), dest);
+		head_ = 0;
+		size_ = other.size_;
+		other.head_ = 0;
+		other.size_ = 0;
+	}
+};
+
+
+// ================================================================
+//                        Free Functions
+// ================================================================
+
+template<typename T, std::size_t N>
+bool operator==(const bounded_ring<T,N>& lhs, const bounded_ring<T,N>& rhs) {
+	return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<typename T, std::size_t N>
+auto operator<=>(const bounded_ring<T,N>& lhs, const bounded_ring<T,N>& rhs) {
+	return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<typename T, std::size_t N>
+void swap(bounded_ring<T,N>& lhs, bounded_ring<T,N>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+	lhs.swap(rhs);
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_VECTOR_BOUNDED_RING_HPP_ */
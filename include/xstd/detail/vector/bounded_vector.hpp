@@ -9,11 +9,15 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <initializer_list>
 #include <iterator>
 #include <memory>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "xstd/detail/type_traits/relocatable.hpp"
+
 namespace xstd {
 
 namespace detail {
@@ -26,10 +30,14 @@ using require_input_iter = typename std::enable_if<std::is_convertible<typename
  * A std::vector like class with all data on the stack.
  * The container cannot be resized larger than the initial
  * parameter passed at compile time.
- * 
+ *
+ * The storage is left uninitialized and only the first size()
+ * elements are ever constructed, so T does not need to be default
+ * constructible and moves or swaps only touch live elements.
+ *
  * \tparam T Type held within vector
  * \tparam N Maximum size at compile time
- * \tparam Init Flag to initialize data
+ * \tparam Init Flag to value initialize (true) or default initialize (false) new elements of resize
  */
 template <class T, std::size_t N, bool Init = true>
 class bounded_vector {
@@ -63,7 +71,7 @@ class bounded_vector {
 
     constexpr explicit bounded_vector(size_type count);
 
-    template <class InputIt>
+    template <class InputIt, class = detail::require_input_iter<InputIt>>
     constexpr bounded_vector(InputIt first, InputIt last);
 
     constexpr bounded_vector(const bounded_vector& other);
@@ -74,7 +82,9 @@ class bounded_vector {
 
     bounded_vector(const std::vector<T>& vec);
 
-    ~bounded_vector() = default;
+    ~bounded_vector() requires std::is_trivially_destructible_v<T> = default;
+
+    ~bounded_vector();
 
     template <std::size_t N2, bool I2, class = std::enable_if_t<N != N2, void>>
     constexpr bounded_vector(const bounded_vector<T, N2, I2>& other);
@@ -89,7 +99,7 @@ class bounded_vector {
 
     constexpr void assign(size_type count, const T& value);
 
-    template <class InputIt>
+    template <class InputIt, class = detail::require_input_iter<InputIt>>
     constexpr void assign(InputIt first, InputIt last);
 
     constexpr void assign(std::initializer_list<T> ilist);
@@ -177,7 +187,7 @@ class bounded_vector {
     constexpr iterator insert(const_iterator pos, size_type count,
                               const T& value);
 
-    template <class InputIt>
+    template <class InputIt, class = detail::require_input_iter<InputIt>>
     constexpr iterator insert(const_iterator pos, InputIt first, InputIt last);
 
     constexpr iterator insert(const_iterator pos, std::initializer_list<T> ilist);
@@ -208,8 +218,22 @@ class bounded_vector {
     void swap(bounded_vector<T, N2, I2>& other);
 
    protected:
-    alignas(alignment) T data_[N > 0 ? N : 1];
+    /// Uninitialized storage for N elements
+    union storage_type {
+        constexpr storage_type() noexcept {}
+        constexpr ~storage_type() requires std::is_trivially_destructible_v<T> = default;
+        constexpr ~storage_type() {}
+        alignas(alignment) T values[N > 0 ? N : 1];
+    };
+
+    storage_type storage_;
     size_type size_;
+
+    template <class, std::size_t, bool>
+    friend class bounded_vector;
+
+    template <std::size_t N2, bool I2>
+    void swap_elements_(bounded_vector<T, N2, I2>& other);
 };
 
 // ****************************************************************
@@ -225,61 +249,77 @@ bounded_vector<T, N, I>::bounded_vector() noexcept : size_(0) {
 }
 
 template <class T, std::size_t N, bool I>
-constexpr bounded_vector<T, N, I>::bounded_vector(size_type count, const T& value) {
+constexpr bounded_vector<T, N, I>::bounded_vector(size_type count, const T& value) : size_(0) {
     assign(count, value);
 }
 
 template <class T, std::size_t N, bool I>
-constexpr bounded_vector<T, N, I>::bounded_vector(size_type count) {
+constexpr bounded_vector<T, N, I>::bounded_vector(size_type count) : size_(0) {
     assert(count <= N);
-    if constexpr (I) {
-        assign(count, T(0));
-    } else {
-        resize(count);
-    }
+    resize(count);
 }
 
 template <class T, std::size_t N, bool I>
-template <class InputIt>
-constexpr bounded_vector<T, N, I>::bounded_vector(InputIt first, InputIt last) {
+template <class InputIt, class>
+constexpr bounded_vector<T, N, I>::bounded_vector(InputIt first, InputIt last) : size_(0) {
     assign(first, last);
 }
 
 template <class T, std::size_t N, bool I>
-constexpr bounded_vector<T, N, I>::bounded_vector(const bounded_vector& other) {
-    assign(other.begin(), other.end());
+constexpr bounded_vector<T, N, I>::bounded_vector(const bounded_vector& other) : size_(0) {
+    std::uninitialized_copy(other.begin(), other.end(), begin());
+    size_ = other.size_;
 }
 
 template <class T, std::size_t N, bool I>
-constexpr bounded_vector<T, N, I>::bounded_vector(bounded_vector&& other) noexcept(std::is_nothrow_move_constructible<value_type>::value) {
-    *this = std::move(other); // Forward to move assignment
+constexpr bounded_vector<T, N, I>::bounded_vector(bounded_vector&& other) noexcept(std::is_nothrow_move_constructible<value_type>::value) : size_(0) {
+    std::uninitialized_move(other.begin(), other.end(), begin());
+    size_ = other.size_;
+    other.clear();
 }
 
 template <class T, std::size_t N, bool I>
-constexpr bounded_vector<T, N, I>::bounded_vector(std::initializer_list<T> init) {
+constexpr bounded_vector<T, N, I>::bounded_vector(std::initializer_list<T> init) : size_(0) {
     assign(init.begin(), init.end());
 }
 
 template <class T, std::size_t N, bool I>
-bounded_vector<T, N, I>::bounded_vector(const std::vector<T>& vec) {
+bounded_vector<T, N, I>::bounded_vector(const std::vector<T>& vec) : size_(0) {
     assign(vec.begin(), vec.end());
 }
 
+template <class T, std::size_t N, bool I>
+bounded_vector<T, N, I>::~bounded_vector() {
+    clear();
+}
+
 template <class T, std::size_t N, bool I>
 template <std::size_t N2, bool I2, class Ans>
-constexpr bounded_vector<T, N, I>::bounded_vector(const bounded_vector<T, N2, I2>& other) {
+constexpr bounded_vector<T, N, I>::bounded_vector(const bounded_vector<T, N2, I2>& other) : size_(0) {
     assign(other.begin(), other.end());
 }
 
 template <class T, std::size_t N, bool I>
 constexpr bounded_vector<T, N, I>& bounded_vector<T, N, I>::operator=(const bounded_vector& other) {
-    assign(other.begin(), other.end());
+    if (this != &other) {
+        assign(other.begin(), other.end());
+    }
     return *this;
 }
 
 template <class T, std::size_t N, bool I>
 constexpr bounded_vector<T, N, I>& bounded_vector<T, N, I>::operator=(bounded_vector&& other) noexcept(std::is_nothrow_move_assignable<value_type>::value) {
-    this->swap(other);
+    if (this != &other) {
+        const auto common = std::min(size_, other.size_);
+        std::move(other.begin(), other.begin() + common, begin());
+        if (other.size_ > size_) {
+            std::uninitialized_move(other.begin() + common, other.end(), end());
+        } else {
+            std::destroy(begin() + common, end());
+        }
+        size_ = other.size_;
+        other.clear();
+    }
     return *this;
 }
 
@@ -305,23 +345,37 @@ bounded_vector<T, N, I>& bounded_vector<T, N, I>::operator=(const bounded_vector
 template <class T, std::size_t N, bool I>
 constexpr void bounded_vector<T, N, I>::assign(size_type count, const T& value) {
     assert(count <= max_size());
-    std::fill_n(begin(), count, value);
+    const auto common = std::min(size_, count);
+    std::fill_n(begin(), common, value);
+    if (count > size_) {
+        std::uninitialized_fill(end(), begin() + count, value);
+    } else {
+        std::destroy(begin() + count, end());
+    }
     size_ = count;
 }
 
 template <class T, std::size_t N, bool I>
-template <class InputIt>
+template <class InputIt, class>
 constexpr void bounded_vector<T, N, I>::assign(InputIt first, InputIt last) {
-    assert(std::distance(first, last) <= N);
-    std::copy(first, last, begin());
-    size_ = std::distance(first, last);
+    // Assign over the live elements then construct or destroy the rest
+    size_type i = 0;
+    for (; (first != last) && (i < size_); ++first, ++i) {
+        data()[i] = *first;
+    }
+    if (first == last) {
+        std::destroy(begin() + i, end());
+        size_ = i;
+    } else {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
 }
 
 template <class T, std::size_t N, bool I>
 constexpr void bounded_vector<T, N, I>::assign(std::initializer_list<T> ilist) {
-    assert(std::distance(ilist.begin(), ilist.end()) <= N);
-    std::copy(ilist.begin(), ilist.end(), begin());
-    size_ = ilist.size();
+    assign(ilist.begin(), ilist.end());
 }
 
 template <class T, std::size_t N, bool I>
@@ -336,59 +390,59 @@ constexpr typename bounded_vector<T, N, I>::allocator_type bounded_vector<T, N,
 template <class T, std::size_t N, bool I>
 constexpr typename bounded_vector<T, N, I>::reference bounded_vector<T, N, I>::at(size_type pos) {
     assert(pos < this->size());
-    return data_[pos];
+    return data()[pos];
 }
 
 template <class T, std::size_t N, bool I>
 constexpr typename bounded_vector<T, N, I>::const_reference bounded_vector<T, N, I>::at(size_type pos) const {
     assert(pos < this->size());
-    return data_[pos];
+    return data()[pos];
 }
 
 template <class T, std::size_t N, bool I>
 constexpr typename bounded_vector<T, N, I>::reference bounded_vector<T, N, I>::operator[](size_type pos) {
     assert(pos < this->size());
-    return data_[pos];
+    return data()[pos];
 }
 
 template <class T, std::size_t N, bool I>
 constexpr typename bounded_vector<T, N, I>::const_reference bounded_vector<T, N, I>::operator[](size_type pos) const {
     assert(pos < this->size());
-    return data_[pos];
+    return data()[pos];
 }
 
 template <class T, std::size_t N, bool I>
 constexpr typename bounded_vector<T, N, I>::reference bounded_vector<T, N, I>::front() {
     assert(0 < this->size());
-    return data_[0];
+    return data()[0];
 }
 
 template <class T, std::size_t N, bool I>
 constexpr typename bounded_vector<T, N, I>::const_reference bounded_vector<T, N, I>::front() const {
     assert(0 < this->size());
-    return data_[0];
+    return data()[0];
 }
 
 template <class T, std::size_t N, bool I>
 constexpr typename bounded_vector<T, N, I>::reference bounded_vector<T, N, I>::back() {
     assert(0 < this->size());
-    return data_[size_ - 1];
+    return data()[size_ - 1];
 }
 
 template <class T, std::size_t N, bool I>
 constexpr typename bounded_vector<T, N, I>::const_reference bounded_vector<T, N, I>::back() const {
     assert(0 < this->size());
-    return data_[size_ - 1];
+    return data()[size_ - 1];
 }
 
 template <class T, std::size_t N, bool I>
 constexpr T* bounded_vector<T, N, I>::data() noexcept {
-    return data_;
+    return storage_.values;
 }
 
 template <class T, std::size_t N, bool I>
 constexpr const T* bounded_vector<T, N, I>::data() const noexcept {
-    return data_;
+    return storage_.values;
 }
 
 // ================================================================
@@ -397,12 +451,12 @@ constexpr const T* bounded_vector<T, N, I>::data() const noexcept {
 
 template <class T, std::size_t N, bool I>
 constexpr typename bounded_vector<T, N, I>::iterator bounded_vector<T, N, I>::begin() noexcept {
-    return data_;
+    return data();
 }
 
 template <class T, std::size_t N, bool I>
 constexpr typename bounded_vector<T, N, I>::const_iterator bounded_vector<T, N, I>::begin() const noexcept {
-    return data_;
+    return data();
 }
 
 template <class T, std::size_t N, bool I>
@@ -476,7 +530,7 @@ constexpr typename bounded_vector<T, N, I>::size_type bounded_vector<T, N, I>::m
 
 template <class T, std::size_t N, bool I>
 constexpr void bounded_vector<T, N, I>::reserve(size_type new_cap) {
-    assert(new_cap < N);
+    assert(new_cap <= N);
 }
 
 template <class T, std::size_t N, bool I>
@@ -495,38 +549,18 @@ constexpr void bounded_vector<T, N, I>::shrink_to_fit() {
 
 template <class T, std::size_t N, bool I>
 constexpr void bounded_vector<T, N, I>::clear() noexcept {
-    resize(size_type(0));
+    std::destroy(begin(), end());
+    size_ = 0;
 }
 
 template <class T, std::size_t N, bool I>
 constexpr typename bounded_vector<T, N, I>::iterator bounded_vector<T, N, I>::insert(const_iterator pos, const T& value) {
-    assert(size() < max_size());
-    assert((pos - cbegin()) >= 0);
-    assert((pos - cbegin()) <= size());
-
-    if (pos == cend()) {
-        push_back(value);
-        return (end() - 1);
-    }
-    return this->insert(pos, size_type(1), value);
+    return emplace(pos, value);
 }
 
 template <class T, std::size_t N, bool I>
 constexpr typename bounded_vector<T, N, I>::iterator bounded_vector<T, N, I>::insert(const_iterator pos, T&& value) {
-    assert(size() < max_size());
-    assert((pos - cbegin()) >= 0);
-    assert((pos - cbegin()) <= size());
-
-    if (pos == cend()) {
-        emplace_back(std::forward<T>(value));
-        return (end() - 1);
-    }
-
-    auto it = const_cast<pointer>(pos);
-    std::move_backward(it, end(), end() + 1);
-    *it = std::forward<T>(value);
-    ++size_;
-    return it;
+    return emplace(pos, std::move(value));
 }
 
 template <class T, std::size_t N, bool I>
@@ -535,35 +569,60 @@ constexpr typename bounded_vector<T, N, I>::iterator bounded_vector<T, N, I>::in
     assert((pos - cbegin()) <= size());
     assert((size() + count) <= max_size());
 
-    // Shift tail end "count" positions to right
-    auto it = const_cast<pointer>(pos);
-    std::move_backward(it, end(), end() + count);
-
-    // Handle case if &value is/was within this array but after pos
-    auto value_iter = static_cast<const_iterator>(&value);
-    const bool value_after_pos = std::distance(pos, value_iter) >= 0;
-    const bool value_before_end = std::distance(value_iter, cend()) > 0;
-    if (value_after_pos && value_before_end) {
-        value_iter += count;
+    const auto index = pos - cbegin();
+    if constexpr (is_trivially_relocatable_v<T>) {
+        // Shift the tail up and fill the gap (value may be within this array)
+        const T copy(value);
+        auto it = begin() + index;
+        uninitialized_relocate(it, end(), it + count);
+        try {
+            std::uninitialized_fill_n(it, count, copy);
+        } catch (...) {
+            uninitialized_relocate(it + count, end() + count, it);
+            throw;
+        }
+        size_ += count;
+        return it;
     }
-    std::fill(it, it + count, *value_iter);
+
+    // Append then rotate into position (value may be within this array)
+    const auto old_end = end();
+    std::uninitialized_fill_n(old_end, count, value);
     size_ += count;
-    return it;
+    std::rotate(begin() + index, old_end, end());
+    return begin() + index;
 }
 
 template <class T, std::size_t N, bool I>
-template <class InputIt>
+template <class InputIt, class>
 constexpr typename bounded_vector<T, N, I>::iterator bounded_vector<T, N, I>::insert(const_iterator pos, InputIt first, InputIt last) {
     assert((pos - cbegin()) >= 0);
     assert((pos - cbegin()) <= size());
-    assert(size() + std::distance(first, last) <= max_size());
 
-    auto it = const_cast<pointer>(pos);
-    const auto num_added = std::distance(first, last);
-    std::move_backward(it, end(), end() + num_added);
-    std::copy(first, last, it);
-    size_ += num_added;
-    return it;
+    const auto index = pos - cbegin();
+    if constexpr (is_trivially_relocatable_v<T> && std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>::value) {
+        // Shift the tail up and copy into the gap
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        assert((size() + count) <= max_size());
+        auto it = begin() + index;
+        uninitialized_relocate(it, end(), it + count);
+        try {
+            std::uninitialized_copy(first, last, it);
+        } catch (...) {
+            uninitialized_relocate(it + count, end() + count, it);
+            throw;
+        }
+        size_ += count;
+        return it;
+    }
+
+    // Append then rotate into position
+    const auto old_size = size_;
+    for (; first != last; ++first) {
+        emplace_back(*first);
+    }
+    std::rotate(begin() + index, begin() + old_size, end());
+    return begin() + index;
 }
 
 template <class T, std::size_t N, bool I>
@@ -574,9 +633,29 @@ constexpr typename bounded_vector<T, N, I>::iterator bounded_vector<T, N, I>::in
 template <class T, std::size_t N, bool I>
 template <class... Args>
 constexpr typename bounded_vector<T, N, I>::iterator bounded_vector<T, N, I>::emplace(const_iterator pos, Args&&... args) {
+    assert(size() < max_size());
     assert((pos - cbegin()) >= 0);
     assert((pos - cbegin()) <= size());
-    return insert(pos, T(std::forward<Args>(args)...));
+
+    if (pos == cend()) {
+        emplace_back(std::forward<Args>(args)...);
+        return (end() - 1);
+    }
+
+    // Construct first since args may refer to an element being shifted
+    T value(std::forward<Args>(args)...);
+    auto it = const_cast<pointer>(pos);
+    if constexpr (is_trivially_relocatable_v<T>) {
+        uninitialized_relocate(it, end(), it + 1);
+        std::construct_at(it, std::move(value));
+        ++size_;
+        return it;
+    }
+    std::construct_at(end(), std::move(back()));
+    std::move_backward(it, end() - 1, end());
+    ++size_;
+    *it = std::move(value);
+    return it;
 }
 
 template <class T, std::size_t N, bool I>
@@ -584,8 +663,14 @@ constexpr typename bounded_vector<T, N, I>::iterator bounded_vector<T, N, I>::er
     assert((pos - cbegin()) >= 0);
     assert((pos - cbegin()) < size());
     auto it = const_cast<iterator>(pos);
+    if constexpr (is_trivially_relocatable_v<T>) {
+        std::destroy_at(it);
+        uninitialized_relocate(it + 1, end(), it);
+        --size_;
+        return it;
+    }
     std::move(it + 1, end(), it);
-    --size_;
+    pop_back();
     return it;
 }
 
@@ -593,38 +678,37 @@ template <class T, std::size_t N, bool I>
 constexpr typename bounded_vector<T, N, I>::iterator bounded_vector<T, N, I>::erase(const_iterator cfirst, const_iterator clast) {
     assert((clast - cfirst) >= 0);
     assert((cfirst - cbegin()) >= 0);
-    assert((clast - cbegin()) < size());
+    assert((clast - cbegin()) <= size());
 
     auto first = const_cast<iterator>(cfirst);
-    if (clast == cend()) {
-        size_ = cfirst - cbegin();
+    auto last = const_cast<iterator>(clast);
+    if constexpr (is_trivially_relocatable_v<T>) {
+        std::destroy(first, last);
+        uninitialized_relocate(last, end(), first);
+        size_ -= (last - first);
         return first;
     }
-
-    auto last = const_cast<iterator>(clast);
-    size_ = std::move(last, end(), first) - cbegin();
+    auto new_end = std::move(last, end(), first);
+    std::destroy(new_end, end());
+    size_ = new_end - begin();
     return first;
 }
 
 template <class T, std::size_t N, bool I>
 constexpr void bounded_vector<T, N, I>::push_back(const T& value) {
-    assert(size() < max_size());
-    data_[size_] = value;
-    ++size_;
+    emplace_back(value);
 }
 
 template <class T, std::size_t N, bool I>
 constexpr void bounded_vector<T, N, I>::push_back(T&& value) {
-    assert(size() < max_size());
-    data_[size_] = std::forward<T>(value);
-    ++size_;
+    emplace_back(std::move(value));
 }
 
 template <class T, std::size_t N, bool I>
 template <class... Args>
 constexpr typename bounded_vector<T, N, I>::reference bounded_vector<T, N, I>::emplace_back(Args&&... args) {
     assert(size() < max_size());
-    data_[size_] = T(std::forward<Args>(args)...);
+    std::construct_at(end(), std::forward<Args>(args)...);
     ++size_;
     return this->back();
 }
@@ -633,14 +717,21 @@ template <class T, std::size_t N, bool I>
 constexpr void bounded_vector<T, N, I>::pop_back() {
     if (not empty()) {
         --size_;
+        std::destroy_at(end());
     }
 }
 
 template <class T, std::size_t N, bool I>
 constexpr void bounded_vector<T, N, I>::resize(size_type count) {
     assert(count <= max_size());
-    if (I && (count > this->size())) {
-        std::fill(data_ + size_, data_ + count, T());
+    if (count > this->size()) {
+        if constexpr (I) {
+            std::uninitialized_value_construct(end(), begin() + count);
+        } else {
+            std::uninitialized_default_construct(end(), begin() + count);
+        }
+    } else {
+        std::destroy(begin() + count, end());
     }
     size_ = count;
 }
@@ -649,7 +740,9 @@ template <class T, std::size_t N, bool I>
 constexpr void bounded_vector<T, N, I>::resize(size_type count, const value_type& value) {
     assert(count <= max_size());
     if (count > this->size()) {
-        std::fill(data_ + size_, data_ + count, value);
+        std::uninitialized_fill(end(), begin() + count, value);
+    } else {
+        std::destroy(begin() + count, end());
     }
     size_ = count;
 }
@@ -657,40 +750,47 @@ constexpr void bounded_vector<T, N, I>::resize(size_type count, const value_type
 template <class T, std::size_t N, bool I>
 constexpr void bounded_vector<T, N, I>::swap(bounded_vector& other) noexcept {
     if (this != &other) {
-        std::swap(size_, other.size_);
-        std::swap_ranges(data_, data_ + std::max(size_, other.size_), other.data_);
+        swap_elements_(other);
     }
 }
 
 template <class T, std::size_t N, bool I>
 template <std::size_t N2, bool I2, class>
 void bounded_vector<T, N, I>::swap(bounded_vector<T, N2, I2>& other) {
-    assert(this->size() < other.max_size());
-    assert(other.size() < this->max_size());
-    using std::swap;
-
-    const auto old_other_size = other.size();
-    const auto old_this_size = this->size();
-
-    if (old_other_size > old_this_size) {
-        this->resize(old_other_size);
-    } else if (old_this_size > old_other_size) {
-        other.resize(old_this_size);
-    }
-
-    // Swap the shared elements.
-    const auto min_size = std::min(old_this_size, old_other_size);
-    for (size_type i = 0; i < min_size; ++i) {
-        swap((*this)[i], other[i]);
+    assert(this->size() <= other.max_size());
+    assert(other.size() <= this->max_size());
+    swap_elements_(other);
+}
+
+template <class T, std::size_t N, bool I>
+template <std::size_t N2, bool I2>
+void bounded_vector<T, N, I>::swap_elements_(bounded_vector<T, N2, I2>& other) {
+    if constexpr (is_trivially_relocatable_v<T>) {
+        // Exchange the bytes of the shared elements then relocate the rest
+        const auto min_size = std::min(this->size(), other.size());
+        swap_relocatable(this->data(), other.data(), min_size);
+        uninitialized_relocate(this->begin() + min_size, this->end(), other.begin() + min_size);
+        uninitialized_relocate(other.begin() + min_size, other.end(), this->begin() + min_size);
+        std::swap(this->size_, other.size_);
+        return;
     }
 
-    // Copy over the extra values.
-    if (old_this_size > old_other_size) {
-        std::copy(this->begin() + min_size, this->end(), other.begin() + min_size);
-        this->resize(old_other_size);
-    } else if (old_other_size > old_this_size) {
-        std::copy(other.begin() + min_size, other.end(), this->begin() + min_size);
-        other.resize(old_this_size);
+    // Swap the shared elements then move the extra ones across
+    const auto this_size = this->size();
+    const auto other_size = other.size();
+    const auto min_size = std::min(this_size, other_size);
+    std::swap_ranges(this->begin(), this->begin() + min_size, other.begin());
+
+    if (this_size > other_size) {
+        for (auto it = this->begin() + min_size; it != this->end(); ++it) {
+            other.emplace_back(std::move(*it));
+        }
+        this->erase(this->begin() + min_size, this->end());
+    } else if (other_size > this_size) {
+        for (auto it = other.begin() + min_size; it != other.end(); ++it) {
+            this->emplace_back(std::move(*it));
+        }
+        other.erase(other.begin() + min_size, other.end());
     }
 }
 
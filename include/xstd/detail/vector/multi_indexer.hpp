@@ -10,9 +10,17 @@
 
 
 #include "xstd/assert.hpp"
+#include "xstd/detail/config/simd.hpp"
 
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <cstddef>
+#include <cstdint>
+
+#if defined(XSTD_HAS_BMI2)
+#include <immintrin.h>
+#endif
 
 
 namespace xstd {
@@ -63,7 +71,7 @@ public:
 	RowMajorIndex& operator++(){
 		ASSERT(linear_index_ < (size()-1));
 		linear_index_++;
-		this->calc_index_();
+		this->increment_index_();
 		return *this;
 	}
 
@@ -71,14 +79,14 @@ public:
 		ASSERT(linear_index_ < (size()-1));
 		auto tmp = *this;
 		linear_index_++;
-		this->calc_index_();
+		this->increment_index_();
 		return tmp;
 	}
 
 	RowMajorIndex& operator--(){
 		ASSERT(linear_index_ > 0);
 		linear_index_--;
-		this->calc_index_();
+		this->decrement_index_();
 		return *this;
 	}
 
@@ -86,7 +94,7 @@ public:
 		ASSERT(linear_index_ > 0);
 		auto tmp = *this;
 		linear_index_--;
-		this->calc_index_();
+		this->decrement_index_();
 		return tmp;
 	}
 
@@ -173,9 +181,1029 @@ private:
 		indexes_[0] = linear_index_ / fac;
 	}
 
+	// Odometer step with the carry moving towards rank 0
+	void increment_index_() {
+		for(size_type i = N; i--> 1;) {
+			if( ++indexes_[i] < shapes_[i] ) {
+				return;
+			}
+			indexes_[i] = 0;
+		}
+		++indexes_[0];
+	}
+
+	void decrement_index_() {
+		for(size_type i = N; i--> 1;) {
+			if( indexes_[i]-- > 0 ) {
+				return;
+			}
+			indexes_[i] = shapes_[i] - 1;
+		}
+		--indexes_[0];
+	}
+
+};
+
+
+template<std::size_t N>
+class ColumnMajorIndex final {
+	static_assert(N > 0, "Cannot have 0 Rank Index");
+
+public:
+
+	// ====================================================
+	// Types
+	// ====================================================
+
+	using size_type  = std::size_t;
+
+	// ====================================================
+	// Constructors
+	// ====================================================
+
+	ColumnMajorIndex()                                = delete;
+	ColumnMajorIndex(const ColumnMajorIndex& other)   = default;
+	ColumnMajorIndex(ColumnMajorIndex&& other)        = default;
+	~ColumnMajorIndex()                               = default;
+
+	ColumnMajorIndex(const std::array<size_type,N> shape) :
+		shapes_(shape),
+		linear_index_(0){
+		this->calc_stride_();
+		this->calc_index_();
+	}
+
+	// ====================================================
+	// Operators
+	// ====================================================
+
+	ColumnMajorIndex& operator=(const ColumnMajorIndex& other) = default;
+	ColumnMajorIndex& operator=(ColumnMajorIndex&& other)      = default;
+
+
+	ColumnMajorIndex& operator=(const size_type& index){
+		ASSERT(index < size());
+		linear_index_ = index;
+		this->calc_index_();
+		return *this;
+	}
+
+	ColumnMajorIndex& operator++(){
+		ASSERT(linear_index_ < (size()-1));
+		linear_index_++;
+		this->increment_index_();
+		return *this;
+	}
+
+	ColumnMajorIndex operator++(int){
+		ASSERT(linear_index_ < (size()-1));
+		auto tmp = *this;
+		linear_index_++;
+		this->increment_index_();
+		return tmp;
+	}
+
+	ColumnMajorIndex& operator--(){
+		ASSERT(linear_index_ > 0);
+		linear_index_--;
+		this->decrement_index_();
+		return *this;
+	}
+
+	ColumnMajorIndex operator--(int){
+		ASSERT(linear_index_ > 0);
+		auto tmp = *this;
+		linear_index_--;
+		this->decrement_index_();
+		return tmp;
+	}
+
+	template<typename... Dims>
+	size_type operator()(const Dims... args) {
+		static_assert(sizeof...(args) == N);
+		indexes_ = {static_cast<size_type>(args)...};
+		linear_index_ = 0;
+		for(size_type i = 0; i < N; ++i) {
+			ASSERT(indexes_[i] < shapes_[i]);
+			linear_index_ += indexes_[i] * strides_[i];
+		}
+		return linear_index_;
+	}
+
+	size_type operator[](const size_type rank) const {
+		ASSERT(rank < N);
+		return indexes_[rank];
+	}
+
+	// ====================================================
+	// Conversion
+	// ====================================================
+
+	/** Implicit conversion to single index
+	 */
+	operator size_type() const {
+		return linear_index_;
+	}
+
+
+	// ====================================================
+	// Query
+	// ====================================================
+
+	size_type size() const {
+		size_type sz = 1;
+		for(size_type i = 0; i < N; ++i) {
+			sz *= shapes_[i];
+		}
+		return sz;
+	}
+
+	size_type shape(const size_type i) const {
+		ASSERT(i < N);
+		return shapes_[i];
+	}
+
+	size_type stride(const size_type i) const {
+		ASSERT(i < N);
+		return strides_[i];
+	}
+
+	size_type index(const size_type i) const {
+		ASSERT(i < N);
+		return indexes_[i];
+	}
+
+
+	// ====================================================
+	// PRIVATE
+	// ====================================================
+
+private:
+	std::array<size_type,N> shapes_;
+	std::array<size_type,N> strides_;
+	std::array<size_type,N> indexes_;
+	size_type               linear_index_;
+
+
+	void calc_stride_() {
+		strides_[0] = 1;
+		for(size_type i = 1; i < N; ++i) {
+			strides_[i] = strides_[i-1] * shapes_[i-1];
+		}
+	}
+
+	void calc_index_() {
+		size_type fac = 1;
+		for(size_type i = 0; i < (N-1); ++i) {
+			indexes_[i] = (linear_index_ / fac) % shapes_[i];
+			fac *= shapes_[i];
+		}
+		indexes_[N-1] = linear_index_ / fac;
+	}
+
+	// Odometer step with the carry moving towards rank N-1
+	void increment_index_() {
+		for(size_type i = 0; i < (N-1); ++i) {
+			if( ++indexes_[i] < shapes_[i] ) {
+				return;
+			}
+			indexes_[i] = 0;
+		}
+		++indexes_[N-1];
+	}
+
+	void decrement_index_() {
+		for(size_type i = 0; i < (N-1); ++i) {
+			if( indexes_[i]-- > 0 ) {
+				return;
+			}
+			indexes_[i] = shapes_[i] - 1;
+		}
+		--indexes_[N-1];
+	}
+
 };
 
 
+/// Row major index visiting a shape one tile at a time
+/**
+ * Tiles are visited in row major order and the points within each
+ * tile are visited in row major order. Tiles along the upper edge
+ * of each rank are clipped to the shape. The conversion to size_type
+ * returns the row major linear index into the full shape.
+ *
+ * Incrementing past the final point leaves the index at its end
+ * where count() == size().
+ *
+ * \code
+ * TiledRowMajorIndex<3> index({nx,ny,nz}, {8,8,64});
+ * for(; index.count() < index.size(); ++index){
+ *    b[index] = a[index];
+ * }
+ * \endcode
+ */
+template<std::size_t N>
+class TiledRowMajorIndex final {
+	static_assert(N > 0, "Cannot have 0 Rank Index");
+
+public:
+
+	// ====================================================
+	// Types
+	// ====================================================
+
+	using size_type  = std::size_t;
+
+	// ====================================================
+	// Constructors
+	// ====================================================
+
+	TiledRowMajorIndex()                                  = delete;
+	TiledRowMajorIndex(const TiledRowMajorIndex& other)   = default;
+	TiledRowMajorIndex(TiledRowMajorIndex&& other)        = default;
+	~TiledRowMajorIndex()                                 = default;
+
+	TiledRowMajorIndex(const std::array<size_type,N> shape, const std::array<size_type,N> tile) :
+		shapes_(shape),
+		tiles_(tile),
+		count_(0){
+		for(size_type i = 0; i < N; ++i) {
+			ASSERT(tiles_[i] > 0);
+		}
+		strides_[N-1] = 1;
+		for(size_type i = (N-1); i--> 0;) {
+			strides_[i] = strides_[i+1] * shapes_[i+1];
+		}
+		lower_.fill(0);
+		this->enter_tile_();
+	}
+
+	// ====================================================
+	// Operators
+	// ====================================================
+
+	TiledRowMajorIndex& operator=(const TiledRowMajorIndex& other) = default;
+	TiledRowMajorIndex& operator=(TiledRowMajorIndex&& other)      = default;
+
+	TiledRowMajorIndex& operator++(){
+		ASSERT(count_ < size());
+		++count_;
+		if( ++indexes_[N-1] < upper_[N-1] ) {
+			++linear_index_;
+			return *this;
+		}
+		indexes_[N-1] = lower_[N-1];
+		for(size_type i = (N-1); i--> 0;) {
+			if( ++indexes_[i] < upper_[i] ) {
+				this->calc_linear_();
+				return *this;
+			}
+			indexes_[i] = lower_[i];
+		}
+		this->next_tile_();
+		return *this;
+	}
+
+	TiledRowMajorIndex operator++(int){
+		auto tmp = *this;
+		++(*this);
+		return tmp;
+	}
+
+	size_type operator[](const size_type rank) const {
+		ASSERT(rank < N);
+		return indexes_[rank];
+	}
+
+	// ====================================================
+	// Conversion
+	// ====================================================
+
+	/** Implicit conversion to row major linear index
+	 */
+	operator size_type() const {
+		return linear_index_;
+	}
+
+	// ====================================================
+	// Query
+	// ====================================================
+
+	size_type size() const {
+		size_type sz = 1;
+		for(size_type i = 0; i < N; ++i) {
+			sz *= shapes_[i];
+		}
+		return sz;
+	}
+
+	/** Number of points visited before the current point
+	 */
+	size_type count() const {
+		return count_;
+	}
+
+	size_type shape(const size_type i) const {
+		ASSERT(i < N);
+		return shapes_[i];
+	}
+
+	size_type stride(const size_type i) const {
+		ASSERT(i < N);
+		return strides_[i];
+	}
+
+	size_type tile(const size_type i) const {
+		ASSERT(i < N);
+		return tiles_[i];
+	}
+
+	size_type index(const size_type i) const {
+		ASSERT(i < N);
+		return indexes_[i];
+	}
+
+	// ====================================================
+	// PRIVATE
+	// ====================================================
+
+private:
+	std::array<size_type,N> shapes_;
+	std::array<size_type,N> strides_;
+	std::array<size_type,N> tiles_;
+	std::array<size_type,N> lower_;
+	std::array<size_type,N> upper_;
+	std::array<size_type,N> indexes_;
+	size_type               linear_index_;
+	size_type               count_;
+
+	void calc_linear_() {
+		linear_index_ = 0;
+		for(size_type i = 0; i < N; ++i) {
+			linear_index_ += indexes_[i] * strides_[i];
+		}
+	}
+
+	void enter_tile_() {
+		for(size_type i = 0; i < N; ++i) {
+			upper_[i] = std::min(lower_[i] + tiles_[i], shapes_[i]);
+		}
+		indexes_ = lower_;
+		this->calc_linear_();
+	}
+
+	void next_tile_() {
+		for(size_type i = N; i--> 1;) {
+			lower_[i] += tiles_[i];
+			if( lower_[i] < shapes_[i] ) {
+				this->enter_tile_();
+				return;
+			}
+			lower_[i] = 0;
+		}
+		lower_[0] += tiles_[0];
+		this->enter_tile_();
+	}
+
+};
+
+
+/// Row major index visiting a strided box within a shape
+/**
+ * Visits the points lower[i] + k*step[i] for k < extent[i] in row
+ * major order. The conversion to size_type returns the row major
+ * linear index into the full shape.
+ *
+ * Incrementing past the final point leaves the index at its end
+ * where count() == size().
+ *
+ * \code
+ * // Every other interior point of a 3-D grid
+ * StridedRowMajorIndex<3> index({nx,ny,nz}, {1,1,1}, {(nx-1)/2,(ny-1)/2,(nz-1)/2}, {2,2,2});
+ * for(; index.count() < index.size(); ++index){
+ *    b[index] = a[index];
+ * }
+ * \endcode
+ */
+template<std::size_t N>
+class StridedRowMajorIndex final {
+	static_assert(N > 0, "Cannot have 0 Rank Index");
+
+public:
+
+	// ====================================================
+	// Types
+	// ====================================================
+
+	using size_type  = std::size_t;
+
+	// ====================================================
+	// Constructors
+	// ====================================================
+
+	StridedRowMajorIndex()                                    = delete;
+	StridedRowMajorIndex(const StridedRowMajorIndex& other)   = default;
+	StridedRowMajorIndex(StridedRowMajorIndex&& other)        = default;
+	~StridedRowMajorIndex()                                   = default;
+
+	StridedRowMajorIndex(const std::array<size_type,N> shape,
+	                     const std::array<size_type,N> lower,
+	                     const std::array<size_type,N> extent,
+	                     const std::array<size_type,N> step) :
+		shapes_(shape),
+		lower_(lower),
+		extents_(extent),
+		steps_(step),
+		indexes_(lower),
+		count_(0){
+		for(size_type i = 0; i < N; ++i) {
+			ASSERT(steps_[i] > 0);
+			ASSERT(extents_[i] == 0 || (lower_[i] + (extents_[i]-1) * steps_[i]) < shapes_[i]);
+		}
+		strides_[N-1] = 1;
+		for(size_type i = (N-1); i--> 0;) {
+			strides_[i] = strides_[i+1] * shapes_[i+1];
+		}
+		this->calc_linear_();
+	}
+
+	// ====================================================
+	// Operators
+	// ====================================================
+
+	StridedRowMajorIndex& operator=(const StridedRowMajorIndex& other) = default;
+	StridedRowMajorIndex& operator=(StridedRowMajorIndex&& other)      = default;
+
+	StridedRowMajorIndex& operator++(){
+		ASSERT(count_ < size());
+		++count_;
+		indexes_[N-1] += steps_[N-1];
+		if( indexes_[N-1] < upper_(N-1) ) {
+			linear_index_ += steps_[N-1];
+			return *this;
+		}
+		for(size_type i = (N-1); i--> 0;) {
+			indexes_[i+1] = lower_[i+1];
+			indexes_[i]  += steps_[i];
+			if( indexes_[i] < upper_(i) ) {
+				break;
+			}
+		}
+		this->calc_linear_();
+		return *this;
+	}
+
+	StridedRowMajorIndex operator++(int){
+		auto tmp = *this;
+		++(*this);
+		return tmp;
+	}
+
+	size_type operator[](const size_type rank) const {
+		ASSERT(rank < N);
+		return indexes_[rank];
+	}
+
+	// ====================================================
+	// Conversion
+	// ====================================================
+
+	/** Implicit conversion to row major linear index
+	 */
+	operator size_type() const {
+		return linear_index_;
+	}
+
+	// ====================================================
+	// Query
+	// ====================================================
+
+	/** Number of points within the box
+	 */
+	size_type size() const {
+		size_type sz = 1;
+		for(size_type i = 0; i < N; ++i) {
+			sz *= extents_[i];
+		}
+		return sz;
+	}
+
+	/** Number of points visited before the current point
+	 */
+	size_type count() const {
+		return count_;
+	}
+
+	size_type shape(const size_type i) const {
+		ASSERT(i < N);
+		return shapes_[i];
+	}
+
+	size_type stride(const size_type i) const {
+		ASSERT(i < N);
+		return strides_[i];
+	}
+
+	size_type lower(const size_type i) const {
+		ASSERT(i < N);
+		return lower_[i];
+	}
+
+	size_type extent(const size_type i) const {
+		ASSERT(i < N);
+		return extents_[i];
+	}
+
+	size_type step(const size_type i) const {
+		ASSERT(i < N);
+		return steps_[i];
+	}
+
+	size_type index(const size_type i) const {
+		ASSERT(i < N);
+		return indexes_[i];
+	}
+
+	// ====================================================
+	// PRIVATE
+	// ====================================================
+
+private:
+	std::array<size_type,N> shapes_;
+	std::array<size_type,N> strides_;
+	std::array<size_type,N> lower_;
+	std::array<size_type,N> extents_;
+	std::array<size_type,N> steps_;
+	std::array<size_type,N> indexes_;
+	size_type               linear_index_;
+	size_type               count_;
+
+	size_type upper_(const size_type i) const {
+		return lower_[i] + extents_[i] * steps_[i];
+	}
+
+	void calc_linear_() {
+		linear_index_ = 0;
+		for(size_type i = 0; i < N; ++i) {
+			linear_index_ += indexes_[i] * strides_[i];
+		}
+	}
+
+};
+
+
+/// @cond SKIP_DETAIL
+namespace detail {
+
+/// Bits of the code taken by coordinate rank (rank 0 is most significant)
+template<std::size_t N>
+constexpr std::uint64_t morton_mask(const std::size_t rank) noexcept {
+	std::uint64_t mask = 0;
+	for(std::size_t b = 0; b < (64 / N); ++b) {
+		mask |= std::uint64_t(1) << (b * N + (N - 1 - rank));
+	}
+	return mask;
+}
+
+/// Spread the bits of x to every N-th bit
+template<std::size_t N>
+inline std::uint64_t morton_spread(std::uint64_t x) noexcept {
+#if defined(XSTD_HAS_BMI2)
+	return _pdep_u64(x, morton_mask<N>(N-1));
+#else
+	if constexpr ( N == 1 ) {
+		return x;
+	}
+	else if constexpr ( N == 2 ) {
+		x &= 0x00000000FFFFFFFF;
+		x = (x | (x << 16)) & 0x0000FFFF0000FFFF;
+		x = (x | (x <<  8)) & 0x00FF00FF00FF00FF;
+		x = (x | (x <<  4)) & 0x0F0F0F0F0F0F0F0F;
+		x = (x | (x <<  2)) & 0x3333333333333333;
+		x = (x | (x <<  1)) & 0x5555555555555555;
+		return x;
+	}
+	else if constexpr ( N == 3 ) {
+		x &= 0x00000000001FFFFF;
+		x = (x | (x << 32)) & 0x001F00000000FFFF;
+		x = (x | (x << 16)) & 0x001F0000FF0000FF;
+		x = (x | (x <<  8)) & 0x100F00F00F00F00F;
+		x = (x | (x <<  4)) & 0x10C30C30C30C30C3;
+		x = (x | (x <<  2)) & 0x1249249249249249;
+		return x;
+	}
+	else {
+		std::uint64_t ans = 0;
+		for(std::size_t b = 0; b < (64 / N); ++b) {
+			ans |= ((x >> b) & 1) << (b * N);
+		}
+		return ans;
+	}
+#endif
+}
+
+/// Gather every N-th bit of x (inverse of morton_spread)
+template<std::size_t N>
+inline std::uint64_t morton_compact(std::uint64_t x) noexcept {
+#if defined(XSTD_HAS_BMI2)
+	return _pext_u64(x, morton_mask<N>(N-1));
+#else
+	if constexpr ( N == 1 ) {
+		return x;
+	}
+	else if constexpr ( N == 2 ) {
+		x &= 0x5555555555555555;
+		x = (x | (x >>  1)) & 0x3333333333333333;
+		x = (x | (x >>  2)) & 0x0F0F0F0F0F0F0F0F;
+		x = (x | (x >>  4)) & 0x00FF00FF00FF00FF;
+		x = (x | (x >>  8)) & 0x0000FFFF0000FFFF;
+		x = (x | (x >> 16)) & 0x00000000FFFFFFFF;
+		return x;
+	}
+	else if constexpr ( N == 3 ) {
+		x &= 0x1249249249249249;
+		x = (x | (x >>  2)) & 0x10C30C30C30C30C3;
+		x = (x | (x >>  4)) & 0x100F00F00F00F00F;
+		x = (x | (x >>  8)) & 0x001F0000FF0000FF;
+		x = (x | (x >> 16)) & 0x001F00000000FFFF;
+		x = (x | (x >> 32)) & 0x00000000001FFFFF;
+		return x;
+	}
+	else {
+		std::uint64_t ans = 0;
+		for(std::size_t b = 0; b < (64 / N); ++b) {
+			ans |= ((x >> (b * N)) & 1) << b;
+		}
+		return ans;
+	}
+#endif
+}
+
+/// Morton (Z-order) curve interleaving the coordinate bits
+/**
+ * Each coordinate takes only the bits needed by its own extent.
+ * The code holds bit b of every coordinate wide enough to have one
+ * before bit b+1 of any coordinate so a power of two box is
+ * numbered without gaps. The levels shared by every coordinate are
+ * interleaved with morton_spread and the remaining levels bit by
+ * bit.
+ */
+template<std::size_t N>
+struct morton_curve {
+	using size_type = std::size_t;
+
+	static std::array<size_type,N> bits(const std::array<size_type,N>& shape) noexcept {
+		std::array<size_type,N> ans;
+		for(size_type i = 0; i < N; ++i) {
+			ans[i] = static_cast<size_type>(std::bit_width(shape[i] - 1));
+		}
+		return ans;
+	}
+
+	static size_type encode(const std::array<size_type,N>& x, const std::array<size_type,N>& bits) noexcept {
+		const size_type shared = *std::min_element(bits.begin(), bits.end());
+		const size_type widest = *std::max_element(bits.begin(), bits.end());
+		const std::uint64_t low_mask = (std::uint64_t(1) << shared) - 1;
+
+		std::uint64_t code = 0;
+		for(size_type i = 0; i < N; ++i) {
+			code |= morton_spread<N>(x[i] & low_mask) << (N - 1 - i);
+		}
+		size_type pos = N * shared;
+		for(size_type b = shared; b < widest; ++b) {
+			for(size_type i = N; i--> 0;) {
+				if( bits[i] > b ) {
+					code |= ((std::uint64_t(x[i]) >> b) & 1) << pos++;
+				}
+			}
+		}
+		return static_cast<size_type>(code);
+	}
+
+	static std::array<size_type,N> decode(const size_type code, const std::array<size_type,N>& bits) noexcept {
+		const size_type shared = *std::min_element(bits.begin(), bits.end());
+		const size_type widest = *std::max_element(bits.begin(), bits.end());
+		const std::uint64_t low = std::uint64_t(code) & ((std::uint64_t(1) << (N * shared)) - 1);
+
+		std::array<size_type,N> x;
+		for(size_type i = 0; i < N; ++i) {
+			x[i] = static_cast<size_type>(morton_compact<N>(low >> (N - 1 - i)));
+		}
+		size_type pos = N * shared;
+		for(size_type b = shared; b < widest; ++b) {
+			for(size_type i = N; i--> 0;) {
+				if( bits[i] > b ) {
+					x[i] |= ((code >> pos++) & 1) << b;
+				}
+			}
+		}
+		return x;
+	}
+};
+
+/// Hilbert curve using the transpose algorithm of Skilling (2004)
+/**
+ * J. Skilling, "Programming the Hilbert curve",
+ * AIP Conference Proceedings 707, 381 (2004)
+ *
+ * The transposed form holds the Hilbert code with the bits spread
+ * over the coordinates as for the Morton curve. The curve covers
+ * a power of two cube so every coordinate takes the bits of the
+ * widest extent.
+ */
+template<std::size_t N>
+struct hilbert_curve {
+	using size_type = std::size_t;
+
+	static std::array<size_type,N> bits(const std::array<size_type,N>& shape) noexcept {
+		const auto widest = morton_curve<N>::bits(shape);
+		std::array<size_type,N> ans;
+		ans.fill(std::max<size_type>(1, *std::max_element(widest.begin(), widest.end())));
+		return ans;
+	}
+
+	static size_type encode(std::array<size_type,N> x, const std::array<size_type,N>& bits) noexcept {
+		if constexpr ( N > 1 ) {
+			const size_type M = size_type(1) << (bits[0] - 1);
+			for(size_type Q = M; Q > 1; Q >>= 1) {
+				const size_type P = Q - 1;
+				for(size_type i = 0; i < N; ++i) {
+					if( x[i] & Q ) {
+						x[0] ^= P;
+					}
+					else {
+						const size_type t = (x[0] ^ x[i]) & P;
+						x[0] ^= t;
+						x[i] ^= t;
+					}
+				}
+			}
+			for(size_type i = 1; i < N; ++i) {
+				x[i] ^= x[i-1];
+			}
+			size_type t = 0;
+			for(size_type Q = M; Q > 1; Q >>= 1) {
+				if( x[N-1] & Q ) {
+					t ^= Q - 1;
+				}
+			}
+			for(size_type i = 0; i < N; ++i) {
+				x[i] ^= t;
+			}
+		}
+		return morton_curve<N>::encode(x, bits);
+	}
+
+	static std::array<size_type,N> decode(const size_type code, const std::array<size_type,N>& bits) noexcept {
+		auto x = morton_curve<N>::decode(code, bits);
+		if constexpr ( N > 1 ) {
+			const size_type M = size_type(2) << (bits[0] - 1);
+			size_type t = x[N-1] >> 1;
+			for(size_type i = N-1; i > 0; --i) {
+				x[i] ^= x[i-1];
+			}
+			x[0] ^= t;
+			for(size_type Q = 2; Q != M; Q <<= 1) {
+				const size_type P = Q - 1;
+				for(size_type i = N; i--> 0;) {
+					if( x[i] & Q ) {
+						x[0] ^= P;
+					}
+					else {
+						t = (x[0] ^ x[i]) & P;
+						x[0] ^= t;
+						x[i] ^= t;
+					}
+				}
+			}
+		}
+		return x;
+	}
+};
+
+} /* namespace detail */
+/// @endcond
+
+
+/// Index ordering the points of a shape along a space filling curve
+/**
+ * The Morton curve covers the smallest power of two box containing
+ * the shape and the Hilbert curve the smallest power of two cube.
+ * The conversion to size_type returns the position along the curve
+ * which lies within [0,capacity()). Points of the curve outside the
+ * shape are skipped by the increment and decrement operators which
+ * jump over whole aligned blocks of the curve at a time.
+ *
+ * Incrementing past the final point leaves the index at its end
+ * where size_type(index) == capacity().
+ *
+ * \code
+ * MortonIndex<3> index({nx,ny,nz});
+ * std::vector<double> a(index.capacity());
+ * for(; index < index.capacity(); ++index){
+ *    a[index] = f(index[0], index[1], index[2]);
+ * }
+ * \endcode
+ */
+template<std::size_t N, typename Curve>
+class CurveIndex final {
+	static_assert(N > 0, "Cannot have 0 Rank Index");
+
+public:
+
+	// ====================================================
+	// Types
+	// ====================================================
+
+	using size_type  = std::size_t;
+
+	// ====================================================
+	// Constructors
+	// ====================================================
+
+	CurveIndex()                          = delete;
+	CurveIndex(const CurveIndex& other)   = default;
+	CurveIndex(CurveIndex&& other)        = default;
+	~CurveIndex()                         = default;
+
+	CurveIndex(const std::array<size_type,N> shape) :
+		shapes_(shape),
+		indexes_{},
+		bits_(Curve::bits(shape)),
+		code_(0),
+		total_bits_(0){
+		for(size_type i = 0; i < N; ++i) {
+			ASSERT(shapes_[i] > 0);
+			total_bits_ += bits_[i];
+		}
+		ASSERT(total_bits_ < 64);
+	}
+
+	// ====================================================
+	// Operators
+	// ====================================================
+
+	CurveIndex& operator=(const CurveIndex& other) = default;
+	CurveIndex& operator=(CurveIndex&& other)      = default;
+
+
+	CurveIndex& operator=(const size_type& index){
+		ASSERT(index < capacity());
+		code_ = index;
+		[[maybe_unused]] const size_type block = this->outside_block_();
+		ASSERT(block == 0);
+		return *this;
+	}
+
+	CurveIndex& operator++(){
+		ASSERT(code_ < capacity());
+		++code_;
+		while( code_ < capacity() ) {
+			const size_type block = this->outside_block_();
+			if( block == 0 ) {
+				break;
+			}
+			code_ = (code_ | (block - 1)) + 1;
+		}
+		return *this;
+	}
+
+	CurveIndex operator++(int){
+		auto tmp = *this;
+		++(*this);
+		return tmp;
+	}
+
+	CurveIndex& operator--(){
+		ASSERT(code_ > 0);
+		--code_;
+		while( true ) {
+			const size_type block = this->outside_block_();
+			if( block == 0 ) {
+				break;
+			}
+			code_ = (code_ & ~(block - 1)) - 1;
+		}
+		return *this;
+	}
+
+	CurveIndex operator--(int){
+		auto tmp = *this;
+		--(*this);
+		return tmp;
+	}
+
+	template<typename... Dims>
+	size_type operator()(const Dims... args) {
+		static_assert(sizeof...(args) == N);
+		indexes_ = {static_cast<size_type>(args)...};
+		for(size_type i = 0; i < N; ++i) {
+			ASSERT(indexes_[i] < shapes_[i]);
+		}
+		code_ = Curve::encode(indexes_, bits_);
+		return code_;
+	}
+
+	size_type operator[](const size_type rank) const {
+		ASSERT(rank < N);
+		return indexes_[rank];
+	}
+
+	// ====================================================
+	// Conversion
+	// ====================================================
+
+	/** Implicit conversion to position along the curve
+	 */
+	operator size_type() const {
+		return code_;
+	}
+
+	// ====================================================
+	// Query
+	// ====================================================
+
+	/** Number of points within the shape
+	 */
+	size_type size() const {
+		size_type sz = 1;
+		for(size_type i = 0; i < N; ++i) {
+			sz *= shapes_[i];
+		}
+		return sz;
+	}
+
+	/** Number of positions along the curve
+	 */
+	size_type capacity() const {
+		return size_type(1) << total_bits_;
+	}
+
+	/** Bits of coordinate i
+	 */
+	size_type bits(const size_type i) const {
+		ASSERT(i < N);
+		return bits_[i];
+	}
+
+	size_type shape(const size_type i) const {
+		ASSERT(i < N);
+		return shapes_[i];
+	}
+
+	size_type index(const size_type i) const {
+		ASSERT(i < N);
+		return indexes_[i];
+	}
+
+	// ====================================================
+	// PRIVATE
+	// ====================================================
+
+private:
+	std::array<size_type,N> shapes_;
+	std::array<size_type,N> indexes_;
+	std::array<size_type,N> bits_;
+	size_type               code_;
+	size_type               total_bits_;
+
+	// Decode code_ returning the length of the largest aligned block
+	// of the curve holding it and lying outside the shape (0 if inside)
+	size_type outside_block_() {
+		indexes_ = Curve::decode(code_, bits_);
+
+		// Block of levels below L covers coordinates with low L bits free
+		size_type levels  = 0;
+		bool      outside = false;
+		for(size_type i = 0; i < N; ++i) {
+			if( indexes_[i] >= shapes_[i] ) {
+				outside = true;
+				while( ((indexes_[i] >> (levels + 1)) << (levels + 1)) >= shapes_[i] ) {
+					++levels;
+				}
+			}
+		}
+		if( not outside ) {
+			return 0;
+		}
+		size_type block_bits = 0;
+		for(size_type i = 0; i < N; ++i) {
+			block_bits += std::min(bits_[i], levels);
+		}
+		return size_type(1) << block_bits;
+	}
+
+};
+
+/// Index ordering points along the Morton (Z-order) curve
+template<std::size_t N>
+using MortonIndex = CurveIndex<N, detail::morton_curve<N>>;
+
+/// Index ordering points along the Hilbert curve
+template<std::size_t N>
+using HilbertIndex = CurveIndex<N, detail::hilbert_curve<N>>;
+
+
 } /* namespace xstd */
 
 
@@ -0,0 +1,660 @@
+/**
+ * \file       ndarray.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_VECTOR_NDARRAY_HPP_
+#define INCLUDE_XSTD_DETAIL_VECTOR_NDARRAY_HPP_
+
+
+#include "xstd/assert.hpp"
+#include "xstd/detail/memory/aligned.hpp"
+#include "xstd/detail/memory/allocator/aligned_allocator.hpp"
+#include "xstd/detail/vector/multi_indexer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * ndarray.hpp
+ *
+ * \brief
+ * Multi-dimensional array owning aligned storage and strided views
+ *
+ * \details
+ * An ndarray<T,N,Layout> owns its values in a std::vector using the
+ * aligned_allocator and lays them out with the strides of a
+ * RowMajorIndex or ColumnMajorIndex. An ndarray_view<T,N> is a non
+ * owning pointer with extents and strides (similar to std::mdspan)
+ * which can be sliced along any rank.
+ *
+ * Element access multiplies the indices by the stored strides and
+ * never decomposes a linear index. The bulk fill, assign and
+ * transform operations walk the views in runs along the rank of
+ * smallest stride. Views packed with matching strides collapse to a
+ * single run which is copied with std::memcpy or evaluated by a
+ * unit stride loop the compiler vectorizes.
+ *
+ * \code
+ * xstd::ndarray<double,3> u({nx,ny,nz});
+ * u.fill(0);
+ * auto interior = u.view().slice(0, 1, nx-2).slice(1, 1, ny-2);
+ * interior.transform(other.view().slice(0, 1, nx-2).slice(1, 1, ny-2), [](double x){ return 2*x; });
+ * \endcode
+ */
+
+namespace xstd {
+
+template<typename T, std::size_t N>
+class ndarray_view;
+
+/// @cond SKIP_DETAIL
+namespace detail {
+
+template<std::size_t N>
+using ndarray_shape = std::array<std::size_t,N>;
+
+template<std::size_t N>
+std::size_t ndarray_size(const ndarray_shape<N>& shape) noexcept {
+	std::size_t ans = 1;
+	for(std::size_t i = 0; i < N; ++i){
+		ans *= shape[i];
+	}
+	return ans;
+}
+
+/// Strides of a multi_indexer Layout for shape
+template<template<std::size_t> class Layout, std::size_t N>
+ndarray_shape<N> ndarray_strides(ndarray_shape<N> shape) {
+	for(auto& s : shape){
+		s = std::max<std::size_t>(s, 1); // Layouts divide by each extent
+	}
+	const Layout<N> layout(shape);
+	ndarray_shape<N> ans;
+	for(std::size_t i = 0; i < N; ++i){
+		ans[i] = layout.stride(i);
+	}
+	return ans;
+}
+
+/// True if strides pack shape without gaps in row or column major order
+template<std::size_t N>
+bool ndarray_packed(const ndarray_shape<N>& shape, const ndarray_shape<N>& strides) noexcept {
+	if( ndarray_size(shape) == 0 ){
+		return true;
+	}
+	bool row = true;
+	bool col = true;
+	std::size_t row_expect = 1;
+	std::size_t col_expect = 1;
+	for(std::size_t i = 0; i < N; ++i){
+		const auto r = N - 1 - i;
+		row = row && ((shape[r] == 1) || (strides[r] == row_expect));
+		col = col && ((shape[i] == 1) || (strides[i] == col_expect));
+		row_expect *= shape[r];
+		col_expect *= shape[i];
+	}
+	return row || col;
+}
+
+/// Call run(ptrs,count,strides) for every run of equal shaped views
+/**
+ * Runs follow the rank with the smallest stride within the first
+ * view. Views which are all packed with matching strides form one
+ * run of unit stride.
+ */
+template<std::size_t N, typename Run, typename... T>
+void ndarray_for_each_run(const ndarray_shape<N>& shape, Run&& run, const ndarray_view<T,N>&... views) {
+	const auto count = ndarray_size(shape);
+	if( count == 0 ){
+		return;
+	}
+
+	const auto& first = std::get<0>(std::forward_as_tuple(views...));
+	bool single = (views.is_contiguous() && ...);
+	for(std::size_t i = 0; i < N; ++i){
+		if( shape[i] > 1 ){
+			single = single && ((views.stride(i) == first.stride(i)) && ...);
+		}
+	}
+	if( single ){
+		run(count, std::make_pair(views.data(), std::size_t(1))...);
+		return;
+	}
+
+	std::size_t inner = N - 1;
+	for(std::size_t i = 0; i < N; ++i){
+		if( (shape[i] > 1) && ((shape[inner] == 1) || (first.stride(i) < first.stride(inner))) ){
+			inner = i;
+		}
+	}
+
+	ndarray_shape<N> index{};
+	const auto runs = count / shape[inner];
+	for(std::size_t n = 0; n < runs; ++n){
+		run(shape[inner], std::make_pair(views.data() + views.offset(index), views.stride(inner))...);
+
+		// Odometer over every rank except the inner
+		for(std::size_t i = N; i--> 0;){
+			if( i == inner ){
+				continue;
+			}
+			if( ++index[i] < shape[i] ){
+				break;
+			}
+			index[i] = 0;
+		}
+	}
+}
+
+} /* namespace detail */
+/// @endcond
+
+
+/// Non-owning strided view of a multi-dimensional array
+/**
+ * \tparam T Type of each value (const T for read only views)
+ * \tparam N Number of ranks
+ */
+template<typename T, std::size_t N>
+class ndarray_view final {
+	STATIC_ASSERT(N > 0, "Cannot have 0 Rank View");
+
+public:
+
+	// ====================================================
+	// Types
+	// ====================================================
+
+	using element_type = T;
+	using value_type   = std::remove_cv_t<T>;
+	using size_type    = std::size_t;
+	using pointer      = T*;
+	using reference    = T&;
+	using shape_type   = std::array<size_type,N>;
+
+	static constexpr size_type rank = N;
+
+	// ====================================================
+	// Constructors
+	// ====================================================
+
+	ndarray_view() noexcept : data_(nullptr), shape_{}, strides_{} {
+	}
+
+	ndarray_view(pointer data, const shape_type& shape, const shape_type& strides) noexcept :
+		data_(data), shape_(shape), strides_(strides) {
+	}
+
+	/// Read only view of a writable view
+	template<typename U>
+	requires (std::is_convertible<U(*)[], T(*)[]>::value && not std::is_same<U,T>::value)
+	ndarray_view(const ndarray_view<U,N>& other) noexcept :
+		data_(other.data()), shape_(other.shape()), strides_(other.strides()) {
+	}
+
+	// ====================================================
+	// Element Access
+	// ====================================================
+
+	template<typename... Indices>
+	requires (sizeof...(Indices) == N)
+	reference operator()(const Indices... idx) const noexcept {
+		return data_[this->offset(shape_type{static_cast<size_type>(idx)...})];
+	}
+
+	reference operator[](const shape_type& idx) const noexcept {
+		return data_[this->offset(idx)];
+	}
+
+	pointer data() const noexcept {
+		return data_;
+	}
+
+	/** Offset in values from data() to the value at idx
+	 */
+	size_type offset(const shape_type& idx) const noexcept {
+		size_type ans = 0;
+		for(size_type i = 0; i < N; ++i){
+			ASSERT(idx[i] < shape_[i]);
+			ans += idx[i] * strides_[i];
+		}
+		return ans;
+	}
+
+	// ====================================================
+	// Query
+	// ====================================================
+
+	size_type size() const noexcept {
+		return detail::ndarray_size(shape_);
+	}
+
+	[[nodiscard]] bool empty() const noexcept {
+		return this->size() == 0;
+	}
+
+	size_type extent(const size_type i) const noexcept {
+		ASSERT(i < N);
+		return shape_[i];
+	}
+
+	size_type stride(const size_type i) const noexcept {
+		ASSERT(i < N);
+		return strides_[i];
+	}
+
+	const shape_type& shape() const noexcept {
+		return shape_;
+	}
+
+	const shape_type& strides() const noexcept {
+		return strides_;
+	}
+
+	/** True if the values are packed without gaps
+	 */
+	bool is_contiguous() const noexcept {
+		return detail::ndarray_packed(shape_, strides_);
+	}
+
+	// ====================================================
+	// Sub Views
+	// ====================================================
+
+	/** View of count indices along rank starting at first
+	 *
+	 * \param rank[in] Rank to slice
+	 * \param first[in] First index along rank
+	 * \param count[in] Number of indices within the slice
+	 * \param step[in] Distance between indices of the slice
+	 */
+	ndarray_view slice(const size_type rank, const size_type first, const size_type count, const size_type step = 1) const noexcept {
+		ASSERT(rank < N);
+		ASSERT(step > 0);
+		ASSERT((count == 0) || ((first + (count - 1) * step) < shape_[rank]));
+		auto ans = *this;
+		ans.data_          += first * strides_[rank];
+		ans.shape_[rank]    = count;
+		ans.strides_[rank] *= step;
+		return ans;
+	}
+
+	/** View with rank removed at the given index
+	 */
+	ndarray_view<T,N-1> subview(const size_type rank, const size_type index) const noexcept
+	requires (N > 1) {
+		ASSERT(rank < N);
+		ASSERT(index < shape_[rank]);
+		std::array<size_type,N-1> shape;
+		std::array<size_type,N-1> strides;
+		for(size_type i = 0, j = 0; i < N; ++i){
+			if( i != rank ){
+				shape[j]   = shape_[i];
+				strides[j] = strides_[i];
+				++j;
+			}
+		}
+		return ndarray_view<T,N-1>(data_ + index * strides_[rank], shape, strides);
+	}
+
+	// ====================================================
+	// Bulk Operations
+	// ====================================================
+
+	/** Set every value to value
+	 */
+	template<typename V>
+	void fill(const V& value) const {
+		detail::ndarray_for_each_run(shape_, [&](const size_type count, const auto d){
+			if( d.second == 1 ){
+				std::fill_n(d.first, count, value);
+			}
+			else {
+				for(size_type i = 0; i < count; ++i){
+					d.first[i * d.second] = value;
+				}
+			}
+		}, *this);
+	}
+
+	/** Copy the values of an equal shaped view
+	 *
+	 * The views must not overlap unless they are identical.
+	 */
+	template<typename U>
+	void assign(const ndarray_view<U,N>& src) const {
+		ASSERT(src.shape() == shape_);
+		using source_type = std::remove_cv_t<U>;
+		detail::ndarray_for_each_run(shape_, [&](const size_type count, const auto d, const auto s){
+			if( (d.second == 1) && (s.second == 1) ){
+				if constexpr ( std::is_same<source_type,value_type>::value && std::is_trivially_copyable<value_type>::value ) {
+					if( d.first != s.first ){
+						std::memcpy(d.first, s.first, count * sizeof(value_type));
+					}
+				}
+				else {
+					std::copy_n(s.first, count, d.first);
+				}
+			}
+			else {
+				for(size_type i = 0; i < count; ++i){
+					d.first[i * d.second] = s.first[i * s.second];
+				}
+			}
+		}, *this, ndarray_view<const U,N>(src));
+	}
+
+	/** Set every value to op(a) of the matching value of a
+	 */
+	template<typename U, typename Op>
+	void transform(const ndarray_view<U,N>& a, Op op) const {
+		ASSERT(a.shape() == shape_);
+		detail::ndarray_for_each_run(shape_, [&](const size_type count, const auto d, const auto x){
+			if( (d.second == 1) && (x.second == 1) ){
+				for(size_type i = 0; i < count; ++i){
+					d.first[i] = op(x.first[i]);
+				}
+			}
+			else {
+				for(size_type i = 0; i < count; ++i){
+					d.first[i * d.second] = op(x.first[i * x.second]);
+				}
+			}
+		}, *this, ndarray_view<const U,N>(a));
+	}
+
+	/** Set every value to op(a,b) of the matching values of a and b
+	 */
+	template<typename U1, typename U2, typename Op>
+	void transform(const ndarray_view<U1,N>& a, const ndarray_view<U2,N>& b, Op op) const {
+		ASSERT(a.shape() == shape_);
+		ASSERT(b.shape() == shape_);
+		detail::ndarray_for_each_run(shape_, [&](const size_type count, const auto d, const auto x, const auto y){
+			if( (d.second == 1) && (x.second == 1) && (y.second == 1) ){
+				for(size_type i = 0; i < count; ++i){
+					d.first[i] = op(x.first[i], y.first[i]);
+				}
+			}
+			else {
+				for(size_type i = 0; i < count; ++i){
+					d.first[i * d.second] = op(x.first[i * x.second], y.first[i * y.second]);
+				}
+			}
+		}, *this, ndarray_view<const U1,N>(a), ndarray_view<const U2,N>(b));
+	}
+
+	// ====================================================
+	// PRIVATE
+	// ====================================================
+
+private:
+	pointer    data_;
+	shape_type shape_;
+	shape_type strides_;
+};
+
+
+/// Multi-dimensional array with aligned storage
+/**
+ * \code
+ * xstd::ndarray<double,3> u({nx,ny,nz});
+ * for(std::size_t i = 0; i < nx; ++i){
+ *    for(std::size_t j = 0; j < ny; ++j){
+ *       for(std::size_t k = 0; k < nz; ++k){
+ *          u(i,j,k) = f(i,j,k);
+ *       }
+ *    }
+ * }
+ * \endcode
+ *
+ * \tparam T Type of each value
+ * \tparam N Number of ranks
+ * \tparam Layout Multi indexer providing the strides (RowMajorIndex or ColumnMajorIndex)
+ * \tparam Alignment Alignment in bytes of the storage
+ */
+template<typename T, std::size_t N, template<std::size_t> class Layout = RowMajorIndex, std::size_t Alignment = 64>
+class ndarray final {
+	STATIC_ASSERT(N > 0, "Cannot have 0 Rank Array");
+
+public:
+
+	// ====================================================
+	// Types
+	// ====================================================
+
+	using value_type      = T;
+	using size_type       = std::size_t;
+	using allocator_type  = aligned_allocator<T,Alignment>;
+	using storage_type    = std::vector<T,allocator_type>;
+	using reference       = T&;
+	using const_reference = const T&;
+	using iterator        = typename storage_type::iterator;
+	using const_iterator  = typename storage_type::const_iterator;
+	using shape_type      = std::array<size_type,N>;
+	using view_type       = ndarray_view<T,N>;
+	using const_view_type = ndarray_view<const T,N>;
+
+	static constexpr size_type rank      = N;
+	static constexpr size_type alignment = std::max(Alignment, alignof(T));
+
+	// ====================================================
+	// Constructors
+	// ====================================================
+
+	ndarray() : shape_{}, strides_(detail::ndarray_strides<Layout>(shape_)) {
+	}
+
+	explicit ndarray(const shape_type& shape) :
+		shape_(shape),
+		strides_(detail::ndarray_strides<Layout>(shape)),
+		values_(detail::ndarray_size(shape)) {
+	}
+
+	ndarray(const shape_type& shape, const T& value) :
+		shape_(shape),
+		strides_(detail::ndarray_strides<Layout>(shape)),
+		values_(detail::ndarray_size(shape), value) {
+	}
+
+	// ====================================================
+	// Element Access
+	// ====================================================
+
+	template<typename... Indices>
+	requires (sizeof...(Indices) == N)
+	reference operator()(const Indices... idx) noexcept {
+		return values_[this->offset(shape_type{static_cast<size_type>(idx)...})];
+	}
+
+	template<typename... Indices>
+	requires (sizeof...(Indices) == N)
+	const_reference operator()(const Indices... idx) const noexcept {
+		return values_[this->offset(shape_type{static_cast<size_type>(idx)...})];
+	}
+
+	reference operator[](const shape_type& idx) noexcept {
+		return values_[this->offset(idx)];
+	}
+
+	const_reference operator[](const shape_type& idx) const noexcept {
+		return values_[this->offset(idx)];
+	}
+
+	T* data() noexcept {
+		return assume_aligned<alignment>(values_.data());
+	}
+
+	const T* data() const noexcept {
+		return assume_aligned<alignment>(values_.data());
+	}
+
+	/** Offset in values from data() to the value at idx
+	 */
+	size_type offset(const shape_type& idx) const noexcept {
+		size_type ans = 0;
+		for(size_type i = 0; i < N; ++i){
+			ASSERT(idx[i] < shape_[i]);
+			ans += idx[i] * strides_[i];
+		}
+		return ans;
+	}
+
+	// ====================================================
+	// Views
+	// ====================================================
+
+	view_type view() noexcept {
+		return view_type(values_.data(), shape_, strides_);
+	}
+
+	const_view_type view() const noexcept {
+		return const_view_type(values_.data(), shape_, strides_);
+	}
+
+	operator view_type() noexcept {
+		return this->view();
+	}
+
+	operator const_view_type() const noexcept {
+		return this->view();
+	}
+
+	// ====================================================
+	// Iterators (Storage Order)
+	// ====================================================
+
+	iterator begin() noexcept { return values_.begin(); }
+	iterator end() noexcept { return values_.end(); }
+	const_iterator begin() const noexcept { return values_.begin(); }
+	const_iterator end() const noexcept { return values_.end(); }
+	const_iterator cbegin() const noexcept { return values_.cbegin(); }
+	const_iterator cend() const noexcept { return values_.cend(); }
+
+	// ====================================================
+	// Query
+	// ====================================================
+
+	size_type size() const noexcept {
+		return values_.size();
+	}
+
+	[[nodiscard]] bool empty() const noexcept {
+		return values_.empty();
+	}
+
+	size_type extent(const size_type i) const noexcept {
+		ASSERT(i < N);
+		return shape_[i];
+	}
+
+	size_type stride(const size_type i) const noexcept {
+		ASSERT(i < N);
+		return strides_[i];
+	}
+
+	const shape_type& shape() const noexcept {
+		return shape_;
+	}
+
+	const shape_type& strides() const noexcept {
+		return strides_;
+	}
+
+	// ====================================================
+	// Modifiers
+	// ====================================================
+
+	/** Change the shape
+	 *
+	 * Values are kept in storage order and are not moved to
+	 * their previous indices.
+	 */
+	void resize(const shape_type& shape) {
+		values_.resize(detail::ndarray_size(shape));
+		shape_   = shape;
+		strides_ = detail::ndarray_strides<Layout>(shape);
+	}
+
+	void fill(const T& value) {
+		std::fill(values_.begin(), values_.end(), value);
+	}
+
+	template<typename U>
+	void assign(const ndarray_view<U,N>& src) {
+		this->view().assign(src);
+	}
+
+	template<typename U, typename Op>
+	void transform(const ndarray_view<U,N>& a, Op op) {
+		this->view().transform(a, op);
+	}
+
+	template<typename U1, typename U2, typename Op>
+	void transform(const ndarray_view<U1,N>& a, const ndarray_view<U2,N>& b, Op op) {
+		this->view().transform(a, b, op);
+	}
+
+	template<typename U, template<std::size_t> class L, std::size_t A>
+	void assign(const ndarray<U,N,L,A>& src) {
+		this->view().assign(src.view());
+	}
+
+	template<typename U, template<std::size_t> class L, std::size_t A, typename Op>
+	void transform(const ndarray<U,N,L,A>& a, Op op) {
+		this->view().transform(a.view(), op);
+	}
+
+	template<typename U1, template<std::size_t> class L1, std::size_t A1,
+	         typename U2, template<std::size_t> class L2, std::size_t A2, typename Op>
+	void transform(const ndarray<U1,N,L1,A1>& a, const ndarray<U2,N,L2,A2>& b, Op op) {
+		this->view().transform(a.view(), b.view(), op);
+	}
+
+	template<typename U1, typename U2, template<std::size_t> class L2, std::size_t A2, typename Op>
+	void transform(const ndarray_view<U1,N>& a, const ndarray<U2,N,L2,A2>& b, Op op) {
+		this->view().transform(a, b.view(), op);
+	}
+
+	template<typename U1, template<std::size_t> class L1, std::size_t A1, typename U2, typename Op>
+	void transform(const ndarray<U1,N,L1,A1>& a, const ndarray_view<U2,N>& b, Op op) {
+		this->view().transform(a.view(), b, op);
+	}
+
+	void swap(ndarray& other) noexcept {
+		std::swap(shape_, other.shape_);
+		std::swap(strides_, other.strides_);
+		values_.swap(other.values_);
+	}
+
+	friend bool operator==(const ndarray& a, const ndarray& b) {
+		return (a.shape_ == b.shape_) && (a.values_ == b.values_);
+	}
+
+	// ====================================================
+	// PRIVATE
+	// ====================================================
+
+private:
+	shape_type   shape_;
+	shape_type   strides_;
+	storage_type values_;
+};
+
+template<typename T, std::size_t N, template<std::size_t> class L, std::size_t A>
+void swap(ndarray<T,N,L,A>& a, ndarray<T,N,L,A>& b) noexcept {
+	a.swap(b);
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_VECTOR_NDARRAY_HPP_ */
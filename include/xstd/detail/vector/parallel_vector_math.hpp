@@ -0,0 +1,271 @@
+/**
+ * \file       parallel_vector_math.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_VECTOR_PARALLEL_VECTOR_MATH_HPP_
+#define INCLUDE_XSTD_DETAIL_VECTOR_PARALLEL_VECTOR_MATH_HPP_
+
+
+#include "xstd/assert.hpp"
+#include "xstd/detail/thread/thread_pool.hpp"
+#include "xstd/detail/vector/simd_reduce.hpp"
+#include "xstd/detail/vector/vector_expression.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+/**
+ * \file
+ * parallel_vector_math.hpp
+ *
+ * \brief
+ * Multithreaded evaluation of std::vector math
+ *
+ * \details
+ * Overloads of xstd::assign, xstd::eval and the reductions of
+ * vector_math.hpp taking a parallel_policy as their first argument.
+ * The range is split into fixed size chunks which are handed out to
+ * the threads of a thread_pool.
+ *
+ * Each chunk of a reduction produces a partial result which is
+ * stored by chunk index and the partials are then combined with a
+ * fixed pairwise tree. Chunk boundaries depend only on the vector
+ * length and chunk size so the result is identical for any number
+ * of threads.
+ *
+ * \code
+ * xstd::thread_pool pool;
+ * const auto policy = xstd::par(pool);
+ * xstd::assign(policy, r, r - alpha*q);
+ * const auto rr = xstd::dot_product(policy, r, r);
+ * \endcode
+ */
+
+namespace xstd {
+
+/// Execution policy running vector math on the threads of a pool
+class parallel_policy final {
+public:
+
+	/// Elements per chunk (256 KiB of doubles)
+	static constexpr std::size_t default_chunk_size = 32768;
+
+	/** Construct policy using the threads of pool
+	 *
+	 * \param pool[in] Threads executing the chunks
+	 * \param chunk_size[in] Number of elements within each chunk
+	 */
+	explicit parallel_policy(thread_pool& pool, const std::size_t chunk_size = default_chunk_size) noexcept
+		: pool_(&pool), chunk_size_(chunk_size) {
+		ASSERT(chunk_size_ > 0);
+	}
+
+	thread_pool& pool() const noexcept {
+		return *pool_;
+	}
+
+	std::size_t chunk_size() const noexcept {
+		return chunk_size_;
+	}
+
+private:
+	thread_pool* pool_;
+	std::size_t  chunk_size_;
+};
+
+/// Parallel policy using the threads of pool
+inline parallel_policy par(thread_pool& pool) noexcept {
+	return parallel_policy(pool);
+}
+
+/// @cond SKIP_DETAIL
+namespace detail {
+
+template<typename T>
+using vector_value_t = typename std::remove_cvref_t<T>::value_type;
+
+/// Call f(first,last) for every chunk of [0,n)
+template<typename Function>
+void parallel_chunks(const parallel_policy& policy, const std::size_t n, Function&& f) {
+	const auto chunk      = policy.chunk_size();
+	const auto num_chunks = (n + chunk - 1) / chunk;
+	policy.pool().parallel_for(num_chunks, [&](const std::size_t c){
+		f(c * chunk, std::min(n, (c + 1) * chunk));
+	});
+}
+
+/// Reduce every chunk of [0,n) and combine the partials pairwise
+/**
+ * Partials are combined as ((p0,p1),(p2,p3)),... in chunk order
+ * which does not depend on the threads executing the chunks.
+ */
+template<typename T, typename Reduce, typename Combine>
+T parallel_reduce(const parallel_policy& policy, const std::size_t n, const T init, Reduce&& reduce, Combine&& combine) {
+	const auto chunk      = policy.chunk_size();
+	const auto num_chunks = (n + chunk - 1) / chunk;
+	if( num_chunks == 0 ){
+		return init;
+	}
+
+	std::vector<T> partial(num_chunks);
+	policy.pool().parallel_for(num_chunks, [&](const std::size_t c){
+		partial[c] = reduce(c * chunk, std::min(n, (c + 1) * chunk));
+	});
+
+	for(std::size_t stride = 1; stride < num_chunks; stride *= 2){
+		for(std::size_t i = 0; i + stride < num_chunks; i += 2 * stride){
+			partial[i] = combine(partial[i], partial[i + stride]);
+		}
+	}
+	return partial[0];
+}
+
+/// Pointer to the data of a std::vector operand of type T (nullptr otherwise)
+template<typename T, typename V>
+const T* simd_operand_data(const V& v) noexcept {
+	if constexpr ( is_std_vector<V>::value ) {
+		if constexpr ( std::is_same<typename V::value_type, T>::value ) {
+			return v.data();
+		}
+	}
+	return nullptr;
+}
+
+} /* namespace detail */
+/// @endcond
+
+
+// ============================================================
+//                    Parallel Evaluation
+// ============================================================
+
+/// Assign an expression into an existing vector using the threads of policy
+/**
+ * Parallel version of xstd::assign. The destination may also appear
+ * within the expression.
+ *
+ * \param policy[in] Threads and chunk size to use
+ * \param dest[out] Vector to hold the result
+ * \param expr[in] Expression to evaluate
+ */
+template<typename T, typename A, typename Expression>
+void assign(const parallel_policy& policy, std::vector<T,A>& dest, const vector_expression<Expression>& expr){
+	const auto& e = expr.derived();
+	const auto  n = e.size();
+	if( dest.size() != n ){
+		dest.resize(n);
+	}
+	detail::parallel_chunks(policy, n, [&](const std::size_t first, const std::size_t last){
+		for(std::size_t i = first; i < last; ++i){
+			dest[i] = static_cast<T>(e[i]);
+		}
+	});
+}
+
+/// Evaluate an expression into a std::vector using the threads of policy
+template<typename Expression>
+std::vector<typename Expression::value_type> eval(const parallel_policy& policy, const vector_expression<Expression>& expr){
+	std::vector<typename Expression::value_type> ans;
+	assign(policy, ans, expr);
+	return ans;
+}
+
+
+// ============================================================
+//                    Parallel Reductions
+// ============================================================
+
+/// Dot product of vectors or expressions using the threads of policy
+/**
+ * Chunks of float and double vectors use the SIMD kernels of
+ * simd_reduce.hpp when summation::fast is requested.
+ */
+template<typename L, typename R>
+requires (detail::vector_operand<L> && detail::vector_operand<R>)
+std::common_type_t<detail::vector_value_t<L>, detail::vector_value_t<R>>
+dot_product(const parallel_policy& policy, const L& a, const R& b, const summation mode = summation::deterministic){
+	using value_type = std::common_type_t<detail::vector_value_t<L>, detail::vector_value_t<R>>;
+	ASSERT(a.size() == b.size());
+	return detail::parallel_reduce(policy, a.size(), value_type(0),
+		[&](const std::size_t first, const std::size_t last){
+			if constexpr ( detail::simd_reducible<value_type> ) {
+				const auto pa = detail::simd_operand_data<value_type>(a);
+				const auto pb = detail::simd_operand_data<value_type>(b);
+				if( pa && pb && (mode == summation::fast) ){
+					return detail::simd_dot(pa + first, pb + first, last - first);
+				}
+			}
+			value_type ans(0);
+			for(std::size_t i = first; i < last; ++i){
+				ans += (a[i] * b[i]);
+			}
+			return ans;
+		},
+		[](const value_type x, const value_type y){ return x + y; });
+}
+
+/// Sum of absolute values using the threads of policy
+template<typename V>
+requires detail::vector_operand<V>
+detail::vector_value_t<V>
+norm1(const parallel_policy& policy, const V& a, const summation mode = summation::deterministic){
+	using value_type = detail::vector_value_t<V>;
+	return detail::parallel_reduce(policy, a.size(), value_type(0),
+		[&](const std::size_t first, const std::size_t last){
+			using std::abs;
+			if constexpr ( detail::simd_reducible<value_type> ) {
+				const auto pa = detail::simd_operand_data<value_type>(a);
+				if( pa && (mode == summation::fast) ){
+					return detail::simd_asum(pa + first, last - first);
+				}
+			}
+			value_type ans(0);
+			for(std::size_t i = first; i < last; ++i){
+				ans += abs(a[i]);
+			}
+			return ans;
+		},
+		[](const value_type x, const value_type y){ return x + y; });
+}
+
+/// Euclidean norm using the threads of policy
+template<typename V>
+requires detail::vector_operand<V>
+detail::vector_value_t<V>
+norm2(const parallel_policy& policy, const V& a, const summation mode = summation::deterministic){
+	using std::sqrt;
+	return sqrt(dot_product(policy, a, a, mode));
+}
+
+/// Maximum absolute value using the threads of policy
+template<typename V>
+requires detail::vector_operand<V>
+detail::vector_value_t<V>
+norm_inf(const parallel_policy& policy, const V& a){
+	using value_type = detail::vector_value_t<V>;
+	return detail::parallel_reduce(policy, a.size(), value_type(0),
+		[&](const std::size_t first, const std::size_t last){
+			using std::abs;
+			if constexpr ( detail::simd_reducible<value_type> ) {
+				if( const auto pa = detail::simd_operand_data<value_type>(a) ){
+					return detail::simd_amax(pa + first, last - first);
+				}
+			}
+			value_type ans(0);
+			for(std::size_t i = first; i < last; ++i){
+				ans = detail::nan_max(ans, value_type(abs(a[i])));
+			}
+			return ans;
+		},
+		[](const value_type x, const value_type y){ return detail::nan_max(x, y); });
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_VECTOR_PARALLEL_VECTOR_MATH_HPP_ */
@@ -0,0 +1,543 @@
+/**
+ * \file       simd_reduce.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_VECTOR_SIMD_REDUCE_HPP_
+#define INCLUDE_XSTD_DETAIL_VECTOR_SIMD_REDUCE_HPP_
+
+
+#include "xstd/detail/config/inline.hpp"
+#include "xstd/detail/config/restrict.hpp"
+#include "xstd/detail/config/simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#if defined(XSTD_HAS_TARGET_DISPATCH)
+#include <immintrin.h>
+#endif
+
+/**
+ * \file
+ * simd_reduce.hpp
+ *
+ * \brief
+ * SIMD reductions over contiguous float and double arrays
+ *
+ * \details
+ * Dot product, sum of absolute values and maximum absolute value
+ * kernels for SSE2, AVX2 (with FMA) and AVX-512. Each kernel keeps
+ * four independent accumulators so consecutive fused multiply-adds
+ * do not wait on each other. The kernels are compiled for their
+ * instruction set with a target attribute and the widest one the
+ * CPU supports is selected on first use through cpuid. The choice
+ * is cached within a function pointer.
+ *
+ * Multiple accumulators change the order of the floating point
+ * additions so the result may differ in the last bits from a
+ * sequential loop and between CPUs. The kernels are only used when
+ * summation::fast is requested. The default summation::deterministic
+ * mode performs the additions in order on every machine.
+ *
+ * The maximum absolute value kernels propagate NaN. A NaN anywhere
+ * within the array makes the result NaN on every instruction set so
+ * convergence checks cannot miss it.
+ */
+
+namespace xstd {
+
+/// Order of additions within floating point reductions
+enum class summation {
+	fast,          ///< Multiple accumulators and SIMD selected for the CPU
+	deterministic  ///< Sequential in order additions giving identical results everywhere
+};
+
+/// @cond SKIP_DETAIL
+namespace detail {
+
+/// Types with SIMD reduction kernels
+template<typename T>
+concept simd_reducible = std::is_same<T, float>::value || std::is_same<T, double>::value;
+
+/// Larger of a and b returning a NaN held by either
+template<typename T>
+constexpr T nan_max(const T& a, const T& b) noexcept {
+	if( a != a ){
+		return a;
+	}
+	if( b != b ){
+		return b;
+	}
+	return (a < b) ? b : a;
+}
+
+/// Widest instruction set supported by the CPU
+enum class simd_level { scalar, sse2, avx2, avx512 };
+
+
+// ============================================================
+//                      Scalar Kernels
+// ============================================================
+namespace simd_scalar {
+
+template<typename T>
+T dot(const T* XSTD_RESTRICT a, const T* XSTD_RESTRICT b, const std::size_t n) noexcept {
+	T s0(0), s1(0), s2(0), s3(0);
+	std::size_t i = 0;
+	for(; i + 4 <= n; i += 4){
+		s0 += a[i+0] * b[i+0];
+		s1 += a[i+1] * b[i+1];
+		s2 += a[i+2] * b[i+2];
+		s3 += a[i+3] * b[i+3];
+	}
+	T ans = (s0 + s1) + (s2 + s3);
+	for(; i < n; ++i){
+		ans += a[i] * b[i];
+	}
+	return ans;
+}
+
+template<typename T>
+T asum(const T* XSTD_RESTRICT a, const std::size_t n) noexcept {
+	using std::abs;
+	T s0(0), s1(0), s2(0), s3(0);
+	std::size_t i = 0;
+	for(; i + 4 <= n; i += 4){
+		s0 += abs(a[i+0]);
+		s1 += abs(a[i+1]);
+		s2 += abs(a[i+2]);
+		s3 += abs(a[i+3]);
+	}
+	T ans = (s0 + s1) + (s2 + s3);
+	for(; i < n; ++i){
+		ans += abs(a[i]);
+	}
+	return ans;
+}
+
+template<typename T>
+T amax(const T* XSTD_RESTRICT a, const std::size_t n) noexcept {
+	using std::abs;
+	using std::max;
+	T ans(0);
+	for(std::size_t i = 0; i < n; ++i){
+		ans = nan_max(ans, T(abs(a[i])));
+	}
+	return ans;
+}
+
+} /* namespace simd_scalar */
+
+
+#if defined(XSTD_HAS_TARGET_DISPATCH)
+
+// ============================================================
+//                       SSE2 Kernels
+// ============================================================
+namespace simd_sse2 {
+
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE __m128d load(const double* p) noexcept { return _mm_loadu_pd(p); }
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE __m128  load(const float*  p) noexcept { return _mm_loadu_ps(p); }
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE __m128d set1(const double v) noexcept { return _mm_set1_pd(v); }
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE __m128  set1(const float  v) noexcept { return _mm_set1_ps(v); }
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE __m128d add(__m128d a, __m128d b) noexcept { return _mm_add_pd(a, b); }
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE __m128  add(__m128  a, __m128  b) noexcept { return _mm_add_ps(a, b); }
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE __m128d max(__m128d a, __m128d b) noexcept { return _mm_max_pd(a, b); }
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE __m128  max(__m128  a, __m128  b) noexcept { return _mm_max_ps(a, b); }
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE unsigned nan_mask(__m128d a) noexcept { return static_cast<unsigned>(_mm_movemask_pd(_mm_cmpunord_pd(a, a))); }
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE unsigned nan_mask(__m128  a) noexcept { return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpunord_ps(a, a))); }
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE __m128d fmadd(__m128d a, __m128d b, __m128d c) noexcept { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE __m128  fmadd(__m128  a, __m128  b, __m128  c) noexcept { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE __m128d abs(__m128d a) noexcept { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE __m128  abs(__m128  a) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE double hsum(__m128d a) noexcept {
+	return _mm_cvtsd_f64(_mm_add_sd(a, _mm_unpackhi_pd(a, a)));
+}
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE float hsum(__m128 a) noexcept {
+	const auto s = _mm_add_ps(a, _mm_movehl_ps(a, a));
+	return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 1)));
+}
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE double hmax(__m128d a) noexcept {
+	return _mm_cvtsd_f64(_mm_max_sd(a, _mm_unpackhi_pd(a, a)));
+}
+XSTD_TARGET("sse2") XSTD_FORCE_INLINE float hmax(__m128 a) noexcept {
+	const auto s = _mm_max_ps(a, _mm_movehl_ps(a, a));
+	return _mm_cvtss_f32(_mm_max_ss(s, _mm_shuffle_ps(s, s, 1)));
+}
+
+template<typename T>
+XSTD_TARGET("sse2") T dot(const T* XSTD_RESTRICT a, const T* XSTD_RESTRICT b, const std::size_t n) noexcept {
+	constexpr std::size_t W = 16 / sizeof(T);
+	auto s0 = set1(T(0)), s1 = s0, s2 = s0, s3 = s0;
+	std::size_t i = 0;
+	for(; i + 4*W <= n; i += 4*W){
+		s0 = fmadd(load(a + i + 0*W), load(b + i + 0*W), s0);
+		s1 = fmadd(load(a + i + 1*W), load(b + i + 1*W), s1);
+		s2 = fmadd(load(a + i + 2*W), load(b + i + 2*W), s2);
+		s3 = fmadd(load(a + i + 3*W), load(b + i + 3*W), s3);
+	}
+	for(; i + W <= n; i += W){
+		s0 = fmadd(load(a + i), load(b + i), s0);
+	}
+	T ans = hsum(add(add(s0, s1), add(s2, s3)));
+	for(; i < n; ++i){
+		ans += a[i] * b[i];
+	}
+	return ans;
+}
+
+template<typename T>
+XSTD_TARGET("sse2") T asum(const T* XSTD_RESTRICT a, const std::size_t n) noexcept {
+	constexpr std::size_t W = 16 / sizeof(T);
+	auto s0 = set1(T(0)), s1 = s0, s2 = s0, s3 = s0;
+	std::size_t i = 0;
+	for(; i + 4*W <= n; i += 4*W){
+		s0 = add(abs(load(a + i + 0*W)), s0);
+		s1 = add(abs(load(a + i + 1*W)), s1);
+		s2 = add(abs(load(a + i + 2*W)), s2);
+		s3 = add(abs(load(a + i + 3*W)), s3);
+	}
+	for(; i + W <= n; i += W){
+		s0 = add(abs(load(a + i)), s0);
+	}
+	T ans = hsum(add(add(s0, s1), add(s2, s3)));
+	for(; i < n; ++i){
+		ans += std::abs(a[i]);
+	}
+	return ans;
+}
+
+template<typename T>
+XSTD_TARGET("sse2") T amax(const T* XSTD_RESTRICT a, const std::size_t n) noexcept {
+	constexpr std::size_t W = 16 / sizeof(T);
+	auto m0 = set1(T(0)), m1 = m0;
+	unsigned nan = 0;
+	std::size_t i = 0;
+	for(; i + 2*W <= n; i += 2*W){
+		const auto v0 = abs(load(a + i + 0*W));
+		const auto v1 = abs(load(a + i + 1*W));
+		m0 = max(m0, v0);
+		m1 = max(m1, v1);
+		nan |= nan_mask(v0) | nan_mask(v1);
+	}
+	if( nan != 0 ){
+		return std::numeric_limits<T>::quiet_NaN();
+	}
+	T ans = hmax(max(m0, m1));
+	for(; i < n; ++i){
+		ans = nan_max(ans, std::abs(a[i]));
+	}
+	return ans;
+}
+
+} /* namespace simd_sse2 */
+
+
+// ============================================================
+//                    AVX2 + FMA Kernels
+// ============================================================
+namespace simd_avx2 {
+
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE __m256d load(const double* p) noexcept { return _mm256_loadu_pd(p); }
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE __m256  load(const float*  p) noexcept { return _mm256_loadu_ps(p); }
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE __m256d set1(const double v) noexcept { return _mm256_set1_pd(v); }
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE __m256  set1(const float  v) noexcept { return _mm256_set1_ps(v); }
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE __m256d add(__m256d a, __m256d b) noexcept { return _mm256_add_pd(a, b); }
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE __m256  add(__m256  a, __m256  b) noexcept { return _mm256_add_ps(a, b); }
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE __m256d max(__m256d a, __m256d b) noexcept { return _mm256_max_pd(a, b); }
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE __m256  max(__m256  a, __m256  b) noexcept { return _mm256_max_ps(a, b); }
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE unsigned nan_mask(__m256d a) noexcept { return static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(a, a, _CMP_UNORD_Q))); }
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE unsigned nan_mask(__m256  a) noexcept { return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(a, a, _CMP_UNORD_Q))); }
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE __m256d fmadd(__m256d a, __m256d b, __m256d c) noexcept { return _mm256_fmadd_pd(a, b, c); }
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE __m256  fmadd(__m256  a, __m256  b, __m256  c) noexcept { return _mm256_fmadd_ps(a, b, c); }
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE __m256d abs(__m256d a) noexcept { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE __m256  abs(__m256  a) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE double hsum(__m256d a) noexcept {
+	return simd_sse2::hsum(_mm_add_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1)));
+}
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE float hsum(__m256 a) noexcept {
+	return simd_sse2::hsum(_mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1)));
+}
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE double hmax(__m256d a) noexcept {
+	return simd_sse2::hmax(_mm_max_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1)));
+}
+XSTD_TARGET("avx2,fma") XSTD_FORCE_INLINE float hmax(__m256 a) noexcept {
+	return simd_sse2::hmax(_mm_max_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1)));
+}
+
+template<typename T>
+XSTD_TARGET("avx2,fma") T dot(const T* XSTD_RESTRICT a, const T* XSTD_RESTRICT b, const std::size_t n) noexcept {
+	constexpr std::size_t W = 32 / sizeof(T);
+	auto s0 = set1(T(0)), s1 = s0, s2 = s0, s3 = s0;
+	std::size_t i = 0;
+	for(; i + 4*W <= n; i += 4*W){
+		s0 = fmadd(load(a + i + 0*W), load(b + i + 0*W), s0);
+		s1 = fmadd(load(a + i + 1*W), load(b + i + 1*W), s1);
+		s2 = fmadd(load(a + i + 2*W), load(b + i + 2*W), s2);
+		s3 = fmadd(load(a + i + 3*W), load(b + i + 3*W), s3);
+	}
+	for(; i + W <= n; i += W){
+		s0 = fmadd(load(a + i), load(b + i), s0);
+	}
+	T ans = hsum(add(add(s0, s1), add(s2, s3)));
+	for(; i < n; ++i){
+		ans += a[i] * b[i];
+	}
+	return ans;
+}
+
+template<typename T>
+XSTD_TARGET("avx2,fma") T asum(const T* XSTD_RESTRICT a, const std::size_t n) noexcept {
+	constexpr std::size_t W = 32 / sizeof(T);
+	auto s0 = set1(T(0)), s1 = s0, s2 = s0, s3 = s0;
+	std::size_t i = 0;
+	for(; i + 4*W <= n; i += 4*W){
+		s0 = add(abs(load(a + i + 0*W)), s0);
+		s1 = add(abs(load(a + i + 1*W)), s1);
+		s2 = add(abs(load(a + i + 2*W)), s2);
+		s3 = add(abs(load(a + i + 3*W)), s3);
+	}
+	for(; i + W <= n; i += W){
+		s0 = add(abs(load(a + i)), s0);
+	}
+	T ans = hsum(add(add(s0, s1), add(s2, s3)));
+	for(; i < n; ++i){
+		ans += std::abs(a[i]);
+	}
+	return ans;
+}
+
+template<typename T>
+XSTD_TARGET("avx2,fma") T amax(const T* XSTD_RESTRICT a, const std::size_t n) noexcept {
+	constexpr std::size_t W = 32 / sizeof(T);
+	auto m0 = set1(T(0)), m1 = m0;
+	unsigned nan = 0;
+	std::size_t i = 0;
+	for(; i + 2*W <= n; i += 2*W){
+		const auto v0 = abs(load(a + i + 0*W));
+		const auto v1 = abs(load(a + i + 1*W));
+		m0 = max(m0, v0);
+		m1 = max(m1, v1);
+		nan |= nan_mask(v0) | nan_mask(v1);
+	}
+	if( nan != 0 ){
+		return std::numeric_limits<T>::quiet_NaN();
+	}
+	T ans = hmax(max(m0, m1));
+	for(; i < n; ++i){
+		ans = nan_max(ans, std::abs(a[i]));
+	}
+	return ans;
+}
+
+} /* namespace simd_avx2 */
+
+
+// ============================================================
+//                      AVX-512 Kernels
+// ============================================================
+namespace simd_avx512 {
+
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE __m512d load(const double* p) noexcept { return _mm512_loadu_pd(p); }
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE __m512  load(const float*  p) noexcept { return _mm512_loadu_ps(p); }
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE __m512d set1(const double v) noexcept { return _mm512_set1_pd(v); }
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE __m512  set1(const float  v) noexcept { return _mm512_set1_ps(v); }
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE __m512d add(__m512d a, __m512d b) noexcept { return _mm512_add_pd(a, b); }
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE __m512  add(__m512  a, __m512  b) noexcept { return _mm512_add_ps(a, b); }
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE __m512d max(__m512d a, __m512d b) noexcept { return _mm512_mask_max_pd(a, 0xFF, a, b); }
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE __m512  max(__m512  a, __m512  b) noexcept { return _mm512_mask_max_ps(a, 0xFFFF, a, b); }
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE unsigned nan_mask(__m512d a) noexcept { return static_cast<unsigned>(_mm512_cmp_pd_mask(a, a, _CMP_UNORD_Q)); }
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE unsigned nan_mask(__m512  a) noexcept { return static_cast<unsigned>(_mm512_cmp_ps_mask(a, a, _CMP_UNORD_Q)); }
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE __m512d fmadd(__m512d a, __m512d b, __m512d c) noexcept { return _mm512_fmadd_pd(a, b, c); }
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE __m512  fmadd(__m512  a, __m512  b, __m512  c) noexcept { return _mm512_fmadd_ps(a, b, c); }
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE __m512d abs(__m512d a) noexcept { return _mm512_abs_pd(a); }
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE __m512  abs(__m512  a) noexcept { return _mm512_abs_ps(a); }
+
+// Unmasked max and reduce intrinsics pass an undefined vector which
+// GCC 12 reports as uninitialized so the masked forms are used and
+// the final lanes are stored and combined pairwise
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE double hsum(__m512d a) noexcept {
+	double v[8];
+	_mm512_storeu_pd(v, a);
+	return ((v[0] + v[1]) + (v[2] + v[3])) + ((v[4] + v[5]) + (v[6] + v[7]));
+}
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE float hsum(__m512 a) noexcept {
+	float v[16];
+	_mm512_storeu_ps(v, a);
+	for(std::size_t w = 8; w > 0; w /= 2){
+		for(std::size_t i = 0; i < w; ++i){
+			v[i] += v[i + w];
+		}
+	}
+	return v[0];
+}
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE double hmax(__m512d a) noexcept {
+	double v[8];
+	_mm512_storeu_pd(v, a);
+	return *std::max_element(v, v + 8);
+}
+XSTD_TARGET("avx512f") XSTD_FORCE_INLINE float hmax(__m512 a) noexcept {
+	float v[16];
+	_mm512_storeu_ps(v, a);
+	return *std::max_element(v, v + 16);
+}
+
+template<typename T>
+XSTD_TARGET("avx512f") T dot(const T* XSTD_RESTRICT a, const T* XSTD_RESTRICT b, const std::size_t n) noexcept {
+	constexpr std::size_t W = 64 / sizeof(T);
+	auto s0 = set1(T(0)), s1 = s0, s2 = s0, s3 = s0;
+	std::size_t i = 0;
+	for(; i + 4*W <= n; i += 4*W){
+		s0 = fmadd(load(a + i + 0*W), load(b + i + 0*W), s0);
+		s1 = fmadd(load(a + i + 1*W), load(b + i + 1*W), s1);
+		s2 = fmadd(load(a + i + 2*W), load(b + i + 2*W), s2);
+		s3 = fmadd(load(a + i + 3*W), load(b + i + 3*W), s3);
+	}
+	for(; i + W <= n; i += W){
+		s0 = fmadd(load(a + i), load(b + i), s0);
+	}
+	T ans = hsum(add(add(s0, s1), add(s2, s3)));
+	for(; i < n; ++i){
+		ans += a[i] * b[i];
+	}
+	return ans;
+}
+
+template<typename T>
+XSTD_TARGET("avx512f") T asum(const T* XSTD_RESTRICT a, const std::size_t n) noexcept {
+	constexpr std::size_t W = 64 / sizeof(T);
+	auto s0 = set1(T(0)), s1 = s0, s2 = s0, s3 = s0;
+	std::size_t i = 0;
+	for(; i + 4*W <= n; i += 4*W){
+		s0 = add(abs(load(a + i + 0*W)), s0);
+		s1 = add(abs(load(a + i + 1*W)), s1);
+		s2 = add(abs(load(a + i + 2*W)), s2);
+		s3 = add(abs(load(a + i + 3*W)), s3);
+	}
+	for(; i + W <= n; i += W){
+		s0 = add(abs(load(a + i)), s0);
+	}
+	T ans = hsum(add(add(s0, s1), add(s2, s3)));
+	for(; i < n; ++i){
+		ans += std::abs(a[i]);
+	}
+	return ans;
+}
+
+template<typename T>
+XSTD_TARGET("avx512f") T amax(const T* XSTD_RESTRICT a, const std::size_t n) noexcept {
+	constexpr std::size_t W = 64 / sizeof(T);
+	auto m0 = set1(T(0)), m1 = m0;
+	unsigned nan = 0;
+	std::size_t i = 0;
+	for(; i + 2*W <= n; i += 2*W){
+		const auto v0 = abs(load(a + i + 0*W));
+		const auto v1 = abs(load(a + i + 1*W));
+		m0 = max(m0, v0);
+		m1 = max(m1, v1);
+		nan |= nan_mask(v0) | nan_mask(v1);
+	}
+	if( nan != 0 ){
+		return std::numeric_limits<T>::quiet_NaN();
+	}
+	T ans = hmax(max(m0, m1));
+	for(; i < n; ++i){
+		ans = nan_max(ans, std::abs(a[i]));
+	}
+	return ans;
+}
+
+} /* namespace simd_avx512 */
+
+#endif // defined(XSTD_HAS_TARGET_DISPATCH)
+
+
+// ============================================================
+//                     Runtime Dispatch
+// ============================================================
+
+/// Widest instruction set supported by the running CPU (cached)
+inline simd_level cpu_simd_level() noexcept {
+	static const simd_level level = [](){
+		if( XSTD_CPU_SUPPORTS("avx512f") ){
+			return simd_level::avx512;
+		}
+		if( XSTD_CPU_SUPPORTS("avx2") && XSTD_CPU_SUPPORTS("fma") ){
+			return simd_level::avx2;
+		}
+		if( XSTD_CPU_SUPPORTS("sse2") ){
+			return simd_level::sse2;
+		}
+		return simd_level::scalar;
+	}();
+	return level;
+}
+
+template<typename T>
+using simd_dot_function = T(*)(const T*, const T*, std::size_t) noexcept;
+
+template<typename T>
+using simd_unary_function = T(*)(const T*, std::size_t) noexcept;
+
+/// Kernels of the given instruction set
+template<typename T>
+struct simd_kernels {
+	simd_dot_function<T>   dot;
+	simd_unary_function<T> asum;
+	simd_unary_function<T> amax;
+};
+
+template<typename T>
+simd_kernels<T> select_simd_kernels(const simd_level level) noexcept {
+#if defined(XSTD_HAS_TARGET_DISPATCH)
+	switch( level ){
+	case simd_level::avx512:
+		return {&simd_avx512::dot<T>, &simd_avx512::asum<T>, &simd_avx512::amax<T>};
+	case simd_level::avx2:
+		return {&simd_avx2::dot<T>, &simd_avx2::asum<T>, &simd_avx2::amax<T>};
+	case simd_level::sse2:
+		return {&simd_sse2::dot<T>, &simd_sse2::asum<T>, &simd_sse2::amax<T>};
+	default:
+		break;
+	}
+#endif
+	(void)level;
+	return {&simd_scalar::dot<T>, &simd_scalar::asum<T>, &simd_scalar::amax<T>};
+}
+
+/// Kernels for the running CPU selected on first use
+template<typename T>
+const simd_kernels<T>& cpu_simd_kernels() noexcept {
+	static const simd_kernels<T> kernels = select_simd_kernels<T>(cpu_simd_level());
+	return kernels;
+}
+
+template<typename T>
+T simd_dot(const T* a, const T* b, const std::size_t n) noexcept {
+	return cpu_simd_kernels<T>().dot(a, b, n);
+}
+
+template<typename T>
+T simd_asum(const T* a, const std::size_t n) noexcept {
+	return cpu_simd_kernels<T>().asum(a, n);
+}
+
+template<typename T>
+T simd_amax(const T* a, const std::size_t n) noexcept {
+	return cpu_simd_kernels<T>().amax(a, n);
+}
+
+} /* namespace detail */
+/// @endcond
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_VECTOR_SIMD_REDUCE_HPP_ */
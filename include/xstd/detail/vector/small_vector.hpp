@@ -0,0 +1,734 @@
+/**
+ * \file       small_vector.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_VECTOR_SMALL_VECTOR_HPP_
+#define INCLUDE_XSTD_DETAIL_VECTOR_SMALL_VECTOR_HPP_
+
+
+#include "xstd/assert.hpp"
+#include "xstd/detail/type_traits/relocatable.hpp"
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \file
+ * small_vector.hpp
+ *
+ * \brief
+ * Vector with inline storage for a small number of elements
+ *
+ * \details
+ * Models std::vector while holding up to N elements inside the
+ * object itself the same way bounded_vector does. Growing beyond N
+ * moves the elements into storage from the allocator after which
+ * the container behaves like a std::vector. Short lived lists which
+ * are usually small therefore never touch the heap while the rare
+ * large one still works.
+ */
+
+namespace xstd {
+
+/// Vector with inline capacity which spills to the heap
+/**
+ * \code
+ * xstd::small_vector<int,8> nbrs;             // no allocation
+ * for(auto n : graph.neighbors(node)){
+ *     nbrs.push_back(n);                      // allocates past 8
+ * }
+ * \endcode
+ *
+ * Iterators, pointers and references are invalidated by any
+ * operation which changes the capacity, as well as by move and
+ * swap while the elements are inline.
+ *
+ * \tparam T Type held within vector
+ * \tparam N Number of elements stored inline
+ * \tparam Alloc Allocator used once the inline capacity is exceeded
+ */
+template<typename T, std::size_t N, typename Alloc = std::allocator<T>>
+class small_vector final {
+	using alloc_traits = std::allocator_traits<Alloc>;
+
+	static_assert(std::is_same<typename alloc_traits::value_type, T>::value,
+	              "Allocator value_type must match T");
+
+public:
+
+	// ====================================================
+	// Types
+	// ====================================================
+
+	using value_type             = T;
+	using allocator_type         = Alloc;
+	using size_type              = std::size_t;
+	using difference_type        = std::ptrdiff_t;
+	using reference              = value_type&;
+	using const_reference        = const value_type&;
+	using pointer                = value_type*;
+	using const_pointer          = const value_type*;
+	using iterator               = pointer;
+	using const_iterator         = const_pointer;
+	using reverse_iterator       = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	static constexpr size_type inline_capacity = N;
+
+	// ====================================================
+	// Constructors
+	// ====================================================
+
+	small_vector() noexcept(std::is_nothrow_default_constructible<Alloc>::value)
+		: small_vector(Alloc()) {
+	}
+
+	explicit small_vector(const Alloc& alloc) noexcept
+		: data_(inline_data_()), size_(0), capacity_(N), alloc_(alloc) {
+	}
+
+	small_vector(const size_type count, const T& value, const Alloc& alloc = Alloc())
+		: small_vector(alloc) {
+		this->assign(count, value);
+	}
+
+	explicit small_vector(const size_type count, const Alloc& alloc = Alloc())
+		: small_vector(alloc) {
+		this->resize(count);
+	}
+
+	template<std::input_iterator InputIt>
+	small_vector(InputIt first, InputIt last, const Alloc& alloc = Alloc())
+		: small_vector(alloc) {
+		this->assign(first, last);
+	}
+
+	small_vector(std::initializer_list<T> init, const Alloc& alloc = Alloc())
+		: small_vector(alloc) {
+		this->assign(init.begin(), init.end());
+	}
+
+	small_vector(const small_vector& other)
+		: small_vector(alloc_traits::select_on_container_copy_construction(other.alloc_)) {
+		this->assign(other.begin(), other.end());
+	}
+
+	small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+		: small_vector(std::move(other.alloc_)) {
+		this->take_(other);
+	}
+
+	~small_vector() {
+		this->clear();
+		this->release_();
+	}
+
+	small_vector& operator=(const small_vector& other) {
+		if( this != &other ){
+			if constexpr ( alloc_traits::propagate_on_container_copy_assignment::value ) {
+				if( alloc_ != other.alloc_ ){
+					this->clear();
+					this->release_();
+				}
+				alloc_ = other.alloc_;
+			}
+			this->assign(other.begin(), other.end());
+		}
+		return *this;
+	}
+
+	small_vector& operator=(small_vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value && std::is_nothrow_move_assignable<T>::value) {
+		if( this != &other ){
+			this->clear();
+			if constexpr ( alloc_traits::propagate_on_container_move_assignment::value ) {
+				this->release_();
+				alloc_ = std::move(other.alloc_);
+			}
+			else if( alloc_ != other.alloc_ ){
+				// Storage of other can't be released by our allocator
+				this->reserve(other.size());
+				std::uninitialized_move(other.begin(), other.end(), this->begin());
+				size_ = other.size_;
+				other.clear();
+				return *this;
+			}
+			this->take_(other);
+		}
+		return *this;
+	}
+
+	small_vector& operator=(std::initializer_list<T> ilist) {
+		this->assign(ilist.begin(), ilist.end());
+		return *this;
+	}
+
+	void assign(const size_type count, const T& value) {
+		if( count > capacity_ ){
+			const T copy(value); // value may be an element
+			this->clear();
+			this->reserve(count);
+			std::uninitialized_fill_n(this->begin(), count, copy);
+			size_ = count;
+			return;
+		}
+		const auto common = std::min(size_, count);
+		std::fill_n(this->begin(), common, value);
+		if( count > size_ ){
+			std::uninitialized_fill(this->end(), this->begin() + count, value);
+		}
+		else {
+			std::destroy(this->begin() + count, this->end());
+		}
+		size_ = count;
+	}
+
+	template<std::input_iterator InputIt>
+	void assign(InputIt first, InputIt last) {
+		if constexpr ( std::forward_iterator<InputIt> ) {
+			const auto count = static_cast<size_type>(std::distance(first, last));
+			if( count > capacity_ ){
+				this->clear();
+				this->reserve(count);
+			}
+		}
+
+		// Assign over the live elements then construct or destroy the rest
+		size_type i = 0;
+		for(; (first != last) && (i < size_); ++first, ++i){
+			data_[i] = *first;
+		}
+		if( first == last ){
+			std::destroy(this->begin() + i, this->end());
+			size_ = i;
+		}
+		else {
+			for(; first != last; ++first){
+				this->emplace_back(*first);
+			}
+		}
+	}
+
+	void assign(std::initializer_list<T> ilist) {
+		this->assign(ilist.begin(), ilist.end());
+	}
+
+	allocator_type get_allocator() const noexcept {
+		return alloc_;
+	}
+
+	// ====================================================
+	// Element Access
+	// ====================================================
+
+	reference at(const size_type pos) {
+		if( pos >= size_ ){
+			throw std::out_of_range("small_vector::at");
+		}
+		return data_[pos];
+	}
+
+	const_reference at(const size_type pos) const {
+		if( pos >= size_ ){
+			throw std::out_of_range("small_vector::at");
+		}
+		return data_[pos];
+	}
+
+	reference operator[](const size_type pos) noexcept {
+		ASSERT(pos < size_);
+		return data_[pos];
+	}
+
+	const_reference operator[](const size_type pos) const noexcept {
+		ASSERT(pos < size_);
+		return data_[pos];
+	}
+
+	reference front() noexcept {
+		ASSERT(not this->empty());
+		return data_[0];
+	}
+
+	const_reference front() const noexcept {
+		ASSERT(not this->empty());
+		return data_[0];
+	}
+
+	reference back() noexcept {
+		ASSERT(not this->empty());
+		return data_[size_ - 1];
+	}
+
+	const_reference back() const noexcept {
+		ASSERT(not this->empty());
+		return data_[size_ - 1];
+	}
+
+	T* data() noexcept {
+		return data_;
+	}
+
+	const T* data() const noexcept {
+		return data_;
+	}
+
+	// ====================================================
+	// Iterators
+	// ====================================================
+
+	iterator begin() noexcept { return data_; }
+	iterator end() noexcept { return data_ + size_; }
+	const_iterator begin() const noexcept { return data_; }
+	const_iterator end() const noexcept { return data_ + size_; }
+	const_iterator cbegin() const noexcept { return this->begin(); }
+	const_iterator cend() const noexcept { return this->end(); }
+
+	reverse_iterator rbegin() noexcept { return reverse_iterator(this->end()); }
+	reverse_iterator rend() noexcept { return reverse_iterator(this->begin()); }
+	const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(this->end()); }
+	const_reverse_iterator rend() const noexcept { return const_reverse_iterator(this->begin()); }
+	const_reverse_iterator crbegin() const noexcept { return this->rbegin(); }
+	const_reverse_iterator crend() const noexcept { return this->rend(); }
+
+	// ====================================================
+	// Capacity
+	// ====================================================
+
+	[[nodiscard]] bool empty() const noexcept {
+		return size_ == 0;
+	}
+
+	size_type size() const noexcept {
+		return size_;
+	}
+
+	size_type max_size() const noexcept {
+		return std::max<size_type>(N, alloc_traits::max_size(alloc_));
+	}
+
+	size_type capacity() const noexcept {
+		return capacity_;
+	}
+
+	/// True while the elements are stored within the object
+	bool is_inline() const noexcept {
+		return data_ == inline_data_();
+	}
+
+	void reserve(const size_type new_cap) {
+		if( new_cap > capacity_ ){
+			this->reallocate_(new_cap);
+		}
+	}
+
+	/// Release unused heap storage returning inline if possible
+	void shrink_to_fit() {
+		if( (not this->is_inline()) && (size_ < capacity_) ){
+			this->reallocate_(size_);
+		}
+	}
+
+	// ====================================================
+	// Modifiers
+	// ====================================================
+
+	void clear() noexcept {
+		std::destroy(this->begin(), this->end());
+		size_ = 0;
+	}
+
+	iterator insert(const_iterator pos, const T& value) {
+		return this->emplace(pos, value);
+	}
+
+	iterator insert(const_iterator pos, T&& value) {
+		return this->emplace(pos, std::move(value));
+	}
+
+	iterator insert(const_iterator pos, const size_type count, const T& value) {
+		ASSERT((pos >= this->cbegin()) && (pos <= this->cend()));
+		const auto index = pos - this->cbegin();
+		const auto old_size = size_;
+		if constexpr ( is_trivially_relocatable_v<T> ) {
+			const T copy(value); // value may be an element
+			if( (size_ + count) > capacity_ ){
+				this->reserve(this->grow_size_(size_ + count));
+			}
+			this->open_gap_(index, count, [&](T* gap){ std::uninitialized_fill_n(gap, count, copy); });
+			return this->begin() + index;
+		}
+		if( (size_ + count) > capacity_ ){
+			const T copy(value); // value may be an element
+			this->reserve(this->grow_size_(size_ + count));
+			std::uninitialized_fill_n(this->end(), count, copy);
+		}
+		else {
+			std::uninitialized_fill_n(this->end(), count, value);
+		}
+		size_ += count;
+		std::rotate(this->begin() + index, this->begin() + old_size, this->end());
+		return this->begin() + index;
+	}
+
+	template<std::input_iterator InputIt>
+	iterator insert(const_iterator pos, InputIt first, InputIt last) {
+		ASSERT((pos >= this->cbegin()) && (pos <= this->cend()));
+		const auto index = pos - this->cbegin();
+		const auto old_size = size_;
+		if constexpr ( std::forward_iterator<InputIt> ) {
+			const auto count = static_cast<size_type>(std::distance(first, last));
+			if( (size_ + count) > capacity_ ){
+				this->reserve(this->grow_size_(size_ + count));
+			}
+			if constexpr ( is_trivially_relocatable_v<T> ) {
+				this->open_gap_(index, count, [&](T* gap){ std::uninitialized_copy(first, last, gap); });
+				return this->begin() + index;
+			}
+		}
+
+		// Append then rotate into position
+		for(; first != last; ++first){
+			this->emplace_back(*first);
+		}
+		std::rotate(this->begin() + index, this->begin() + old_size, this->end());
+		return this->begin() + index;
+	}
+
+	iterator insert(const_iterator pos, std::initializer_list<T> ilist) {
+		return this->insert(pos, ilist.begin(), ilist.end());
+	}
+
+	template<typename... Args>
+	iterator emplace(const_iterator pos, Args&&... args) {
+		ASSERT((pos >= this->cbegin()) && (pos <= this->cend()));
+		const auto index = pos - this->cbegin();
+		if( pos == this->cend() ){
+			this->emplace_back(std::forward<Args>(args)...);
+			return this->begin() + index;
+		}
+
+		// Construct first since args may refer to an element being shifted
+		T value(std::forward<Args>(args)...);
+		if( size_ == capacity_ ){
+			this->reserve(this->grow_size_(size_ + 1));
+		}
+		if constexpr ( is_trivially_relocatable_v<T> ) {
+			this->open_gap_(index, 1, [&](T* gap){ std::construct_at(gap, std::move(value)); });
+			return this->begin() + index;
+		}
+		auto it = this->begin() + index;
+		std::construct_at(this->end(), std::move(this->back()));
+		std::move_backward(it, this->end() - 1, this->end());
+		++size_;
+		*it = std::move(value);
+		return it;
+	}
+
+	iterator erase(const_iterator pos) {
+		ASSERT((pos >= this->cbegin()) && (pos < this->cend()));
+		auto it = this->begin() + (pos - this->cbegin());
+		if constexpr ( is_trivially_relocatable_v<T> ) {
+			std::destroy_at(it);
+			uninitialized_relocate(it + 1, this->end(), it);
+			--size_;
+			return it;
+		}
+		std::move(it + 1, this->end(), it);
+		this->pop_back();
+		return it;
+	}
+
+	iterator erase(const_iterator first, const_iterator last) {
+		ASSERT((first >= this->cbegin()) && (first <= last) && (last <= this->cend()));
+		auto it = this->begin() + (first - this->cbegin());
+		if constexpr ( is_trivially_relocatable_v<T> ) {
+			std::destroy(it, it + (last - first));
+			uninitialized_relocate(it + (last - first), this->end(), it);
+			size_ -= static_cast<size_type>(last - first);
+			return it;
+		}
+		auto new_end = std::move(it + (last - first), this->end(), it);
+		std::destroy(new_end, this->end());
+		size_ = static_cast<size_type>(new_end - this->begin());
+		return it;
+	}
+
+	void push_back(const T& value) {
+		this->emplace_back(value);
+	}
+
+	void push_back(T&& value) {
+		this->emplace_back(std::move(value));
+	}
+
+	template<typename... Args>
+	reference emplace_back(Args&&... args) {
+		if( size_ == capacity_ ){
+			return this->grow_emplace_back_(std::forward<Args>(args)...);
+		}
+		std::construct_at(this->end(), std::forward<Args>(args)...);
+		++size_;
+		return this->back();
+	}
+
+	void pop_back() {
+		ASSERT(not this->empty());
+		--size_;
+		std::destroy_at(this->end());
+	}
+
+	void resize(const size_type count) {
+		if( count > size_ ){
+			this->reserve(count);
+			std::uninitialized_value_construct(this->end(), this->begin() + count);
+		}
+		else {
+			std::destroy(this->begin() + count, this->end());
+		}
+		size_ = count;
+	}
+
+	void resize(const size_type count, const value_type& value) {
+		if( count > capacity_ ){
+			const T copy(value); // value may be an element
+			this->reserve(count);
+			std::uninitialized_fill(this->end(), this->begin() + count, copy);
+		}
+		else if( count > size_ ){
+			std::uninitialized_fill(this->end(), this->begin() + count, value);
+		}
+		else {
+			std::destroy(this->begin() + count, this->end());
+		}
+		size_ = count;
+	}
+
+	void swap(small_vector& other) noexcept(std::is_nothrow_move_constructible<T>::value && std::is_nothrow_move_assignable<T>::value) {
+		if( this == &other ){
+			return;
+		}
+		if constexpr ( alloc_traits::propagate_on_container_swap::value ) {
+			using std::swap;
+			swap(alloc_, other.alloc_);
+		}
+		else {
+			ASSERT(alloc_ == other.alloc_);
+		}
+		if( (not this->is_inline()) && (not other.is_inline()) ){
+			std::swap(data_, other.data_);
+			std::swap(size_, other.size_);
+			std::swap(capacity_, other.capacity_);
+			return;
+		}
+		if constexpr ( is_trivially_relocatable_v<T> ) {
+			if( this->is_inline() && other.is_inline() ){
+				const auto min_size = std::min(size_, other.size_);
+				swap_relocatable(data_, other.data_, min_size);
+				uninitialized_relocate(this->begin() + min_size, this->end(), other.begin() + min_size);
+				uninitialized_relocate(other.begin() + min_size, other.end(), this->begin() + min_size);
+				std::swap(size_, other.size_);
+				return;
+			}
+		}
+		small_vector tmp(std::move(other));
+		other.take_(*this);
+		this->take_(tmp);
+	}
+
+private:
+	/// Uninitialized storage for N elements
+	union storage_type {
+		storage_type() noexcept {}
+		~storage_type() {}
+		T values[N > 0 ? N : 1];
+	};
+
+	T*                          data_;
+	size_type                   size_;
+	size_type                   capacity_;
+	[[no_unique_address]] Alloc alloc_;
+	storage_type                storage_;
+
+	T* inline_data_() noexcept {
+		return storage_.values;
+	}
+
+	const T* inline_data_() const noexcept {
+		return storage_.values;
+	}
+
+	/// Capacity for at least count elements with geometric growth
+	size_type grow_size_(const size_type count) const {
+		if( count > this->max_size() ){
+			throw std::length_error("small_vector");
+		}
+		return std::max(count, std::min(2 * capacity_, this->max_size()));
+	}
+
+	/// Move live elements into uninitialized storage
+	static void relocate_(T* first, T* last, T* dest) {
+		if constexpr ( is_trivially_relocatable_v<T> ) {
+			uninitialized_relocate(first, last, dest);
+		}
+		else {
+			if constexpr ( std::is_nothrow_move_constructible<T>::value || (not std::is_copy_constructible<T>::value) ) {
+				std::uninitialized_move(first, last, dest);
+			}
+			else {
+				std::uninitialized_copy(first, last, dest);
+			}
+			std::destroy(first, last);
+		}
+	}
+
+	/// Shift elements from index up by count and construct the gap with fill
+	template<typename Fill>
+	void open_gap_(const size_type index, const size_type count, Fill fill) {
+		ASSERT((size_ + count) <= capacity_);
+		auto it = this->begin() + index;
+		uninitialized_relocate(it, this->end(), it + count);
+		try {
+			fill(it);
+		}
+		catch(...) {
+			uninitialized_relocate(it + count, this->end() + count, it);
+			throw;
+		}
+		size_ += count;
+	}
+
+	/// Return heap storage to the allocator (elements already destroyed)
+	void release_() noexcept {
+		if( not this->is_inline() ){
+			alloc_traits::deallocate(alloc_, data_, capacity_);
+			data_     = this->inline_data_();
+			capacity_ = N;
+		}
+	}
+
+	/// Move elements to storage of new_cap (>= size) elements
+	void reallocate_(const size_type new_cap) {
+		ASSERT(new_cap >= size_);
+		if( new_cap <= N ){
+			if( not this->is_inline() ){
+				T* old_data = data_;
+				const auto old_cap = capacity_;
+				relocate_(old_data, old_data + size_, this->inline_data_());
+				alloc_traits::deallocate(alloc_, old_data, old_cap);
+				data_     = this->inline_data_();
+				capacity_ = N;
+			}
+			return;
+		}
+		if( new_cap > this->max_size() ){
+			throw std::length_error("small_vector");
+		}
+		T* new_data = alloc_traits::allocate(alloc_, new_cap);
+		try {
+			relocate_(data_, data_ + size_, new_data);
+		}
+		catch(...) {
+			alloc_traits::deallocate(alloc_, new_data, new_cap);
+			throw;
+		}
+		this->release_();
+		data_     = new_data;
+		capacity_ = new_cap;
+	}
+
+	/// Append into new storage (args may refer to an element)
+	template<typename... Args>
+	reference grow_emplace_back_(Args&&... args) {
+		const auto new_cap = this->grow_size_(size_ + 1);
+		T* new_data = alloc_traits::allocate(alloc_, new_cap);
+		try {
+			std::construct_at(new_data + size_, std::forward<Args>(args)...);
+		}
+		catch(...) {
+			alloc_traits::deallocate(alloc_, new_data, new_cap);
+			throw;
+		}
+		try {
+			relocate_(data_, data_ + size_, new_data);
+		}
+		catch(...) {
+			std::destroy_at(new_data + size_);
+			alloc_traits::deallocate(alloc_, new_data, new_cap);
+			throw;
+		}
+		this->release_();
+		data_     = new_data;
+		capacity_ = new_cap;
+		++size_;
+		return this->back();
+	}
+
+	/// Take the elements of an empty-or-cleared this from other
+	void take_(small_vector& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+		ASSERT(this->empty());
+		if( other.is_inline() ){
+			relocate_(other.begin(), other.end(), this->begin());
+			size_ = other.size_;
+			other.size_ = 0;
+		}
+		else {
+			this->release_();
+			data_      = other.data_;
+			size_      = other.size_;
+			capacity_  = other.capacity_;
+			other.data_     = other.inline_data_();
+			other.size_     = 0;
+			other.capacity_ = N;
+		}
+	}
+};
+
+
+// ================================================================
+//                        Free Functions
+// ================================================================
+
+template<typename T, std::size_t N, typename A>
+bool operator==(const small_vector<T,N,A>& lhs, const small_vector<T,N,A>& rhs) {
+	return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<typename T, std::size_t N, typename A>
+auto operator<=>(const small_vector<T,N,A>& lhs, const small_vector<T,N,A>& rhs) {
+	return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<typename T, std::size_t N, typename A>
+void swap(small_vector<T,N,A>& lhs, small_vector<T,N,A>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+	lhs.swap(rhs);
+}
+
+template<typename T, std::size_t N, typename A, typename U>
+typename small_vector<T,N,A>::size_type erase(small_vector<T,N,A>& c, const U& value) {
+	auto it = std::remove(c.begin(), c.end(), value);
+	const auto count = static_cast<std::size_t>(c.end() - it);
+	c.erase(it, c.end());
+	return count;
+}
+
+template<typename T, std::size_t N, typename A, typename Pred>
+typename small_vector<T,N,A>::size_type erase_if(small_vector<T,N,A>& c, Pred pred) {
+	auto it = std::remove_if(c.begin(), c.end(), pred);
+	const auto count = static_cast<std::size_t>(c.end() - it);
+	c.erase(it, c.end());
+	return count;
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_VECTOR_SMALL_VECTOR_HPP_ */
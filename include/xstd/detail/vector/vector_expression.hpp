@@ -0,0 +1,288 @@
+/**
+ * \file       vector_expression.hpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+#ifndef INCLUDE_XSTD_DETAIL_VECTOR_VECTOR_EXPRESSION_HPP_
+#define INCLUDE_XSTD_DETAIL_VECTOR_VECTOR_EXPRESSION_HPP_
+
+
+#include "xstd/assert.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * vector_expression.hpp
+ *
+ * \brief
+ * Lazy evaluation of element wise std::vector math
+ *
+ * \details
+ * Arithmetic on std::vector (see vector_math.hpp) builds a tree of
+ * expression nodes instead of computing a new std::vector for each
+ * operator. The tree is evaluated within a single loop once it is
+ * converted or assigned into a std::vector so
+ * \code
+ * std::vector<double> r = a*x + b*y - z;
+ * \endcode
+ * allocates one vector and reads each operand once.
+ *
+ * Vector operands which are lvalues are held by reference and must
+ * outlive the expression. Temporary vectors are moved into the
+ * expression. Storing an expression with auto is therefore only
+ * safe while the referenced vectors are alive.
+ */
+
+namespace xstd {
+
+/// Base class of all lazy vector expressions
+/**
+ * Curiously recurring template base providing the conversion to a
+ * std::vector. Derived types provide size() and operator[].
+ */
+template<typename Expression>
+struct vector_expression {
+
+	const Expression& derived() const noexcept {
+		return static_cast<const Expression&>(*this);
+	}
+
+	std::size_t size() const noexcept {
+		return this->derived().size();
+	}
+
+	decltype(auto) operator[](const std::size_t i) const noexcept {
+		return this->derived()[i];
+	}
+
+	/** Evaluate the expression into a std::vector */
+	template<typename T, typename A>
+	operator std::vector<T,A>() const {
+		const auto n = this->size();
+		std::vector<T,A> ans(n);
+		for(std::size_t i = 0; i < n; ++i){
+			ans[i] = static_cast<T>(this->derived()[i]);
+		}
+		return ans;
+	}
+};
+
+/// @cond SKIP_DETAIL
+namespace detail {
+
+template<typename T>
+struct is_std_vector : std::false_type {};
+
+template<typename T, typename A>
+struct is_std_vector<std::vector<T,A>> : std::true_type {};
+
+template<typename T>
+struct is_vector_expression : std::is_base_of<vector_expression<std::remove_cvref_t<T>>, std::remove_cvref_t<T>> {};
+
+/// Vector or expression which can take part in element wise math
+template<typename T>
+concept vector_operand = is_std_vector<std::remove_cvref_t<T>>::value || is_vector_expression<T>::value;
+
+/// Value used as the same scalar for every element
+template<typename T>
+concept scalar_operand = not vector_operand<T>;
+
+/// Leaf node referencing (lvalue) or owning (rvalue) a std::vector
+template<typename Vector>
+class vector_leaf final : public vector_expression<vector_leaf<Vector>> {
+	using vector_type = std::remove_cvref_t<Vector>;
+public:
+	using value_type = typename vector_type::value_type;
+
+	template<typename V>
+	explicit vector_leaf(V&& v) : vec_(std::forward<V>(v)) {}
+
+	std::size_t size() const noexcept {
+		return vec_.size();
+	}
+
+	const value_type& operator[](const std::size_t i) const noexcept {
+		return vec_[i];
+	}
+
+private:
+	Vector vec_; // const std::vector& or std::vector
+};
+
+/// Leaf node of a scalar repeated for every element
+template<typename T>
+class vector_scalar final {
+public:
+	using value_type = T;
+
+	explicit vector_scalar(const T& value) : value_(value) {}
+
+	const T& operator[](const std::size_t) const noexcept {
+		return value_;
+	}
+
+private:
+	T value_;
+};
+
+template<typename T>
+struct is_vector_scalar : std::false_type {};
+
+template<typename T>
+struct is_vector_scalar<vector_scalar<T>> : std::true_type {};
+
+/// Node applying an element wise binary operation
+template<typename Op, typename L, typename R>
+class vector_binary final : public vector_expression<vector_binary<Op,L,R>> {
+public:
+	using value_type = std::common_type_t<typename L::value_type, typename R::value_type>;
+
+	vector_binary(L lhs, R rhs) : lhs_(std::move(lhs)), rhs_(std::move(rhs)) {
+		if constexpr ( not (is_vector_scalar<L>::value || is_vector_scalar<R>::value) ) {
+			ASSERT(lhs_.size() == rhs_.size());
+		}
+	}
+
+	std::size_t size() const noexcept {
+		if constexpr ( is_vector_scalar<L>::value ) {
+			return rhs_.size();
+		}
+		else {
+			return lhs_.size();
+		}
+	}
+
+	value_type operator[](const std::size_t i) const noexcept {
+		return static_cast<value_type>(Op()(lhs_[i], rhs_[i]));
+	}
+
+private:
+	L lhs_;
+	R rhs_;
+};
+
+/// Node applying an element wise unary operation
+template<typename Op, typename E>
+class vector_unary final : public vector_expression<vector_unary<Op,E>> {
+public:
+	using value_type = typename E::value_type;
+
+	explicit vector_unary(E expr) : expr_(std::move(expr)) {}
+
+	std::size_t size() const noexcept {
+		return expr_.size();
+	}
+
+	value_type operator[](const std::size_t i) const noexcept {
+		return static_cast<value_type>(Op()(expr_[i]));
+	}
+
+private:
+	E expr_;
+};
+
+/// Wrap an operand as an expression node
+template<typename T>
+auto make_vector_node(T&& value) {
+	using type = std::remove_cvref_t<T>;
+	if constexpr ( is_std_vector<type>::value ) {
+		if constexpr ( std::is_lvalue_reference<T>::value ) {
+			return vector_leaf<const type&>(value);
+		}
+		else {
+			return vector_leaf<type>(std::move(value));
+		}
+	}
+	else if constexpr ( is_vector_expression<type>::value ) {
+		return type(std::forward<T>(value));
+	}
+	else {
+		return vector_scalar<type>(value);
+	}
+}
+
+/// Build binary expression node of two operands
+template<typename Op, typename L, typename R>
+auto make_vector_binary(L&& lhs, R&& rhs) {
+	using lhs_node = decltype(make_vector_node(std::forward<L>(lhs)));
+	using rhs_node = decltype(make_vector_node(std::forward<R>(rhs)));
+	return vector_binary<Op, lhs_node, rhs_node>(make_vector_node(std::forward<L>(lhs)), make_vector_node(std::forward<R>(rhs)));
+}
+
+/// Element access of an operand treating scalars as constant
+template<typename T>
+decltype(auto) vector_element(const T& value, const std::size_t i) noexcept {
+	if constexpr ( vector_operand<T> ) {
+		return value[i];
+	}
+	else {
+		return (value);
+	}
+}
+
+} /* namespace detail */
+/// @endcond
+
+
+/// Evaluate an expression into a std::vector of its value type
+/**
+ * \code
+ * auto r = xstd::eval(a*x + y); // std::vector
+ * \endcode
+ */
+template<typename Expression>
+std::vector<typename Expression::value_type> eval(const vector_expression<Expression>& expr){
+	return expr;
+}
+
+/// Assign an expression into an existing vector without allocating
+/**
+ * The destination is resized to the expression length. Since every
+ * element is computed from the same index of the operands the
+ * destination may also appear within the expression.
+ *
+ * \code
+ * xstd::assign(r, r - alpha*q); // no temporary
+ * \endcode
+ *
+ * \param dest[out] Vector to hold the result
+ * \param expr[in] Expression to evaluate
+ */
+template<typename T, typename A, typename Expression>
+void assign(std::vector<T,A>& dest, const vector_expression<Expression>& expr){
+	const auto& e = expr.derived();
+	const auto  n = e.size();
+	if( dest.size() != n ){
+		dest.resize(n);
+	}
+	for(std::size_t i = 0; i < n; ++i){
+		dest[i] = static_cast<T>(e[i]);
+	}
+}
+
+/// Compare an expression element wise to a vector or expression
+template<typename L, typename R>
+requires (detail::vector_operand<L> && detail::vector_operand<R> &&
+		 (detail::is_vector_expression<L>::value || detail::is_vector_expression<R>::value))
+bool operator==(const L& a, const R& b) noexcept {
+	if( a.size() != b.size() ){
+		return false;
+	}
+	for(std::size_t i = 0; i < a.size(); ++i){
+		if( not (a[i] == b[i]) ){
+			return false;
+		}
+	}
+	return true;
+}
+
+} /* namespace xstd */
+
+#endif /* INCLUDE_XSTD_DETAIL_VECTOR_VECTOR_EXPRESSION_HPP_ */
@@ -9,10 +9,20 @@
 #define VECTOR_MATH_HPP_
 
 #include "xstd/assert.hpp"
-
+#include "xstd/detail/config/restrict.hpp"
+#include "xstd/detail/memory/aligned.hpp"
+#include "xstd/detail/memory/allocator/aligned_allocator.hpp"
+#include "xstd/detail/vector/simd_reduce.hpp"
+#include "xstd/detail/vector/vector_expression.hpp"
+
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
+#include <functional>
+#include <limits>
 #include <vector>
 #include <type_traits>
+#include <utility>
 
 
 /**
@@ -24,11 +34,10 @@
  *
  * \details
  * Provides template functions for math operations on std::vector<>.
- * The operations are inefficient and the user should consider some
- * type of TMP lazy evaluation library if performance is a concern.
- * Furthermore, the std::vector<> operations have assume the default
- * allocator when returning a std::vector<> irrespective of the
- * allocator types of the std::vector passed in. *
+ * The arithmetic operators return lazy expressions (see
+ * vector_expression.hpp) which are evaluated within a single loop
+ * once converted to a std::vector of any allocator, passed to
+ * xstd::assign or used on the right of a compound assignment.
  *
  * Note:
  * All functions are added into xstd namespace so any code using the
@@ -41,13 +50,11 @@ namespace xstd {
 // ============================================================
 //                    Unary Operations
 // ============================================================
-template<typename T, typename A>
-std::vector<T,A> operator -(const std::vector<T,A>& a) noexcept{
-	std::vector<T,A> ans(a.size());
-	for(std::size_t i = 0; i < a.size(); ++i){
-		ans[i] = -a[i];
-	}
-	return ans;
+template<typename E>
+requires detail::vector_operand<E>
+auto operator -(E&& a) noexcept{
+	using node_type = decltype(detail::make_vector_node(std::forward<E>(a)));
+	return detail::vector_unary<std::negate<>, node_type>(detail::make_vector_node(std::forward<E>(a)));
 }
 
 template<typename T1, typename A1>
@@ -55,11 +62,18 @@ std::vector<T1,A1> operator +(const std::vector<T1,A1>& a) noexcept{
 	return a;
 }
 
+template<typename E>
+E operator +(const vector_expression<E>& a) noexcept{
+	return a.derived();
+}
+
 // ============================================================
-//                Vector / Scalar Operations
+//                   Compound Assignment
 // ============================================================
 //
 // Note:
+// The right hand side may be a scalar, vector or expression which
+// is evaluated within the same loop without any temporary vector.
 // Tested these loops using a standard index for loop (shown below)
 // and the assembly was identical for gnu & clang.
 // for(std::size_t i = 0; i < a.size(); ++i){
@@ -67,186 +81,108 @@ std::vector<T1,A1> operator +(const std::vector<T1,A1>& a) noexcept{
 //
 template<typename T1, typename A1, typename T2>
 void operator +=(std::vector<T1,A1>& a, const T2& b) noexcept{
-	STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
-	for(auto& val : a){ // Compiler explorer shows exact code as loop
-		val += b;
+	if constexpr ( detail::vector_operand<T2> ) {
+		ASSERT(a.size() == b.size());
+	}
+	else {
+		STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
+	}
+	for(std::size_t i = 0; i < a.size(); ++i){
+		a[i] += detail::vector_element(b,i);
 	}
 }
 
 template<typename T1, typename A1, typename T2>
 void operator -=(std::vector<T1,A1>& a, const T2& b) noexcept{
-	STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
-	for(auto& val : a){
-		val -= b;
+	if constexpr ( detail::vector_operand<T2> ) {
+		ASSERT(a.size() == b.size());
+	}
+	else {
+		STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
+	}
+	for(std::size_t i = 0; i < a.size(); ++i){
+		a[i] -= detail::vector_element(b,i);
 	}
 }
 
 template<typename T1, typename A1, typename T2>
 void operator *=(std::vector<T1,A1>& a, const T2& b) noexcept{
-	STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
-	for(auto& val : a){
-		val *= b;
+	if constexpr ( detail::vector_operand<T2> ) {
+		ASSERT(a.size() == b.size());
+	}
+	else {
+		STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
+	}
+	for(std::size_t i = 0; i < a.size(); ++i){
+		a[i] *= detail::vector_element(b,i);
 	}
 }
 
 template<typename T1, typename A1, typename T2>
 void operator /=(std::vector<T1,A1>& a, const T2& b) noexcept{
-	STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
-	for(auto& val : a){
-		val /= b;
+	if constexpr ( detail::vector_operand<T2> ) {
+		ASSERT(a.size() == b.size());
+	}
+	else {
+		STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
+	}
+	for(std::size_t i = 0; i < a.size(); ++i){
+		a[i] /= detail::vector_element(b,i);
 	}
-}
-
-template<typename T1, typename A1, typename T2>
-std::vector<std::common_type_t<T1,T2>>
-operator +(const std::vector<T1,A1>& a, const T2& b) noexcept{
-	std::vector<std::common_type_t<T1,T2>> ans(a);
-	ans += b;
-	return ans;
-}
-
-template<typename T1, typename A1, typename T2>
-std::vector<std::common_type_t<T1,T2>>
-operator +(const T2& b, const std::vector<T1,A1>& a) noexcept{
-	std::vector<std::common_type_t<T1,T2>> ans(a);
-	ans += b;
-	return ans;
-}
-
-template<typename T1, typename A1, typename T2>
-std::vector<std::common_type_t<T1,T2>>
-operator -(const std::vector<T1,A1>& a, const T2& b) noexcept{
-	std::vector<std::common_type_t<T1,T2>> ans(a);
-	ans -= b;
-	return ans;
-}
-
-template<typename T1, typename A1, typename T2>
-std::vector<std::common_type_t<T1,T2>>
-operator -(const T2& b, const std::vector<T1,A1>& a) noexcept{
-	std::vector<std::common_type_t<T1,T2>> ans(a.size(),b);
-	ans -= a;
-	return ans;
-}
-
-template<typename T1, typename A1, typename T2>
-std::vector<std::common_type_t<T1,T2>>
-operator *(const std::vector<T1,A1>& a, const T2& b) noexcept{
-	std::vector<std::common_type_t<T1,T2>> ans(a);
-	ans *= b;
-	return ans;
-}
-
-template<typename T1, typename A1, typename T2>
-std::vector<std::common_type_t<T1,T2>>
-operator *(const T2& b, const std::vector<T1,A1>& a) noexcept{
-	std::vector<std::common_type_t<T1,T2>> ans(a);
-	ans *= b;
-	return ans;
-}
-
-template<typename T1, typename A1, typename T2>
-std::vector<std::common_type_t<T1,T2>>
-operator /(const std::vector<T1,A1>& a, const T2& b) noexcept{
-	std::vector<std::common_type_t<T1,T2>> ans(a);
-	ans /= b;
-	return ans;
-}
-
-template<typename T1, typename A1, typename T2>
-std::vector<std::common_type_t<T1,T2>>
-operator /(const T2& b, const std::vector<T1,A1>& a) noexcept{
-	std::vector<std::common_type_t<T1,T2>> ans(a.size(),b);
-	ans /= a;
-	return ans;
 }
 
 // ============================================================
-//                Vector / Vector Operations
+//          Vector / Scalar and Vector / Vector Operations
 // ============================================================
-
-
-template<typename T1, typename A1, typename T2, typename A2>
-void operator +=(std::vector<T1,A1>& a, const std::vector<T2,A2>& b) noexcept{
-    STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
-    ASSERT(a.size() == b.size());
-    for(std::size_t i = 0; i < a.size(); ++i){
-        a[i] += b[i];
-    }
-}
-
-template<typename T1, typename A1, typename T2, typename A2>
-void operator -=(std::vector<T1,A1>& a, const std::vector<T2,A2>& b) noexcept{
-    STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
-    ASSERT(a.size() == b.size());
-    for(std::size_t i = 0; i < a.size(); ++i){
-        a[i] -= b[i];
-    }
-}
-
-template<typename T1, typename A1, typename T2, typename A2>
-void operator *=(std::vector<T1,A1>& a, const std::vector<T2,A2>& b) noexcept{
-    STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
-    ASSERT(a.size() == b.size());
-    for(std::size_t i = 0; i < a.size(); ++i){
-        a[i] *= b[i];
-    }
-}
-
-template<typename T1, typename A1, typename T2, typename A2>
-void operator /=(std::vector<T1,A1>& a, const std::vector<T2,A2>& b) noexcept{
-    STATIC_ASSERT(std::is_convertible<T2,T1>::value, "Type Mismatch");
-    ASSERT(a.size() == b.size());
-    for(std::size_t i = 0; i < a.size(); ++i){
-        a[i] /= b[i];
-    }
+//
+// Note:
+// Each operator returns a lazy expression of the common value
+// type which is evaluated once converted to a std::vector, passed
+// to xstd::assign or used within a compound assignment.
+//
+template<typename L, typename R>
+requires (detail::vector_operand<L> || detail::vector_operand<R>)
+auto operator +(L&& a, R&& b){
+	return detail::make_vector_binary<std::plus<>>(std::forward<L>(a), std::forward<R>(b));
 }
 
-template<typename T1, typename A1, typename T2, typename A2>
-std::vector<std::common_type_t<T1,T2>>
-operator +(const std::vector<T1,A1>& a, const std::vector<T2,A2>& b) noexcept{
-	ASSERT(a.size() == b.size());
-	std::vector<std::common_type_t<T1,T2>> ans(a);
-	ans += b;
-	return ans;
+template<typename L, typename R>
+requires (detail::vector_operand<L> || detail::vector_operand<R>)
+auto operator -(L&& a, R&& b){
+	return detail::make_vector_binary<std::minus<>>(std::forward<L>(a), std::forward<R>(b));
 }
 
-template<typename T1, typename A1, typename T2, typename A2>
-std::vector<std::common_type_t<T1,T2>>
-operator -(const std::vector<T1,A1>& a, const std::vector<T2,A2>& b) noexcept{
-	ASSERT(a.size() == b.size());
-	std::vector<std::common_type_t<T1,T2>> ans(a);
-	ans -= b;
-	return ans;
+template<typename L, typename R>
+requires (detail::vector_operand<L> || detail::vector_operand<R>)
+auto operator *(L&& a, R&& b){
+	return detail::make_vector_binary<std::multiplies<>>(std::forward<L>(a), std::forward<R>(b));
 }
 
-template<typename T1, typename A1, typename T2, typename A2>
-std::vector<std::common_type_t<T1,T2>>
-operator *(const std::vector<T1,A1>& a, const std::vector<T2,A2>& b) noexcept{
-	ASSERT(a.size() == b.size());
-	std::vector<std::common_type_t<T1,T2>> ans(a);
-	ans *= b;
-	return ans;
-}
-
-template<typename T1, typename A1, typename T2, typename A2>
-std::vector<std::common_type_t<T1,T2>>
-operator /(const std::vector<T1,A1>& a, const std::vector<T2,A2>& b) noexcept{
-	ASSERT(a.size() == b.size());
-	std::vector<std::common_type_t<T1,T2>> ans(a);
-	ans /= b;
-	return ans;
+template<typename L, typename R>
+requires (detail::vector_operand<L> || detail::vector_operand<R>)
+auto operator /(L&& a, R&& b){
+	return detail::make_vector_binary<std::divides<>>(std::forward<L>(a), std::forward<R>(b));
 }
 
 // ============================================================
 //                Linear Algebra Operations
 // ============================================================
-
+//
+// Note:
+// Reductions of float and double vectors add in order by default.
+// Passing summation::fast selects SIMD kernels with multiple
+// accumulators for the running CPU (see simd_reduce.hpp).
+//
 
 template<typename T1, typename A1, typename T2, typename A2>
 std::common_type_t<T1,T2>
-dot_product(const std::vector<T1,A1>& a, const std::vector<T2,A2>& b) noexcept{
+dot_product(const std::vector<T1,A1>& a, const std::vector<T2,A2>& b, const summation mode = summation::deterministic) noexcept{
     ASSERT(a.size() == b.size());
+    if constexpr ( std::is_same<T1,T2>::value && detail::simd_reducible<T1> ) {
+        if( mode == summation::fast ){
+            return detail::simd_dot(a.data(), b.data(), a.size());
+        }
+    }
     std::common_type_t<T1,T2> ans(0);
 	for(std::size_t i = 0; i < a.size(); ++i){
 		ans += (a[i] * b[i]);
@@ -268,8 +204,13 @@ cross_product(const std::vector<T1,A1>& a, const std::vector<T2,A2>& b) noexcept
 
 template<typename T, typename A>
 T
-norm1(const std::vector<T,A>& a) noexcept{
+norm1(const std::vector<T,A>& a, const summation mode = summation::deterministic) noexcept{
 	using std::abs;
+	if constexpr ( detail::simd_reducible<T> ) {
+		if( mode == summation::fast ){
+			return detail::simd_asum(a.data(), a.size());
+		}
+	}
 	T ans(0);
 	for(std::size_t i = 0; i < a.size(); ++i){
 		ans += abs(a[i]);
@@ -279,23 +220,273 @@ norm1(const std::vector<T,A>& a) noexcept{
 
 template<typename T, typename A>
 T
-norm2(const std::vector<T,A>& a) noexcept{
+norm2(const std::vector<T,A>& a, const summation mode = summation::deterministic) noexcept{
 	using std::sqrt;
-	return sqrt(dot_product(a,a));
+	return sqrt(dot_product(a,a,mode));
 }
 
 template<typename T, typename A>
 T
 norm_inf(const std::vector<T,A>& a) noexcept{
 	using std::abs;
-	using std::max;
+	if constexpr ( detail::simd_reducible<T> ) {
+		return detail::simd_amax(a.data(), a.size());
+	}
 	T ans(0);
 	for(std::size_t i = 0; i < a.size(); ++i){
-		ans = max(ans, abs(a[i]));
+		ans = detail::nan_max(ans, T(abs(a[i])));
+	}
+	return ans;
+}
+
+template<typename E1, typename E2>
+requires (detail::is_vector_expression<E1>::value || detail::is_vector_expression<E2>::value)
+auto
+dot_product(const E1& a, const E2& b) noexcept{
+	ASSERT(a.size() == b.size());
+	std::common_type_t<typename E1::value_type, typename E2::value_type> ans(0);
+	for(std::size_t i = 0; i < a.size(); ++i){
+		ans += (a[i] * b[i]);
+	}
+	return ans;
+}
+
+template<typename E>
+typename E::value_type
+norm1(const vector_expression<E>& a) noexcept{
+	using std::abs;
+	typename E::value_type ans(0);
+	for(std::size_t i = 0; i < a.size(); ++i){
+		ans += abs(a[i]);
 	}
 	return ans;
 }
 
+template<typename E>
+typename E::value_type
+norm2(const vector_expression<E>& a) noexcept{
+	using std::sqrt;
+	typename E::value_type ans(0);
+	for(std::size_t i = 0; i < a.size(); ++i){
+		const auto v = a[i];
+		ans += v * v;
+	}
+	return sqrt(ans);
+}
+
+template<typename E>
+typename E::value_type
+norm_inf(const vector_expression<E>& a) noexcept{
+	using std::abs;
+	using value_type = typename E::value_type;
+	value_type ans(0);
+	for(std::size_t i = 0; i < a.size(); ++i){
+		ans = detail::nan_max(ans, value_type(abs(a[i])));
+	}
+	return ans;
+}
+
+// ============================================================
+//                   Fused BLAS-1 Operations
+// ============================================================
+//
+// Note:
+// In place kernels performing the inner loops of iterative solvers
+// without the temporaries of the arithmetic operators. The data of
+// vectors using xstd::aligned_allocator is passed to the loops with
+// its alignment so the compiler can emit aligned vector loads.
+//
+
+/// @cond SKIP_DETAIL
+namespace detail {
+
+/// Guaranteed alignment of the data allocated by an allocator
+template<typename Allocator>
+struct allocator_alignment {
+	static constexpr std::size_t value = alignof(typename Allocator::value_type);
+};
+
+template<typename T, std::size_t Alignment>
+struct allocator_alignment<aligned_allocator<T,Alignment>> {
+	static constexpr std::size_t value = std::max(Alignment, alignof(T));
+};
+
+/// Data of vector with the alignment of its allocator
+template<typename T, typename A>
+T* aligned_data(std::vector<T,A>& v) noexcept {
+	return assume_aligned<allocator_alignment<A>::value>(v.data());
+}
+
+template<typename T, typename A>
+const T* aligned_data(const std::vector<T,A>& v) noexcept {
+	return assume_aligned<allocator_alignment<A>::value>(v.data());
+}
+
+template<typename T>
+void blas_scal(const std::size_t n, const T a, T* XSTD_RESTRICT x) noexcept {
+	for(std::size_t i = 0; i < n; ++i){
+		x[i] *= a;
+	}
+}
+
+template<typename T>
+void blas_axpy(const std::size_t n, const T a, const T* XSTD_RESTRICT x, T* XSTD_RESTRICT y) noexcept {
+	for(std::size_t i = 0; i < n; ++i){
+		y[i] += a * x[i];
+	}
+}
+
+template<typename T>
+void blas_axpby(const std::size_t n, const T a, const T* XSTD_RESTRICT x, const T b, T* XSTD_RESTRICT y) noexcept {
+	for(std::size_t i = 0; i < n; ++i){
+		y[i] = a * x[i] + b * y[i];
+	}
+}
+
+template<typename T>
+void blas_waxpby(const std::size_t n, const T a, const T* XSTD_RESTRICT x, const T b, const T* XSTD_RESTRICT y, T* XSTD_RESTRICT w) noexcept {
+	for(std::size_t i = 0; i < n; ++i){
+		w[i] = a * x[i] + b * y[i];
+	}
+}
+
+/// Sum of squares of x scaled by 1/scale
+template<typename T>
+T blas_scaled_ssq(const std::size_t n, const T scale, const T* XSTD_RESTRICT x) noexcept {
+	const T inv = T(1) / scale;
+	T ans(0);
+	for(std::size_t i = 0; i < n; ++i){
+		const T v = x[i] * inv;
+		ans += v * v;
+	}
+	return ans;
+}
+
+} /* namespace detail */
+/// @endcond
+
+/// Scale vector in place (x = a*x)
+template<typename T, typename A>
+void scal(const T a, std::vector<T,A>& x) noexcept {
+	detail::blas_scal(x.size(), a, detail::aligned_data(x));
+}
+
+/// Add scaled vector in place (y = a*x + y)
+/**
+ * \code
+ * xstd::axpy(alpha, p, x); // x += alpha*p
+ * \endcode
+ */
+template<typename T, typename A1, typename A2>
+void axpy(const T a, const std::vector<T,A1>& x, std::vector<T,A2>& y) noexcept {
+	ASSERT(x.size() == y.size());
+	if( static_cast<const void*>(&x) == static_cast<const void*>(&y) ){
+		scal(T(1) + a, y);
+		return;
+	}
+	detail::blas_axpy(y.size(), a, detail::aligned_data(x), detail::aligned_data(y));
+}
+
+/// Scale and add vector in place (y = a*x + b*y)
+/**
+ * \code
+ * xstd::axpby(T(1), r, beta, p); // p = r + beta*p
+ * \endcode
+ */
+template<typename T, typename A1, typename A2>
+void axpby(const T a, const std::vector<T,A1>& x, const T b, std::vector<T,A2>& y) noexcept {
+	ASSERT(x.size() == y.size());
+	if( static_cast<const void*>(&x) == static_cast<const void*>(&y) ){
+		scal(a + b, y);
+		return;
+	}
+	detail::blas_axpby(y.size(), a, detail::aligned_data(x), b, detail::aligned_data(y));
+}
+
+/// Scaled sum of two vectors (w = a*x + b*y)
+/**
+ * The output is resized to the length of the inputs and may be the
+ * same vector as either input.
+ */
+template<typename T, typename A1, typename A2, typename A3>
+void waxpby(const T a, const std::vector<T,A1>& x, const T b, const std::vector<T,A2>& y, std::vector<T,A3>& w) {
+	ASSERT(x.size() == y.size());
+	const auto w_addr = static_cast<const void*>(&w);
+	const bool w_is_x = (w_addr == static_cast<const void*>(&x));
+	const bool w_is_y = (w_addr == static_cast<const void*>(&y));
+	if( w_is_x && w_is_y ){
+		scal(a + b, w);
+	}
+	else if( w_is_x ){
+		detail::blas_axpby(w.size(), b, detail::aligned_data(y), a, detail::aligned_data(w));
+	}
+	else if( w_is_y ){
+		detail::blas_axpby(w.size(), a, detail::aligned_data(x), b, detail::aligned_data(w));
+	}
+	else {
+		w.resize(x.size());
+		detail::blas_waxpby(w.size(), a, detail::aligned_data(x), b, detail::aligned_data(y), detail::aligned_data(w));
+	}
+}
+
+/// Euclidean norm safe from overflow and underflow
+/**
+ * Returns sqrt(sum x[i]^2) without overflow when the squares exceed
+ * the range of T or loss of accuracy when they underflow. The sum of
+ * squares is computed directly and only recomputed with every value
+ * scaled by the largest magnitude when it left the safe range.
+ */
+template<typename T, typename A>
+T nrm2(const std::vector<T,A>& x) noexcept {
+	STATIC_ASSERT(std::is_floating_point<T>::value, "Norm requires floating point values");
+	using std::sqrt;
+	const T ssq = dot_product(x, x);
+	if( std::isfinite(ssq) && (ssq >= std::numeric_limits<T>::min() / std::numeric_limits<T>::epsilon()) ){
+		return sqrt(ssq);
+	}
+	const T scale = norm_inf(x);
+	if( (scale == T(0)) || not std::isfinite(scale) ){
+		return scale;
+	}
+	return scale * sqrt(detail::blas_scaled_ssq(x.size(), scale, detail::aligned_data(x)));
+}
+
+/// Dot product and Euclidean norm computed within a single pass
+template<typename T>
+struct dot_norm_result {
+	T dot;  ///< Dot product of x and y
+	T norm; ///< Euclidean norm of x
+};
+
+/// Dot product x.y and norm ||x|| reading both vectors once
+/**
+ * \code
+ * const auto [rz, r_norm] = xstd::dot_norm(r, z);
+ * \endcode
+ */
+template<typename T, typename A1, typename A2>
+dot_norm_result<T> dot_norm(const std::vector<T,A1>& x, const std::vector<T,A2>& y) noexcept {
+	using std::sqrt;
+	ASSERT(x.size() == y.size());
+	const auto n  = x.size();
+	const T* XSTD_RESTRICT px = detail::aligned_data(x);
+	const T* XSTD_RESTRICT py = detail::aligned_data(y);
+	T d0(0), d1(0), s0(0), s1(0);
+	std::size_t i = 0;
+	for(; i + 2 <= n; i += 2){
+		d0 += px[i+0] * py[i+0];
+		d1 += px[i+1] * py[i+1];
+		s0 += px[i+0] * px[i+0];
+		s1 += px[i+1] * px[i+1];
+	}
+	for(; i < n; ++i){
+		d0 += px[i] * py[i];
+		s0 += px[i] * px[i];
+	}
+	return {d0 + d1, sqrt(s0 + s1)};
+}
+
+
 
 } /* namespace xstd */
 
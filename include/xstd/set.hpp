@@ -9,7 +9,15 @@
 #define INCLUDE_XSTD_SET_HPP_
 
 
+#include "xstd/detail/set/cardinality.hpp"
+#include "xstd/detail/set/difference.hpp"
+#include "xstd/detail/set/flat_map.hpp"
+#include "xstd/detail/set/flat_set.hpp"
 #include "xstd/detail/set/intersection.hpp"
+#include "xstd/detail/set/intersection_count.hpp"
+#include "xstd/detail/set/loser_tree.hpp"
+#include "xstd/detail/set/symmetric_difference.hpp"
+#include "xstd/detail/set/union.hpp"
 
 
 #endif /* INCLUDE_XSTD_SET_HPP_ */
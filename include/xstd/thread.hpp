@@ -0,0 +1,13 @@
+/*
+ * thread.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+#ifndef INCLUDE_XSTD_THREAD_HPP_
+#define INCLUDE_XSTD_THREAD_HPP_
+
+#include "xstd/detail/thread/thread_pool.hpp"
+
+#endif /* INCLUDE_XSTD_THREAD_HPP_ */
@@ -11,6 +11,7 @@
 
 #include "xstd/detail/type_traits/optimize_empty_base.hpp"
 #include "xstd/detail/type_traits/container_checks.hpp"
+#include "xstd/detail/type_traits/relocatable.hpp"
 #include "xstd/detail/type_traits/type.hpp"
 
 #endif /* INCLUDE_XSTD_TYPE_TRAITS_HPP_ */
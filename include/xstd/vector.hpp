@@ -8,8 +8,13 @@
 #ifndef INCLUDE_XSTD_VECTOR_HPP_
 #define INCLUDE_XSTD_VECTOR_HPP_
 
+#include "xstd/detail/vector/bounded_deque.hpp"
+#include "xstd/detail/vector/bounded_ring.hpp"
 #include "xstd/detail/vector/bounded_vector.hpp"
 #include "xstd/detail/vector/multi_indexer.hpp"
+#include "xstd/detail/vector/ndarray.hpp"
+#include "xstd/detail/vector/parallel_vector_math.hpp"
+#include "xstd/detail/vector/small_vector.hpp"
 #include "xstd/detail/vector/vector_math.hpp"
 
 
@@ -0,0 +1,79 @@
+/*
+ * branchless_search.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/algorithm/branchless_search.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+
+TEST_CASE("Branchless Lower Bound", "[default]") {
+
+	SECTION("Matches std::lower_bound"){
+		for(std::size_t n : {0, 1, 2, 3, 7, 8, 100, 1000}){
+			std::vector<int> a(n);
+			std::iota(a.begin(), a.end(), 0);
+			std::transform(a.begin(), a.end(), a.begin(), [](int v){return 3*v;});
+			for(int v = -2; v <= static_cast<int>(3*n + 2); ++v){
+				const auto expect = std::lower_bound(a.begin(), a.end(), v);
+				REQUIRE( xstd::branchless_lower_bound(a.begin(), a.end(), v) == expect );
+			}
+		}
+	}
+
+	SECTION("Duplicates and Custom Comparison"){
+		std::vector<int> a = {9, 7, 7, 7, 3, 1};
+		REQUIRE( xstd::branchless_lower_bound(a.begin(), a.end(), 7, std::greater<>()) == a.begin() + 1 );
+		REQUIRE( xstd::branchless_lower_bound(a.begin(), a.end(), 0, std::greater<>()) == a.end() );
+	}
+}
+
+TEST_CASE("Eytzinger Lower Bound", "[default]") {
+
+	SECTION("Layout"){
+		std::vector<int> sorted = {1, 2, 3, 4, 5, 6, 7};
+		std::vector<int> tree(sorted.size());
+		REQUIRE( xstd::make_eytzinger(sorted.begin(), sorted.end(), tree.begin()) == tree.end() );
+		REQUIRE( tree == std::vector<int>{4, 2, 6, 1, 3, 5, 7} );
+	}
+
+	SECTION("Matches std::lower_bound"){
+		for(std::size_t n : {0, 1, 2, 3, 7, 8, 100, 1000}){
+			std::vector<int> a(n);
+			std::iota(a.begin(), a.end(), 0);
+			std::transform(a.begin(), a.end(), a.begin(), [](int v){return 3*v;});
+			std::vector<int> tree(n);
+			xstd::make_eytzinger(a.begin(), a.end(), tree.begin());
+			for(int v = -2; v <= static_cast<int>(3*n + 2); ++v){
+				const auto expect = std::lower_bound(a.begin(), a.end(), v);
+				const auto found  = xstd::eytzinger_lower_bound(tree.begin(), tree.end(), v);
+				if( expect == a.end() ){
+					REQUIRE( found == tree.end() );
+				}
+				else {
+					REQUIRE( found != tree.end() );
+					REQUIRE( *found == *expect );
+				}
+			}
+		}
+	}
+
+	SECTION("Strings"){
+		std::vector<std::string> a = {"apple", "kiwi", "lemon", "mango", "pear"};
+		std::vector<std::string> tree(a.size());
+		xstd::make_eytzinger(a.begin(), a.end(), tree.begin());
+		REQUIRE( *xstd::eytzinger_lower_bound(tree.begin(), tree.end(), std::string("l")) == "lemon" );
+		REQUIRE( *xstd::eytzinger_lower_bound(tree.begin(), tree.end(), std::string("mango")) == "mango" );
+		REQUIRE( xstd::eytzinger_lower_bound(tree.begin(), tree.end(), std::string("zebra")) == tree.end() );
+	}
+}
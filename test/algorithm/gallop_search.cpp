@@ -0,0 +1,48 @@
+/*
+ * gallop_search.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/algorithm/gallop_search.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <vector>
+
+
+TEST_CASE("Gallop Lower Bound", "[default]") {
+
+	SECTION("Matches std::lower_bound"){
+		for(std::size_t n : {0, 1, 2, 3, 7, 8, 100, 1000}){
+			std::vector<int> a(n);
+			std::iota(a.begin(), a.end(), 0);
+			std::transform(a.begin(), a.end(), a.begin(), [](int v){return 3*v;});
+			for(int v = -2; v <= static_cast<int>(3*n + 2); ++v){
+				for(std::size_t start : {std::size_t(0), n/3, n/2}){
+					const auto expect = std::lower_bound(a.begin() + start, a.end(), v);
+					const auto found  = xstd::gallop_lower_bound(a.begin() + start, a.end(), v);
+					REQUIRE( found == expect );
+				}
+			}
+		}
+	}
+
+	SECTION("Custom Comparison"){
+		std::vector<int> a = {9, 7, 5, 3, 1};
+		REQUIRE( xstd::gallop_lower_bound(a.begin(), a.end(), 4, std::greater<>()) == a.begin() + 3 );
+		REQUIRE( xstd::gallop_lower_bound(a.begin(), a.end(), 0, std::greater<>()) == a.end() );
+	}
+
+	SECTION("Forward Iterators"){
+		std::list<int> a = {1, 2, 4, 8, 16};
+		REQUIRE( *xstd::gallop_lower_bound(a.begin(), a.end(), 5) == 8 );
+		REQUIRE( xstd::gallop_lower_bound(a.begin(), a.end(), 17) == a.end() );
+	}
+}
@@ -0,0 +1,181 @@
+/**
+ * \file       msd_radix.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/algorithm/msd_radix_sort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace {
+
+std::string random_string(std::mt19937_64& mte, const std::size_t max_length, const char lo, const char hi) {
+	std::uniform_int_distribution<std::size_t> length_dist(0, max_length);
+	std::uniform_int_distribution<int> char_dist(lo, hi);
+	std::string str(length_dist(mte), ' ');
+	for(auto& c : str){
+		c = static_cast<char>(char_dist(mte));
+	}
+	return str;
+}
+
+}
+
+
+TEST_CASE("MSD Radix Sort", "[default]") {
+
+	std::mt19937_64 mte(23);
+
+	SECTION("Empty and Single"){
+		std::vector<std::string> a;
+		xstd::msd_radix_sort(a.begin(), a.end());
+		REQUIRE( a.empty() );
+
+		a.push_back("only");
+		xstd::msd_radix_sort(a.begin(), a.end());
+		REQUIRE( a[0] == "only" );
+	}
+
+	SECTION("Random Strings"){
+		for(std::size_t n : {10, 32, 33, 1000, 50000}){
+			std::vector<std::string> a(n);
+			std::generate(a.begin(), a.end(), [&](){return random_string(mte, 20, 'a', 'e');});
+			std::vector<std::string> b(a);
+
+			std::sort(a.begin(), a.end());
+			xstd::msd_radix_sort(b.begin(), b.end());
+			REQUIRE( a == b );
+		}
+	}
+
+	SECTION("Long Shared Prefixes"){
+		// Prefixes longer than the 8 byte cache force refills
+		std::vector<std::string> a(20000);
+		std::generate(a.begin(), a.end(), [&](){
+			return "https://www.example.com/path/" + random_string(mte, 12, 'a', 'c');
+		});
+		std::vector<std::string> b(a);
+
+		std::sort(a.begin(), a.end());
+		xstd::msd_radix_sort(b.begin(), b.end());
+		REQUIRE( a == b );
+	}
+
+	SECTION("Full Byte Range and Embedded Nulls"){
+		std::vector<std::string> a(5000);
+		std::generate(a.begin(), a.end(), [&](){return random_string(mte, 10, -128, 127);});
+		a.push_back(std::string("ab", 2));
+		a.push_back(std::string("ab\0", 3));
+		a.push_back(std::string("ab\0\0", 4));
+		a.push_back(std::string());
+		std::vector<std::string> b(a);
+
+		std::sort(a.begin(), a.end());
+		xstd::msd_radix_sort(b.begin(), b.end());
+		REQUIRE( a == b );
+	}
+
+	SECTION("Duplicates"){
+		std::vector<std::string> a(10000, "duplicate_key_longer_than_cache");
+		for(std::size_t i = 0; i < a.size(); i += 3){
+			a[i] = "another_key";
+		}
+		std::vector<std::string> b(a);
+
+		std::sort(a.begin(), a.end());
+		xstd::msd_radix_sort(b.begin(), b.end());
+		REQUIRE( a == b );
+	}
+
+	SECTION("String Views and C Strings"){
+		std::vector<std::string> storage(2000);
+		std::generate(storage.begin(), storage.end(), [&](){return random_string(mte, 15, 'a', 'z');});
+
+		std::vector<std::string_view> a(storage.begin(), storage.end());
+		std::vector<std::string_view> b(a);
+		std::sort(a.begin(), a.end());
+		xstd::msd_radix_sort(b.begin(), b.end());
+		REQUIRE( a == b );
+
+		std::vector<const char*> c;
+		for(const auto& s : storage){
+			c.push_back(s.c_str());
+		}
+		xstd::msd_radix_sort(c.begin(), c.end());
+		for(std::size_t i = 0; i < c.size(); ++i){
+			REQUIRE( a[i] == std::string_view(c[i]) );
+		}
+	}
+}
+
+
+TEST_CASE("MSD Radix Sort By Key", "[default]") {
+
+	std::mt19937_64 mte(29);
+
+	SECTION("Record Member"){
+		struct Page {
+			std::string   url;
+			std::uint32_t id;
+		};
+
+		std::vector<Page> a(3000);
+		for(std::size_t i = 0; i < a.size(); ++i){
+			a[i] = Page{"id/" + random_string(mte, 10, '0', '9'), static_cast<std::uint32_t>(i)};
+		}
+		std::vector<Page> b(a);
+
+		std::sort(a.begin(), a.end(), [](const Page& x, const Page& y){return x.url < y.url;});
+		xstd::msd_radix_sort(b.begin(), b.end(), [](const Page& p) -> const std::string& {return p.url;});
+		for(std::size_t i = 0; i < a.size(); ++i){
+			REQUIRE( a[i].url == b[i].url );
+		}
+	}
+
+	SECTION("Byte Sequences"){
+		std::uniform_int_distribution<int> byte_dist(0, 255);
+		std::uniform_int_distribution<std::size_t> length_dist(0, 24);
+
+		std::vector<std::vector<std::uint8_t>> a(4000);
+		for(auto& key : a){
+			key.resize(length_dist(mte));
+			for(auto& byte : key){
+				byte = static_cast<std::uint8_t>(byte_dist(mte));
+			}
+		}
+		std::vector<std::vector<std::uint8_t>> b(a);
+
+		std::sort(a.begin(), a.end());
+		xstd::msd_radix_sort(b.begin(), b.end());
+		REQUIRE( a == b );
+
+		std::vector<std::vector<std::uint8_t>> c(a.rbegin(), a.rend());
+		xstd::msd_radix_sort(c.begin(), c.end(), [](const std::vector<std::uint8_t>& key){
+			return std::span<const std::uint8_t>(key);
+		});
+		REQUIRE( a == c );
+	}
+
+	SECTION("Key Views"){
+		using xstd::detail::msd_key_view;
+		STATIC_REQUIRE( msd_key_view<const std::string&> );
+		STATIC_REQUIRE( msd_key_view<std::string_view> );
+		STATIC_REQUIRE( msd_key_view<std::span<const std::uint8_t>> );
+		STATIC_REQUIRE( msd_key_view<const char*> );
+		STATIC_REQUIRE( not msd_key_view<std::array<char,8>> );
+		STATIC_REQUIRE( not msd_key_view<std::string> );
+	}
+}
@@ -0,0 +1,101 @@
+/**
+ * \file       parallel_radix.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/algorithm/parallel_radix_sort.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+using ValueTypes = std::tuple<std::uint16_t, std::int32_t, std::uint64_t, float, double>;
+
+
+TEMPLATE_LIST_TEST_CASE("Parallel Radix Sort", "[default]", ValueTypes) {
+
+	const std::size_t N = 300000;
+	std::mt19937_64 mte(17);
+
+	std::vector<TestType> a(N);
+	if constexpr ( std::is_integral<TestType>::value ) {
+		std::uniform_int_distribution<std::int64_t> dist(std::numeric_limits<TestType>::min(), std::numeric_limits<TestType>::max());
+		std::generate(a.begin(), a.end(), [&](){return static_cast<TestType>(dist(mte));});
+	}
+	else {
+		std::uniform_real_distribution<TestType> dist(-1.0e3, 1.0e3);
+		std::generate(a.begin(), a.end(), [&](){return dist(mte);});
+	}
+
+	SECTION("Matches Serial Sort"){
+		for(std::size_t num_threads : {1, 2, 3, 8}){
+			xstd::thread_pool pool(num_threads);
+			std::vector<TestType> serial(a);
+			std::vector<TestType> parallel(a);
+			xstd::radix_sort(serial.begin(), serial.end());
+			xstd::parallel_radix_sort(pool, parallel.begin(), parallel.end());
+			REQUIRE( serial == parallel );
+			REQUIRE( std::is_sorted(parallel.begin(), parallel.end()) );
+		}
+	}
+
+	SECTION("Explicit Digits and Thread Count"){
+		std::vector<TestType> serial(a);
+		std::vector<TestType> parallel(a);
+		std::sort(serial.begin(), serial.end());
+		xstd::parallel_radix_sort(4, parallel.begin(), parallel.end());
+		REQUIRE( serial == parallel );
+
+		xstd::thread_pool pool(5);
+		std::vector<TestType> wide(a);
+		xstd::parallel_radix_sort<16>(pool, wide.begin(), wide.end());
+		REQUIRE( serial == wide );
+	}
+
+	SECTION("Small Ranges"){
+		xstd::thread_pool pool(4);
+		std::vector<TestType> serial(a.begin(), a.begin() + 1000);
+		std::vector<TestType> parallel(serial);
+		std::sort(serial.begin(), serial.end());
+		xstd::parallel_radix_sort(pool, parallel.begin(), parallel.end());
+		REQUIRE( serial == parallel );
+	}
+}
+
+
+TEST_CASE("Parallel Radix Sort By Key", "[default]") {
+
+	struct Record {
+		std::int32_t  key;
+		std::uint32_t id;
+	};
+
+	const std::size_t N = 200000;
+	std::mt19937_64 mte(19);
+	std::uniform_int_distribution<std::int32_t> dist(-5000, 5000);
+
+	std::vector<Record> a(N);
+	for(std::size_t i = 0; i < N; ++i){
+		a[i] = Record{dist(mte), static_cast<std::uint32_t>(i)};
+	}
+
+	SECTION("Stable and Identical to Serial"){
+		xstd::thread_pool pool(6);
+		std::vector<Record> serial(a);
+		std::vector<Record> parallel(a);
+		auto key_fn = [](const Record& r){ return r.key; };
+		xstd::radix_sort(serial.begin(), serial.end(), key_fn);
+		xstd::parallel_radix_sort(pool, parallel.begin(), parallel.end(), key_fn);
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( serial[i].id == parallel[i].id );
+		}
+	}
+}
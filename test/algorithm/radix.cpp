@@ -18,6 +18,7 @@
 
 
 using IndexTypes = std::tuple<std::int8_t, std::int16_t, std::int32_t, std::int64_t>;
+using UnsignedTypes = std::tuple<std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t>;
 
 
 TEMPLATE_LIST_TEST_CASE("Radix Sort", "[default]", IndexTypes) {
@@ -39,7 +40,7 @@ TEMPLATE_LIST_TEST_CASE("Radix Sort", "[default]", IndexTypes) {
 
         // Sort using the STL (assumed to work)
 		std::sort(a.begin(),a.end());
-        
+
         // Sort using my Radix sort
 		xstd::radix_sort(b.begin(),b.end());
 
@@ -51,3 +52,156 @@ TEMPLATE_LIST_TEST_CASE("Radix Sort", "[default]", IndexTypes) {
 }
 
 
+TEMPLATE_LIST_TEST_CASE("Radix Sort Unsigned", "[default]", UnsignedTypes) {
+
+	std::mt19937_64 mte(42);
+	std::uniform_int_distribution<std::uint64_t> dist(0, std::numeric_limits<TestType>::max());
+
+	SECTION("Default Digits"){
+		for(std::size_t n : {0, 1, 2, 63, 64, 65, 1000, 100000}){
+			std::vector<TestType> a(n);
+			std::generate(a.begin(), a.end(), [&](){return static_cast<TestType>(dist(mte));});
+			std::vector<TestType> b(a);
+
+			std::sort(a.begin(),a.end());
+			xstd::radix_sort(b.begin(),b.end());
+			REQUIRE( a == b );
+		}
+	}
+
+	SECTION("Explicit Digits"){
+		std::vector<TestType> a(10000);
+		std::generate(a.begin(), a.end(), [&](){return static_cast<TestType>(dist(mte));});
+		std::sort(a.begin(),a.end());
+
+		std::vector<TestType> b(a.rbegin(),a.rend());
+		xstd::radix_sort<8>(b.begin(),b.end());
+		REQUIRE( a == b );
+
+		std::vector<TestType> c(a.rbegin(),a.rend());
+		xstd::radix_sort<11>(c.begin(),c.end());
+		REQUIRE( a == c );
+
+		std::vector<TestType> d(a.rbegin(),a.rend());
+		xstd::radix_sort<16>(d.begin(),d.end());
+		REQUIRE( a == d );
+	}
+
+	SECTION("Skipped Digits"){
+		// Only the low byte varies so all upper passes are skipped
+		std::vector<TestType> a(1000);
+		std::generate(a.begin(), a.end(), [&](){return static_cast<TestType>(dist(mte) & 0xFF);});
+		std::vector<TestType> b(a);
+
+		std::sort(a.begin(),a.end());
+		xstd::radix_sort(b.begin(),b.end());
+		REQUIRE( a == b );
+
+		// Every digit identical so no pass is performed
+		std::vector<TestType> c(1000, std::numeric_limits<TestType>::max());
+		xstd::radix_sort(c.begin(),c.end());
+		REQUIRE( std::all_of(c.begin(),c.end(),[](auto v){return v == std::numeric_limits<TestType>::max();}) );
+	}
+}
+
+
+TEMPLATE_LIST_TEST_CASE("Radix Sort Signed", "[default]", IndexTypes) {
+
+	std::mt19937_64 mte(7);
+	std::uniform_int_distribution<std::int64_t> dist(std::numeric_limits<TestType>::min(), std::numeric_limits<TestType>::max());
+
+	SECTION("Random Vector of Signed Values"){
+		std::vector<TestType> a(10000);
+		std::generate(a.begin(), a.end(), [&](){return static_cast<TestType>(dist(mte));});
+		a[0] = std::numeric_limits<TestType>::min();
+		a[1] = std::numeric_limits<TestType>::max();
+		a[2] = 0;
+		std::vector<TestType> b(a);
+
+		std::sort(a.begin(),a.end());
+		xstd::radix_sort(b.begin(),b.end());
+		REQUIRE( a == b );
+	}
+
+	SECTION("Key Ordering"){
+		REQUIRE( xstd::radix_key(TestType(-1)) < xstd::radix_key(TestType(0)) );
+		REQUIRE( xstd::radix_key(std::numeric_limits<TestType>::min()) == 0 );
+		REQUIRE( xstd::radix_key(std::numeric_limits<TestType>::max()) == std::numeric_limits<xstd::radix_key_t<TestType>>::max() );
+	}
+}
+
+
+using FloatTypes = std::tuple<float, double>;
+
+TEMPLATE_LIST_TEST_CASE("Radix Sort Floating Point", "[default]", FloatTypes) {
+
+	std::mt19937_64 mte(11);
+	std::uniform_real_distribution<TestType> dist(-1.0e6, 1.0e6);
+
+	SECTION("Random Vector of Mixed Sign Values"){
+		std::vector<TestType> a(10000);
+		std::generate(a.begin(), a.end(), [&](){return dist(mte);});
+		a[0] = std::numeric_limits<TestType>::lowest();
+		a[1] = std::numeric_limits<TestType>::max();
+		a[2] = -std::numeric_limits<TestType>::infinity();
+		a[3] = +std::numeric_limits<TestType>::infinity();
+		a[4] = std::numeric_limits<TestType>::denorm_min();
+		a[5] = 0;
+		std::vector<TestType> b(a);
+
+		std::sort(a.begin(),a.end());
+		xstd::radix_sort(b.begin(),b.end());
+		REQUIRE( a == b );
+	}
+
+	SECTION("Key Ordering"){
+		REQUIRE( xstd::radix_key(TestType(-2)) < xstd::radix_key(TestType(-1)) );
+		REQUIRE( xstd::radix_key(TestType(-1)) < xstd::radix_key(TestType(-0.0)) );
+		REQUIRE( xstd::radix_key(TestType(-0.0)) < xstd::radix_key(TestType(+0.0)) );
+		REQUIRE( xstd::radix_key(TestType(+0.0)) < xstd::radix_key(TestType(1)) );
+	}
+}
+
+
+TEST_CASE("Radix Sort By Key", "[default]") {
+
+	struct Record {
+		std::int64_t  time;
+		double        score;
+		std::uint32_t id;
+	};
+
+	std::mt19937_64 mte(13);
+	std::uniform_int_distribution<std::int64_t> time_dist(-1000, 1000);
+	std::uniform_real_distribution<double> score_dist(-10.0, 10.0);
+
+	std::vector<Record> a(5000);
+	for(std::size_t i = 0; i < a.size(); ++i){
+		a[i] = Record{time_dist(mte), score_dist(mte), static_cast<std::uint32_t>(i)};
+	}
+
+	SECTION("Signed Member Key is Stable"){
+		std::vector<Record> b(a);
+		std::stable_sort(a.begin(), a.end(), [](const Record& x, const Record& y){return x.time < y.time;});
+		xstd::radix_sort(b.begin(), b.end(), [](const Record& r){return r.time;});
+		for(std::size_t i = 0; i < a.size(); ++i){
+			REQUIRE( a[i].id == b[i].id );
+		}
+	}
+
+	SECTION("Floating Point Member Key"){
+		std::vector<Record> b(a);
+		std::stable_sort(a.begin(), a.end(), [](const Record& x, const Record& y){return x.score < y.score;});
+		xstd::radix_sort<16>(b.begin(), b.end(), [](const Record& r){return r.score;});
+		for(std::size_t i = 0; i < a.size(); ++i){
+			REQUIRE( a[i].id == b[i].id );
+		}
+	}
+
+	SECTION("Enumeration Key"){
+		enum class Level : std::int8_t { Low = -1, Mid = 0, High = 1 };
+		std::vector<Level> b = {Level::High, Level::Low, Level::Mid, Level::Low};
+		xstd::radix_sort(b.begin(), b.end());
+		REQUIRE( b == std::vector<Level>{Level::Low, Level::Low, Level::Mid, Level::High} );
+	}
+}
@@ -0,0 +1,125 @@
+/**
+ * \file       radix_argsort.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/algorithm/radix_argsort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+using KeyTypes = std::tuple<std::uint8_t, std::int32_t, std::int64_t, double>;
+
+
+TEMPLATE_LIST_TEST_CASE("Radix Argsort", "[default]", KeyTypes) {
+
+	std::mt19937_64 mte(31);
+	std::uniform_int_distribution<int> dist(-100, 100);
+
+	std::vector<TestType> keys(10000);
+	std::generate(keys.begin(), keys.end(), [&](){return static_cast<TestType>(dist(mte));});
+
+	SECTION("Stable Permutation"){
+		std::vector<std::uint32_t> expected(keys.size());
+		std::iota(expected.begin(), expected.end(), 0);
+		std::stable_sort(expected.begin(), expected.end(), [&](auto i, auto j){return keys[i] < keys[j];});
+
+		const auto perm = xstd::radix_argsort(keys);
+		REQUIRE( perm == expected );
+	}
+
+	SECTION("Wide Index Type"){
+		const auto perm = xstd::radix_argsort<std::uint64_t>(keys);
+		REQUIRE( perm.size() == keys.size() );
+		for(std::size_t i = 1; i < perm.size(); ++i){
+			REQUIRE( keys[perm[i-1]] <= keys[perm[i]] );
+		}
+	}
+
+	SECTION("Narrow Index Type"){
+		// 10000 keys can not be indexed by 8 bits
+		REQUIRE_THROWS_AS( xstd::radix_argsort<std::uint8_t>(keys), std::length_error );
+
+		const std::vector<TestType> few(keys.begin(), keys.begin() + 255);
+		REQUIRE( xstd::radix_argsort<std::uint8_t>(few).size() == few.size() );
+
+		// Exactly 256 keys use every 8 bit index
+		const std::vector<TestType> full(keys.begin(), keys.begin() + 256);
+		const auto perm = xstd::radix_argsort<std::uint8_t>(full);
+		REQUIRE( perm.size() == 256 );
+		std::vector<int> seen(256, 0);
+		for(std::size_t i = 0; i < perm.size(); ++i){
+			++seen[perm[i]];
+			if( i > 0 ){
+				REQUIRE( full[perm[i-1]] <= full[perm[i]] );
+			}
+		}
+		REQUIRE( std::all_of(seen.begin(), seen.end(), [](int s){ return s == 1; }) );
+
+		const std::vector<TestType> over(keys.begin(), keys.begin() + 257);
+		REQUIRE_THROWS_AS( xstd::radix_argsort<std::uint8_t>(over), std::length_error );
+	}
+
+	SECTION("Empty"){
+		std::vector<TestType> empty;
+		REQUIRE( xstd::radix_argsort(empty).empty() );
+	}
+}
+
+
+TEST_CASE("Radix Sort By Key", "[default]") {
+
+	std::mt19937_64 mte(37);
+	std::uniform_int_distribution<std::int64_t> dist(-50, 50);
+
+	const std::size_t N = 5000;
+	std::vector<std::int64_t>  time(N);
+	std::vector<double>        value(N);
+	std::vector<std::string>   label(N);
+	std::vector<std::uint32_t> id(N);
+	for(std::size_t i = 0; i < N; ++i){
+		time[i]  = dist(mte);
+		value[i] = 0.5 * static_cast<double>(i);
+		label[i] = std::to_string(i);
+		id[i]    = static_cast<std::uint32_t>(i);
+	}
+
+	SECTION("Columns Follow Keys"){
+		std::vector<std::uint32_t> expected(N);
+		std::iota(expected.begin(), expected.end(), 0);
+		std::stable_sort(expected.begin(), expected.end(), [&](auto i, auto j){return time[i] < time[j];});
+		const auto old_time = time;
+
+		xstd::radix_sort_by_key(time, value, label, id);
+		REQUIRE( std::is_sorted(time.begin(), time.end()) );
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( id[i] == expected[i] );
+			REQUIRE( time[i] == old_time[expected[i]] );
+			REQUIRE( value[i] == 0.5 * static_cast<double>(expected[i]) );
+			REQUIRE( label[i] == std::to_string(expected[i]) );
+		}
+	}
+
+	SECTION("Keys Only and Arrays"){
+		std::array<float,5> keys   = {3.0f, -1.0f, 2.0f, -1.0f, 0.0f};
+		std::array<char,5>  values = {'a', 'b', 'c', 'd', 'e'};
+		xstd::radix_sort_by_key(keys, values);
+		REQUIRE( keys   == std::array<float,5>{-1.0f, -1.0f, 0.0f, 2.0f, 3.0f} );
+		REQUIRE( values == std::array<char,5>{'b', 'd', 'e', 'c', 'a'} );
+
+		xstd::radix_sort_by_key(time);
+		REQUIRE( std::is_sorted(time.begin(), time.end()) );
+	}
+}
@@ -10,6 +10,11 @@
 
 #include "xstd/detail/array/array_math.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <tuple>
+
 
 using ValueTypes = std::tuple<std::int32_t, std::int64_t, float, double>;
 
@@ -138,3 +143,68 @@ TEMPLATE_LIST_TEST_CASE("Array Math", "[default]", ValueTypes) {
 }
 
 
+
+
+TEST_CASE("Array Math Constexpr", "[default]") {
+	using namespace xstd;
+
+	constexpr std::array<double,3> a = {1, 2, 2};
+	constexpr std::array<double,3> b = {3, -1, 4};
+
+	STATIC_REQUIRE( dot_product(a,b) == 9 );
+	STATIC_REQUIRE( norm1(b) == 8 );
+	STATIC_REQUIRE( norm2(a) == 3 );
+	STATIC_REQUIRE( norm_inf(b) == 4 );
+	STATIC_REQUIRE( cross_product(a,b) == std::array<double,3>{10, 2, -7} );
+	STATIC_REQUIRE( a + b == std::array<double,3>{4, 1, 6} );
+	STATIC_REQUIRE( 2.0 * a - b == std::array<double,3>{-1, 5, 0} );
+	STATIC_REQUIRE( 4.0 / a == std::array<double,3>{4, 2, 2} );
+	STATIC_REQUIRE( min(a,b) == std::array<double,3>{1, -1, 2} );
+	STATIC_REQUIRE( max(a,b) == std::array<double,3>{3, 2, 4} );
+	STATIC_REQUIRE( min(b) == -1 );
+	STATIC_REQUIRE( max(b) == 4 );
+	STATIC_REQUIRE( norm2(std::array<int,2>{3, 4}) == 5 );
+}
+
+
+using RegisterTypes = std::tuple<std::array<double,4>, std::array<float,8>>;
+
+TEMPLATE_LIST_TEST_CASE("Array Math Register Width", "[default]", RegisterTypes) {
+	using namespace xstd;
+
+	using array_type = TestType;
+	using value_type = typename array_type::value_type;
+	constexpr std::size_t N = std::tuple_size<array_type>::value;
+
+	array_type a;
+	array_type b;
+	for(std::size_t i = 0; i < N; ++i){
+		a[i] = value_type(i) - 2;
+		b[i] = value_type(2*i) + 1;
+	}
+
+	const auto sum  = a + b;
+	const auto diff = a - b;
+	const auto prod = a * b;
+	const auto quot = a / b;
+	const auto lo   = min(a, b);
+	const auto hi   = max(a, b);
+	for(std::size_t i = 0; i < N; ++i){
+		REQUIRE( sum[i]  == a[i] + b[i] );
+		REQUIRE( diff[i] == a[i] - b[i] );
+		REQUIRE( prod[i] == a[i] * b[i] );
+		REQUIRE( quot[i] == a[i] / b[i] );
+		REQUIRE( lo[i]   == std::min(a[i], b[i]) );
+		REQUIRE( hi[i]   == std::max(a[i], b[i]) );
+	}
+
+	auto c = a;
+	c += b;
+	REQUIRE( c == sum );
+	c -= b;
+	REQUIRE( c == a );
+	c *= value_type(2);
+	REQUIRE( c == a + a );
+	REQUIRE( min(a) == value_type(-2) );
+	REQUIRE( max(b) == value_type(2*N - 1) );
+}
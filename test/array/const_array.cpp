@@ -0,0 +1,101 @@
+/*
+ * const_array.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/array/const_array.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+
+namespace {
+
+constexpr std::uint32_t crc32_entry(std::size_t i){
+	auto c = static_cast<std::uint32_t>(i);
+	for(int k = 0; k < 8; ++k){
+		c = (c & 1u) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+	}
+	return c;
+}
+
+static constexpr auto squares = xstd::make_const_array<16>([](std::size_t i){
+	return static_cast<int>(i * i);
+});
+
+static constexpr auto crc_table = xstd::make_const_array<std::uint32_t, 256>(crc32_entry);
+
+template<std::size_t... Ints>
+struct fixed_array {
+	using cast_type = xstd::const_array<std::size_t, sizeof...(Ints)>;
+	static constexpr cast_type array_ = cast_type({Ints...});
+};
+
+} // namespace
+
+
+TEST_CASE("Const Array Generated At Compile Time", "[default]") {
+
+	STATIC_REQUIRE( std::is_same_v<decltype(squares)::value_type, int> );
+	STATIC_REQUIRE( squares.size() == 16 );
+	STATIC_REQUIRE( squares[0] == 0 );
+	STATIC_REQUIRE( squares[7] == 49 );
+	STATIC_REQUIRE( squares.back() == 225 );
+
+	STATIC_REQUIRE( crc_table[0] == 0x00000000u );
+	STATIC_REQUIRE( crc_table[1] == 0x77073096u );
+	STATIC_REQUIRE( crc_table[255] == 0x2D02EF8Du );
+
+	for(std::size_t i = 0; i < squares.size(); ++i){
+		REQUIRE( squares.at(i) == static_cast<int>(i * i) );
+	}
+}
+
+TEST_CASE("Const Array From Values", "[default]") {
+	using array_type = fixed_array<3,1,4,1,5>;
+
+	STATIC_REQUIRE( array_type::array_.size() == 5 );
+	STATIC_REQUIRE( array_type::array_.front() == 3 );
+	STATIC_REQUIRE( array_type::array_[2] == 4 );
+
+	const std::size_t expected[] = {5,1,4,1,3};
+	REQUIRE( std::equal(array_type::array_.rbegin(), array_type::array_.rend(), std::begin(expected)) );
+}
+
+TEST_CASE("Const Array Alignment", "[default]") {
+
+	STATIC_REQUIRE( alignof(decltype(squares)) == 64 );
+	REQUIRE( reinterpret_cast<std::uintptr_t>(squares.data()) % 64 == 0 );
+	REQUIRE( reinterpret_cast<std::uintptr_t>(crc_table.data()) % 64 == 0 );
+
+	constexpr auto packed = xstd::make_const_array<char, 4, 1>([](std::size_t i){ return 'a' + i; });
+	STATIC_REQUIRE( alignof(decltype(packed)) == 1 );
+	STATIC_REQUIRE( packed[3] == 'd' );
+}
+
+TEST_CASE("Const Array At Out Of Range", "[default]") {
+	REQUIRE_THROWS_AS( squares.at(16), std::out_of_range );
+	REQUIRE_NOTHROW( squares.at(15) );
+}
+
+TEST_CASE("Const Array Compare", "[default]") {
+	constexpr auto a = xstd::make_const_array<4>([](std::size_t i){ return static_cast<int>(i); });
+	constexpr auto b = xstd::make_const_array<4>([](std::size_t i){ return static_cast<int>(i); });
+	constexpr auto c = xstd::make_const_array<4>([](std::size_t i){ return static_cast<int>(i == 3 ? 9 : i); });
+
+	STATIC_REQUIRE( a == b );
+	STATIC_REQUIRE( a != c );
+	STATIC_REQUIRE( a < c );
+	STATIC_REQUIRE( a <= b );
+	STATIC_REQUIRE( c > a );
+	STATIC_REQUIRE( c >= a );
+}
@@ -0,0 +1,243 @@
+/*
+ * small_matrix.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/array/small_matrix.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <tuple>
+
+
+namespace {
+
+template<typename T, std::size_t R, std::size_t C>
+xstd::small_matrix<T,R,C> random_matrix(std::mt19937& gen){
+	std::uniform_real_distribution<T> dist(-1, 1);
+	xstd::small_matrix<T,R,C> ans{};
+	for(std::size_t i = 0; i < R; ++i){
+		for(std::size_t j = 0; j < C; ++j){
+			ans(i,j) = dist(gen);
+		}
+	}
+	return ans;
+}
+
+/// Diagonally dominant so the matrix is well conditioned
+template<typename T, std::size_t N>
+xstd::small_matrix<T,N,N> random_invertible(std::mt19937& gen){
+	auto ans = random_matrix<T,N,N>(gen);
+	for(std::size_t i = 0; i < N; ++i){
+		ans(i,i) += T(N);
+	}
+	return ans;
+}
+
+template<typename T, std::size_t R, std::size_t K, std::size_t C>
+xstd::small_matrix<T,R,C> naive_product(const xstd::small_matrix<T,R,K>& a, const xstd::small_matrix<T,K,C>& b){
+	xstd::small_matrix<T,R,C> ans{};
+	for(std::size_t i = 0; i < R; ++i){
+		for(std::size_t j = 0; j < C; ++j){
+			for(std::size_t k = 0; k < K; ++k){
+				ans(i,j) += a(i,k) * b(k,j);
+			}
+		}
+	}
+	return ans;
+}
+
+/// Determinant by cofactor expansion along the first row
+template<typename T, std::size_t N>
+T naive_determinant(const xstd::small_matrix<T,N,N>& a){
+	if constexpr ( N == 1 ) {
+		return a(0,0);
+	}
+	else {
+		T ans(0);
+		T sign(1);
+		for(std::size_t c = 0; c < N; ++c){
+			xstd::small_matrix<T,N-1,N-1> minor{};
+			for(std::size_t i = 1; i < N; ++i){
+				for(std::size_t j = 0, k = 0; j < N; ++j){
+					if( j != c ){
+						minor(i-1,k++) = a(i,j);
+					}
+				}
+			}
+			ans += sign * a(0,c) * naive_determinant(minor);
+			sign = -sign;
+		}
+		return ans;
+	}
+}
+
+template<typename T, std::size_t R, std::size_t C>
+void require_near(const xstd::small_matrix<T,R,C>& a, const xstd::small_matrix<T,R,C>& b){
+	for(std::size_t i = 0; i < R; ++i){
+		for(std::size_t j = 0; j < C; ++j){
+			REQUIRE( a(i,j) == Approx(b(i,j)).epsilon(1.0e-5).margin(1.0e-5) );
+		}
+	}
+}
+
+template<typename T, std::size_t N>
+void check_square(){
+	using matrix = xstd::small_matrix<T,N,N>;
+	std::mt19937 gen(N);
+
+	for(int trial = 0; trial < 10; ++trial){
+		const auto a = random_invertible<T,N>(gen);
+		const auto b = random_matrix<T,N,N>(gen);
+
+		require_near(a * b, naive_product(a, b));
+		REQUIRE( xstd::determinant(a) == Approx(naive_determinant(a)) );
+
+		const auto ainv = xstd::inverse(a);
+		require_near(a * ainv, matrix::identity());
+		require_near(ainv * a, matrix::identity());
+	}
+}
+
+} // namespace
+
+
+TEST_CASE("Small Matrix Construction", "[default]") {
+	using namespace xstd;
+
+	constexpr small_matrix<int,2,3> a = {1, 2, 3,
+	                                     4, 5, 6};
+	STATIC_REQUIRE( a.rows() == 2 );
+	STATIC_REQUIRE( a.cols() == 3 );
+	STATIC_REQUIRE( a(1,2) == 6 );
+	STATIC_REQUIRE( a.row(1) == std::array<int,3>{4, 5, 6} );
+	STATIC_REQUIRE( a.column(1) == std::array<int,2>{2, 5} );
+
+	constexpr auto at = transpose(a);
+	STATIC_REQUIRE( at.rows() == 3 );
+	STATIC_REQUIRE( at(2,1) == 6 );
+	STATIC_REQUIRE( transpose(at) == a );
+
+	constexpr auto I = small_matrix<int,3>::identity();
+	STATIC_REQUIRE( trace(I) == 3 );
+	STATIC_REQUIRE( a * I == a );
+	STATIC_REQUIRE( small_matrix<int,2>::filled(7)(1,0) == 7 );
+}
+
+TEST_CASE("Small Matrix Arithmetic", "[default]") {
+	using namespace xstd;
+
+	constexpr small_matrix<int,2> a = {1, 2,
+	                                   3, 4};
+	constexpr small_matrix<int,2> b = {5, 6,
+	                                   7, 8};
+
+	STATIC_REQUIRE( a + b == small_matrix<int,2>{6, 8, 10, 12} );
+	STATIC_REQUIRE( b - a == small_matrix<int,2>::filled(4) );
+	STATIC_REQUIRE( -a + a == small_matrix<int,2>{} );
+	STATIC_REQUIRE( 2 * a == a * 2 );
+	STATIC_REQUIRE( (2 * a) / 2 == a );
+	STATIC_REQUIRE( a * b == small_matrix<int,2>{19, 22, 43, 50} );
+	STATIC_REQUIRE( a * std::array<int,2>{1, 1} == std::array<int,2>{3, 7} );
+
+	auto c = a;
+	c += b;
+	c -= a;
+	REQUIRE( c == b );
+	c *= 3;
+	REQUIRE( c(1,1) == 24 );
+
+	// Rectangular product
+	constexpr small_matrix<int,2,3> d = {1, 0, 2,
+	                                     0, 1, 1};
+	constexpr small_matrix<int,3,1> e = {1, 2, 3};
+	STATIC_REQUIRE( d * e == small_matrix<int,2,1>{7, 5} );
+}
+
+TEST_CASE("Small Matrix Determinant and Inverse", "[default]") {
+	using namespace xstd;
+
+	SECTION("Constant Evaluation"){
+		constexpr small_matrix<double,2> a = {2, 1,
+		                                      1, 1};
+		STATIC_REQUIRE( determinant(a) == 1 );
+		STATIC_REQUIRE( inverse(a) * a == small_matrix<double,2>::identity() );
+
+		constexpr small_matrix<int,3> b = {2, 0, 1,
+		                                   1, 3, 2,
+		                                   1, 1, 2};
+		STATIC_REQUIRE( determinant(b) == 6 );
+	}
+
+	SECTION("Closed Form"){
+		check_square<double,1>();
+		check_square<double,2>();
+		check_square<double,3>();
+		check_square<double,4>();
+	}
+
+	SECTION("Pivoted"){
+		check_square<double,5>();
+		check_square<double,8>();
+
+		// Zero leading entry requires a row exchange
+		auto p = small_matrix<double,5>::identity();
+		std::swap(p.row(0), p.row(3));
+		REQUIRE( determinant(p) == -1 );
+		REQUIRE( inverse(p) == p );
+	}
+}
+
+TEMPLATE_TEST_CASE("Small Matrix Batch", "[default]", float, double) {
+	using namespace xstd;
+	using T = TestType;
+	constexpr std::size_t N = 3;
+	constexpr std::size_t n = 37;
+
+	std::mt19937 gen(11);
+	small_matrix_batch<T,N> a;
+	small_matrix_batch<T,N> b(n);
+	soa_array<T,N> x(n);
+	for(std::size_t i = 0; i < n; ++i){
+		a.push_back(random_invertible<T,N>(gen));
+		b.set(i, random_matrix<T,N,N>(gen));
+		x[i] = random_matrix<T,1,N>(gen).row(0);
+	}
+	REQUIRE( a.size() == n );
+	REQUIRE( b.get(5)(2,1) == b.data(2,1)[5] );
+
+	small_matrix_batch<T,N> c;
+	multiply(a, b, c);
+
+	small_matrix_batch<T,N> ainv;
+	inverse(a, ainv);
+
+	soa_array<T,N> y;
+	multiply(a, x, y);
+
+	const auto det = determinant(a);
+
+	REQUIRE( c.size() == n );
+	REQUIRE( ainv.size() == n );
+	REQUIRE( y.size() == n );
+	REQUIRE( det.size() == n );
+	for(std::size_t i = 0; i < n; ++i){
+		const auto ai = a.get(i);
+		require_near(c.get(i), ai * b.get(i));
+		require_near(ainv.get(i), inverse(ai));
+		REQUIRE( det[i] == Approx(determinant(ai)) );
+
+		const std::array<T,N> yi = y[i];
+		const auto expect = ai * static_cast<std::array<T,N>>(x[i]);
+		for(std::size_t k = 0; k < N; ++k){
+			REQUIRE( yi[k] == Approx(expect[k]) );
+		}
+	}
+}
@@ -0,0 +1,199 @@
+/*
+ * soa_array.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/array/soa_array.hpp"
+#include "xstd/detail/iterator/enumerate.hpp"
+#include "xstd/detail/iterator/zip.hpp"
+#include "xstd/detail/memory/aligned.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+
+namespace {
+
+template<typename T, std::size_t N>
+xstd::soa_array<T,N> make_soa(const std::size_t n){
+	xstd::soa_array<T,N> ans(n);
+	for(std::size_t i = 0; i < n; ++i){
+		std::array<T,N> v;
+		for(std::size_t k = 0; k < N; ++k){
+			v[k] = T(i + 1) + T(k) / 2;
+		}
+		ans[i] = v;
+	}
+	return ans;
+}
+
+} // namespace
+
+
+TEST_CASE("SoA Array Storage", "[default]") {
+	using namespace xstd;
+	using array_type = std::array<double,3>;
+
+	soa_array<double,3> a;
+	REQUIRE( a.empty() );
+
+	a.push_back(array_type{1, 2, 3});
+	a.push_back(array_type{4, 5, 6});
+	REQUIRE( a.size() == 2 );
+	REQUIRE( a[1] == array_type{4, 5, 6} );
+	REQUIRE( a[0][2] == 3 );
+
+	SECTION("Lanes Are Contiguous And Aligned"){
+		a.resize(100, array_type{7, 8, 9});
+		for(std::size_t k = 0; k < 3; ++k){
+			REQUIRE( is_aligned(a.data(k), 64) );
+			REQUIRE( a.lane(k).size() == 100 );
+		}
+		REQUIRE( a.lane(1)[0] == 2 );
+		REQUIRE( a.lane(1)[99] == 8 );
+	}
+
+	SECTION("Proxy Assignment Writes Values"){
+		auto r = a[0];
+		r = a[1];
+		REQUIRE( a[0] == array_type{4, 5, 6} );
+		a[1] = array_type{0, 0, 1};
+		REQUIRE( r == array_type{4, 5, 6} );
+		array_type v = a[1];
+		REQUIRE( v == array_type{0, 0, 1} );
+	}
+
+	SECTION("Bounds Checked Access"){
+		REQUIRE_THROWS_AS( a.at(2), std::out_of_range );
+		REQUIRE( a.at(1) == array_type{4, 5, 6} );
+	}
+
+	SECTION("Initializer List"){
+		const soa_array<int,2> b = {{1, 2}, {3, 4}, {5, 6}};
+		REQUIRE( b.size() == 3 );
+		REQUIRE( b[2] == std::array<int,2>{5, 6} );
+	}
+}
+
+
+TEST_CASE("SoA Array Proxy Math", "[default]") {
+	using namespace xstd;
+	using array_type = std::array<double,3>;
+
+	soa_array<double,3> a = {{1, 2, 2}, {3, -1, 4}};
+	const array_type x = {1, 2, 2};
+	const array_type y = {3, -1, 4};
+
+	REQUIRE( a[0] + a[1] == x + y );
+	REQUIRE( a[0] - y == x - y );
+	REQUIRE( x * a[1] == x * y );
+	REQUIRE( 2.0 * a[0] == 2.0 * x );
+	REQUIRE( a[1] / 2.0 == y / 2.0 );
+	REQUIRE( -a[0] == -x );
+	REQUIRE( dot_product(a[0], a[1]) == dot_product(x, y) );
+	REQUIRE( cross_product(a[0], y) == cross_product(x, y) );
+	REQUIRE( norm2(a[0]) == 3 );
+	REQUIRE( norm1(a[1]) == 8 );
+	REQUIRE( norm_inf(a[1]) == 4 );
+	REQUIRE( min(a[0], a[1]) == min(x, y) );
+	REQUIRE( max(a[1]) == 4 );
+
+	a[0] += a[1];
+	REQUIRE( a[0] == x + y );
+	a[0] -= y;
+	REQUIRE( a[0] == x );
+	a[0] *= 2.0;
+	REQUIRE( a[0] == 2.0 * x );
+}
+
+
+TEST_CASE("SoA Array Iteration", "[default]") {
+	using namespace xstd;
+	using array_type = std::array<float,4>;
+
+	auto a = make_soa<float,4>(25);
+
+	SECTION("Algorithms"){
+		REQUIRE( std::distance(a.begin(), a.end()) == 25 );
+		std::reverse(a.begin(), a.end());
+		REQUIRE( a[0][0] == 25 );
+		REQUIRE( a[24][0] == 1 );
+
+		std::sort(a.begin(), a.end(), [](const array_type& l, const array_type& r){
+			return l[0] < r[0];
+		});
+		for(std::size_t i = 0; i < a.size(); ++i){
+			REQUIRE( a[i][0] == float(i + 1) );
+		}
+
+		const auto& c = a;
+		const auto sum = std::accumulate(c.begin(), c.end(), 0.0f, [](float s, const array_type& v){
+			return s + v[1];
+		});
+		REQUIRE( sum == Approx(25 * 26 / 2 + 25 * 0.5) );
+	}
+
+	SECTION("Zip"){
+		std::vector<float> scale(a.size(), 2.0f);
+		for(auto [v, s] : zip(a, scale)){
+			v *= s;
+		}
+		REQUIRE( a[3][0] == 8 );
+	}
+
+	SECTION("Enumerate"){
+		for(auto [i, v] : enumerate(a)){
+			v = array_type{float(i), 0, 0, 0};
+		}
+		REQUIRE( a[7] == array_type{7, 0, 0, 0} );
+	}
+}
+
+
+TEST_CASE("SoA Array Bulk Operations", "[default]") {
+	using namespace xstd;
+	using array_type = std::array<double,3>;
+
+	const std::size_t N = 101;
+	auto a = make_soa<double,3>(N);
+	auto b = make_soa<double,3>(N);
+	b *= 0.5;
+
+	SECTION("Compound"){
+		auto c = a;
+		c += b;
+		c -= array_type{1, 2, 3};
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( c[i] == a[i] + b[i] - array_type{1, 2, 3} );
+		}
+		c = a;
+		c.axpy(2.0, b);
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( c[i] == 2.0 * b[i] + a[i] );
+		}
+		c += c;
+		REQUIRE( c[3] == 2.0 * (2.0 * b[3] + a[3]) );
+	}
+
+	SECTION("Reductions"){
+		const auto d = dot_product(a, b);
+		const auto n = norm2(a);
+		const auto x = cross_product(a, b);
+		REQUIRE( d.size() == N );
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( d[i] == Approx(dot_product(a[i], b[i])) );
+			REQUIRE( n[i] == Approx(norm2(a[i])) );
+			REQUIRE( x[i] == cross_product(a[i], b[i]) );
+		}
+	}
+}
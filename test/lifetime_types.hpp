@@ -0,0 +1,59 @@
+/*
+ * lifetime_types.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+#ifndef TEST_LIFETIME_TYPES_HPP_
+#define TEST_LIFETIME_TYPES_HPP_
+
+
+#include "xstd/detail/type_traits/relocatable.hpp"
+
+#include <memory>
+#include <type_traits>
+
+
+/// Counts every construction and destruction
+struct Counted {
+	static inline int constructed = 0;
+	static inline int destroyed   = 0;
+
+	static int alive() {
+		return constructed - destroyed;
+	}
+
+	static void reset() {
+		constructed = 0;
+		destroyed   = 0;
+	}
+
+	Counted(int v = 0) : value(v) { ++constructed; }
+	Counted(const Counted& other) : value(other.value) { ++constructed; }
+	Counted(Counted&& other) noexcept : value(other.value) { ++constructed; }
+	Counted& operator=(const Counted&) = default;
+	Counted& operator=(Counted&&) noexcept = default;
+	~Counted() { ++destroyed; }
+
+	bool operator==(const Counted& other) const = default;
+
+	int value;
+};
+
+/// Move only type opted into trivial relocation
+struct Handle {
+	Handle(int v) : value(std::make_unique<int>(v)) {}
+
+	int operator*() const {
+		return *value;
+	}
+
+	std::unique_ptr<int> value;
+};
+
+template<>
+struct xstd::is_trivially_relocatable<Handle> : std::true_type {};
+
+
+#endif /* TEST_LIFETIME_TYPES_HPP_ */
@@ -0,0 +1,80 @@
+/*
+ * cardinality.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/set/cardinality.hpp"
+
+#include <cstdint>
+#include <string>
+
+
+TEST_CASE("HyperLogLog", "[default]") {
+
+	SECTION("Small Sets are Exact"){
+		xstd::hyperloglog<> hll;
+		REQUIRE( hll.estimate() == 0.0 );
+		for(int rep = 0; rep < 3; ++rep){
+			for(std::uint64_t i = 0; i < 100; ++i){
+				hll.insert(i);
+			}
+		}
+		REQUIRE( hll.estimate() == Approx(100).epsilon(0.02) );
+	}
+
+	SECTION("Large Sets within Error"){
+		xstd::hyperloglog<12> hll;
+		for(std::uint64_t i = 0; i < 1000000; ++i){
+			hll.insert(i);
+		}
+		// Standard error 1.6% so allow 5 sigma
+		REQUIRE( hll.estimate() == Approx(1000000).epsilon(0.08) );
+	}
+
+	SECTION("Merge and Intersection"){
+		xstd::hyperloglog<> a, b;
+		for(std::uint64_t i = 0; i < 200000; ++i){
+			a.insert(i);
+			b.insert(i + 100000);
+		}
+		REQUIRE( xstd::intersection_estimate(a, b) == Approx(100000).epsilon(0.1) );
+		a.merge(b);
+		REQUIRE( a.estimate() == Approx(300000).epsilon(0.05) );
+	}
+
+	SECTION("Strings"){
+		xstd::hyperloglog<> hll;
+		for(int i = 0; i < 5000; ++i){
+			hll.insert("key-" + std::to_string(i));
+		}
+		REQUIRE( hll.estimate() == Approx(5000).epsilon(0.05) );
+	}
+}
+
+
+TEST_CASE("MinHash", "[default]") {
+
+	xstd::minhash<256> a, b;
+	for(std::uint64_t i = 0; i < 30000; ++i){
+		a.insert(i);
+	}
+	for(std::uint64_t i = 10000; i < 40000; ++i){
+		b.insert(i);
+	}
+
+	// |A ∩ B| / |A ∪ B| = 20000 / 40000
+	REQUIRE( a.jaccard(b) == Approx(0.5).margin(0.15) );
+	REQUIRE( a.jaccard(a) == 1.0 );
+
+	auto c = a;
+	c.merge(b);
+	REQUIRE( c.jaccard(a) == Approx(0.75).margin(0.15) );
+
+	c.clear();
+	REQUIRE( c.jaccard(a) == 0.0 );
+}
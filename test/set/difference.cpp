@@ -0,0 +1,67 @@
+/*
+ * difference.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/set/difference.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <random>
+#include <set>
+#include <vector>
+
+
+TEST_CASE("Set Difference", "[default]") {
+
+	SECTION("Mixed Containers"){
+		std::vector<double> vec = {1, 3, 5, 7, 9, 11};
+		std::list<double>   lst = {0, 2, 3, 5, 8};
+		std::set<double>     st = {0, 2, 9, 10};
+
+		std::vector<double> ans;
+		xstd::Difference(ans,vec,lst,st);
+		REQUIRE( ans == std::vector<double>{1, 7, 11} );
+	}
+
+	SECTION("No Exclusions"){
+		std::vector<int> a = {1, 2, 2, 3};
+		std::vector<int> ans;
+		xstd::Difference<false>(ans,a);
+		REQUIRE( ans == a );
+
+		ans.clear();
+		xstd::Difference(ans,a);
+		REQUIRE( ans == std::vector<int>{1, 2, 3} );
+	}
+
+	SECTION("Random Exclusion Lists"){
+		std::mt19937 mte(9);
+		std::uniform_int_distribution<int> dist(0, 5000);
+
+		auto make = [&](std::size_t n){
+			std::set<int> values;
+			while( values.size() < n ){
+				values.insert(dist(mte));
+			}
+			return std::vector<int>(values.begin(), values.end());
+		};
+		const auto a = make(3000);
+		const auto b = make(20);
+		const auto c = make(1500);
+
+		std::vector<int> ab, expect;
+		std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(ab));
+		std::set_difference(ab.begin(), ab.end(), c.begin(), c.end(), std::back_inserter(expect));
+
+		std::vector<int> ans;
+		xstd::Difference(ans,a,b,c);
+		REQUIRE( ans == expect );
+	}
+}
@@ -0,0 +1,200 @@
+/*
+ * flat_map.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/set/flat_map.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace {
+
+/// Allocator which counts the allocations made
+template<typename T>
+struct counting_allocator : std::allocator<T> {
+	using value_type = T;
+
+	static inline int allocations = 0;
+
+	counting_allocator() = default;
+
+	template<typename U>
+	counting_allocator(const counting_allocator<U>&) noexcept {}
+
+	T* allocate(std::size_t n) {
+		++allocations;
+		return std::allocator<T>::allocate(n);
+	}
+
+	template<typename U>
+	struct rebind { using other = counting_allocator<U>; };
+};
+
+template<typename FlatMap, typename Map>
+void require_equal(const FlatMap& a, const Map& b){
+	REQUIRE( a.size() == b.size() );
+	REQUIRE( std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const auto& x, const auto& y){
+		return (x.first == y.first) && (x.second == y.second);
+	}) );
+}
+
+} // namespace
+
+
+TEMPLATE_TEST_CASE("Flat Map Matches std::map", "[default]",
+                   (xstd::flat_map<int,int>),
+                   (xstd::flat_map<int,int,std::greater<int>>),
+                   (xstd::flat_map<int,int,std::less<int>,std::vector<std::pair<int,int>>,xstd::branchless_search_policy>),
+                   (xstd::bounded_flat_map<int,int,64>),
+                   (xstd::bounded_flat_map<int,int,64,std::less<int>,xstd::branchless_search_policy>)) {
+	using FlatMap = TestType;
+	using Map = std::map<int,int,typename FlatMap::key_compare>;
+
+	FlatMap a;
+	Map b;
+	std::mt19937 gen(7);
+	std::uniform_int_distribution<int> key(0, 60);
+	for(int trial = 0; trial < 2000; ++trial){
+		const auto k = key(gen);
+		switch( trial % 5 ){
+		case 0:
+			REQUIRE( a.insert({k, trial}).second == b.insert({k, trial}).second );
+			break;
+		case 1:
+			a[k] = trial;
+			b[k] = trial;
+			break;
+		case 2:
+			REQUIRE( a.erase(k) == b.erase(k) );
+			break;
+		case 3:
+			REQUIRE( a.try_emplace(k, trial).second == b.try_emplace(k, trial).second );
+			break;
+		case 4:
+			REQUIRE( a.insert_or_assign(k, trial).second == b.insert_or_assign(k, trial).second );
+			break;
+		}
+		REQUIRE( a.contains(k) == (b.count(k) == 1) );
+		REQUIRE( (a.lower_bound(k) - a.begin()) == std::distance(b.begin(), b.lower_bound(k)) );
+		REQUIRE( (a.upper_bound(k) - a.begin()) == std::distance(b.begin(), b.upper_bound(k)) );
+	}
+	require_equal(a, b);
+}
+
+TEST_CASE("Flat Map Construction", "[default]") {
+	using namespace xstd;
+
+	flat_map<std::string,int> a = {{"b", 2}, {"a", 1}, {"c", 3}, {"a", 9}};
+	REQUIRE( a.size() == 3 );
+	REQUIRE( a.begin()->first == "a" );
+	REQUIRE( a.at("a") == 1 );
+	REQUIRE_THROWS( a.at("z") );
+
+	// Range insert keeps existing keys
+	const std::vector<std::pair<std::string,int>> more = {{"d", 4}, {"b", 7}, {"e", 5}};
+	a.insert(more.begin(), more.end());
+	REQUIRE( a.size() == 5 );
+	REQUIRE( a["b"] == 2 );
+	REQUIRE( a["e"] == 5 );
+
+	auto c = std::move(a).extract();
+	REQUIRE( c.size() == 5 );
+	flat_map<std::string,int> d(sorted_unique, std::move(c));
+	REQUIRE( d.find("d")->second == 4 );
+
+	flat_map<std::string,int> e(std::vector<std::pair<std::string,int>>{{"x", 1}, {"w", 2}, {"x", 3}});
+	REQUIRE( e.size() == 2 );
+	REQUIRE( e.at("x") == 1 );
+	REQUIRE( d < e );
+
+	REQUIRE( erase_if(d, [](const auto& kv){ return kv.second > 3; }) == 2 );
+	REQUIRE( d.size() == 3 );
+}
+
+TEST_CASE("Flat Map Bounded Storage", "[default]") {
+	using namespace xstd;
+
+	bounded_flat_map<std::string,std::string,8,std::less<>> a;
+	a["verbose"] = "1";
+	a["input"]   = "file.txt";
+	a.emplace("output", "out.txt");
+	REQUIRE( a.size() == 3 );
+	REQUIRE( a.begin()->first == "input" );
+
+	// Transparent lookup without creating a std::string
+	REQUIRE( a.contains("verbose") );
+	REQUIRE( a.find("output")->second == "out.txt" );
+	REQUIRE( a.count("missing") == 0 );
+
+	auto b = a;
+	REQUIRE( b == a );
+	b.erase(b.find("input"));
+	swap(a, b);
+	REQUIRE( a.size() == 2 );
+	REQUIRE( b.size() == 3 );
+}
+
+TEST_CASE("Flat Map Bounded Range Insert", "[default]") {
+	using namespace xstd;
+
+	const std::vector<std::pair<int,int>> values = {{5, 0}, {1, 1}, {9, 2}, {5, 3}, {3, 4}, {1, 5}, {7, 6}};
+
+	// Constructed from an unsorted container with duplicates
+	bounded_vector<std::pair<int,int>,8> storage(values.begin(), values.end());
+	bounded_flat_map<int,int,8> a(std::move(storage));
+	STATIC_REQUIRE( std::is_same_v<decltype(a)::container_type, bounded_vector<std::pair<int,int>,8>> );
+	REQUIRE( a.size() == 5 );
+
+	// Range insert more values than free slots counting duplicates
+	a.insert(values.begin(), values.end());
+	a.insert({{2, 7}, {8, 8}, {3, 9}});
+
+	std::map<int,int> b(values.begin(), values.end());
+	b.insert({{2, 7}, {8, 8}, {3, 9}});
+	require_equal(a, b);
+}
+
+TEST_CASE("Flat Map Heap Range Insert", "[default]") {
+	using namespace xstd;
+
+	using value_type = std::pair<int,int>;
+	using alloc_type = counting_allocator<value_type>;
+	using FlatMap    = flat_map<int,int,std::less<int>,std::vector<value_type,alloc_type>>;
+
+	const std::vector<value_type> values = {{5, 0}, {1, 1}, {9, 2}, {5, 3}, {3, 4}, {1, 5}, {7, 6}};
+
+	// Range insert within reserved storage never reallocates it
+	std::vector<value_type,alloc_type> storage;
+	storage.reserve(16);
+	FlatMap a(std::move(storage));
+	const auto before_insert = alloc_type::allocations;
+	a.insert(values.begin(), values.end());
+	a.insert({{2, 7}, {8, 8}, {3, 9}});
+	REQUIRE( alloc_type::allocations == before_insert );
+
+	std::map<int,int> b(values.begin(), values.end());
+	b.insert({{2, 7}, {8, 8}, {3, 9}});
+	require_equal(a, b);
+
+	// Growth past the reserve allocates geometrically
+	const auto before_grow = alloc_type::allocations;
+	for(int i = 0; i < 1000; ++i){
+		a.insert({100 + i, i});
+	}
+	REQUIRE( alloc_type::allocations - before_grow <= 10 );
+	REQUIRE( a.size() == 1007 );
+}
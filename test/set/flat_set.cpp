@@ -0,0 +1,77 @@
+/*
+ * flat_set.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/set/flat_set.hpp"
+
+#include <functional>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+
+TEMPLATE_TEST_CASE("Flat Set Matches std::set", "[default]",
+                   (xstd::flat_set<int>),
+                   (xstd::flat_set<int,std::greater<int>>),
+                   (xstd::flat_set<int,std::less<int>,std::vector<int>,xstd::branchless_search_policy>),
+                   (xstd::bounded_flat_set<int,64>),
+                   (xstd::bounded_flat_set<int,64,std::less<int>,xstd::branchless_search_policy>)) {
+	using FlatSet = TestType;
+	using Set = std::set<int,typename FlatSet::key_compare>;
+
+	FlatSet a;
+	Set b;
+	std::mt19937 gen(5);
+	std::uniform_int_distribution<int> key(0, 60);
+	for(int trial = 0; trial < 2000; ++trial){
+		const auto k = key(gen);
+		if( trial % 3 == 2 ){
+			REQUIRE( a.erase(k) == b.erase(k) );
+		}
+		else {
+			REQUIRE( a.insert(k).second == b.insert(k).second );
+		}
+		REQUIRE( a.contains(k) == (b.count(k) == 1) );
+		REQUIRE( (a.lower_bound(k) - a.begin()) == std::distance(b.begin(), b.lower_bound(k)) );
+		REQUIRE( (a.upper_bound(k) - a.begin()) == std::distance(b.begin(), b.upper_bound(k)) );
+	}
+	REQUIRE( std::equal(a.begin(), a.end(), b.begin(), b.end()) );
+}
+
+TEST_CASE("Flat Set Construction", "[default]") {
+	using namespace xstd;
+
+	flat_set<int> a = {5, 1, 3, 1, 5};
+	REQUIRE( std::vector<int>(a.begin(), a.end()) == std::vector<int>{1, 3, 5} );
+
+	const std::vector<int> more = {4, 3, 2};
+	a.insert(more.begin(), more.end());
+	REQUIRE( a.container() == std::vector<int>{1, 2, 3, 4, 5} );
+
+	auto [lo, hi] = a.equal_range(3);
+	REQUIRE( *lo == 3 );
+	REQUIRE( hi - lo == 1 );
+
+	a.erase(a.begin(), a.begin() + 2);
+	REQUIRE( *a.begin() == 3 );
+
+	flat_set<int> b(sorted_unique, std::vector<int>{7, 8});
+	swap(a, b);
+	REQUIRE( a.size() == 2 );
+	REQUIRE( b < a );
+
+	bounded_flat_set<std::string,4,std::less<>> names = {"mango", "apple", "kiwi"};
+	REQUIRE( names.contains("kiwi") );
+	REQUIRE( *names.find("apple") == "apple" );
+	REQUIRE( names.size() == 3 );
+	auto c = std::move(names).extract();
+	REQUIRE( c.size() == 3 );
+	REQUIRE( c[2] == "mango" );
+}
@@ -11,11 +11,41 @@
 
 #include "xstd/detail/set/intersection.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <limits>
 #include <list>
+#include <random>
 #include <set>
+#include <span>
 #include <vector>
 
 
+namespace {
+
+template<typename T>
+std::vector<T> random_set(std::mt19937_64& mte, const std::size_t n, const std::uint64_t max_value){
+	std::uniform_int_distribution<std::uint64_t> dist(0, max_value);
+	std::set<T> values;
+	while( values.size() < n ){
+		values.insert(static_cast<T>(dist(mte)));
+	}
+	return std::vector<T>(values.begin(), values.end());
+}
+
+template<typename T>
+std::vector<T> std_intersection(const std::vector<T>& a, const std::vector<T>& b){
+	std::vector<T> ans;
+	std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(ans));
+	return ans;
+}
+
+} // namespace
+
+
 TEST_CASE("Set Intersection", "[default]") {
 
 	SECTION("Mixed Containers"){
@@ -31,5 +61,176 @@ TEST_CASE("Set Intersection", "[default]") {
 		REQUIRE( ans[1] == 5 );
 	}
 
+	SECTION("Exhausted Containers"){
+		std::vector<int> empty;
+		std::vector<int> vec = {1, 2, 3};
+		std::list<int>   lst = {3};
+
+		std::vector<int> ans;
+		xstd::Intersection(ans,vec,empty);
+		REQUIRE( ans.empty() );
+		xstd::Intersection(ans,vec,lst);
+		REQUIRE( ans == std::vector<int>{3} );
+		ans.clear();
+		xstd::Intersection(ans,vec);
+		REQUIRE( ans == vec );
+	}
+
+}
+
+
+using IntegerTypes = std::tuple<std::int32_t, std::uint32_t, std::int64_t>;
+
+TEMPLATE_LIST_TEST_CASE("Set Intersection Sorted Integers", "[default]", IntegerTypes) {
+
+	std::mt19937_64 mte(17);
+
+	SECTION("Similar Lengths"){
+		for(std::size_t n : {1, 3, 4, 7, 8, 9, 31, 1000, 5000}){
+			const auto a = random_set<TestType>(mte, n, 4 * n);
+			const auto b = random_set<TestType>(mte, n + n/3, 4 * n);
+
+			std::vector<TestType> ans;
+			xstd::Intersection(ans, a, b);
+			REQUIRE( ans == std_intersection(a, b) );
+
+			ans.clear();
+			xstd::Intersection(ans, b, a);
+			REQUIRE( ans == std_intersection(a, b) );
+		}
+	}
+
+	SECTION("Skewed Lengths"){
+		const auto a = random_set<TestType>(mte, 100, 1000000);
+		const auto b = random_set<TestType>(mte, 200000, 1000000);
+
+		std::vector<TestType> ans;
+		xstd::Intersection(ans, a, b);
+		REQUIRE( ans == std_intersection(a, b) );
+
+		ans.clear();
+		xstd::Intersection(ans, b, a);
+		REQUIRE( ans == std_intersection(a, b) );
+	}
+
+	SECTION("Many Containers"){
+		const auto a = random_set<TestType>(mte, 3000, 6000);
+		const auto b = random_set<TestType>(mte, 4000, 6000);
+		const auto c = random_set<TestType>(mte, 50, 6000);
+		const std::list<TestType> d(b.begin(), b.end());
+
+		std::vector<TestType> ans;
+		xstd::Intersection(ans, a, b, c, d);
+		REQUIRE( ans == std_intersection(std_intersection(a, b), c) );
+	}
+
+	SECTION("Extreme Values"){
+		std::vector<TestType> a = {std::numeric_limits<TestType>::min(), 3, 5, 9, 12, 40, 41, 42, std::numeric_limits<TestType>::max()};
+		std::vector<TestType> b = {std::numeric_limits<TestType>::min(), 1, 5, 10, 12, 13, 41, 42, std::numeric_limits<TestType>::max()};
+
+		std::vector<TestType> ans;
+		xstd::Intersection(ans, a, b);
+		REQUIRE( ans == std_intersection(a, b) );
+	}
+}
+
+
+TEST_CASE("Set Intersection Repeated Values", "[default]") {
+
+	SECTION("Short Runs"){
+		const std::vector<std::uint32_t> a = {1, 1, 2, 3, 3, 3, 5, 8, 8, 9};
+		const std::vector<std::uint32_t> b = {1, 1, 1, 3, 3, 4, 5, 8, 9, 9};
+
+		std::vector<std::uint32_t> ans;
+		xstd::Intersection(ans, a, b);
+		REQUIRE( ans == std::vector<std::uint32_t>{1, 1, 3, 3, 5, 8, 9} );
+	}
+
+	SECTION("SIMD Agrees With Gallop"){
+		std::mt19937_64 mte(23);
+		std::uniform_int_distribution<std::uint32_t> value_dist(0, 400);
+		std::uniform_int_distribution<std::size_t>   run_dist(1, 12);
+		auto runs = [&](const std::size_t n){
+			std::vector<std::uint32_t> v;
+			while( v.size() < n ){
+				v.insert(v.end(), run_dist(mte), value_dist(mte));
+			}
+			std::sort(v.begin(), v.end());
+			return v;
+		};
+
+		for(std::size_t n : {5, 16, 33, 500, 4000}){
+			const auto a = runs(n);
+			const auto b = runs(n + n/2);
+			const std::deque<std::uint32_t> b_deque(b.begin(), b.end());
+
+			std::vector<std::uint32_t> simd_ans;
+			xstd::Intersection(simd_ans, a, b);
+			std::vector<std::uint32_t> gallop_ans;
+			xstd::Intersection(gallop_ans, a, b_deque);
+			REQUIRE( simd_ans == gallop_ans );
+			REQUIRE( simd_ans == std_intersection(a, b) );
+
+			simd_ans.clear();
+			xstd::Intersection(simd_ans, b, a);
+			REQUIRE( simd_ans == gallop_ans );
+		}
+	}
 }
 
+
+TEST_CASE("Set Intersection Runtime Lists", "[default]") {
+
+	std::mt19937_64 mte(23);
+
+	SECTION("Vector of Vectors"){
+		for(std::size_t k : {1, 2, 3, 8, 65, 70}){
+			std::vector<std::vector<std::uint32_t>> lists;
+			for(std::size_t i = 0; i < k; ++i){
+				lists.push_back(random_set<std::uint32_t>(mte, 500 + 1000 * (i % 4), 8000));
+			}
+			lists[k/2].push_back(9000); // Different lengths and end values
+
+			std::vector<std::uint32_t> expect = lists[0];
+			for(std::size_t i = 1; i < k; ++i){
+				expect = std_intersection(expect, lists[i]);
+			}
+
+			std::vector<std::uint32_t> buffer(3000);
+			const auto n = xstd::Intersection(lists, buffer.begin());
+			REQUIRE( n == expect.size() );
+			REQUIRE( std::equal(expect.begin(), expect.end(), buffer.begin()) );
+		}
+	}
+
+	SECTION("Span of Views"){
+		const auto a = random_set<std::int32_t>(mte, 20, 1000);
+		const auto b = random_set<std::int32_t>(mte, 900, 1000);
+		const auto c = random_set<std::int32_t>(mte, 600, 1000);
+		const std::vector<std::span<const std::int32_t>> lists = {b, c, a};
+		const auto expect = std_intersection(std_intersection(a, b), c);
+
+		std::array<std::int32_t, 20> buffer;
+		const auto n = xstd::Intersection(std::span(lists), buffer.begin(), buffer.size());
+		REQUIRE( n == expect.size() );
+		REQUIRE( std::equal(expect.begin(), expect.end(), buffer.begin()) );
+	}
+
+	SECTION("Count Limit"){
+		std::vector<std::vector<int>> lists = {{1, 2, 3, 4, 5, 6}, {0, 2, 3, 4, 6}, {2, 3, 4, 6, 7}};
+		std::vector<int> buffer;
+		const auto n = xstd::Intersection(lists, std::back_inserter(buffer), 2);
+		REQUIRE( n == 2 );
+		REQUIRE( buffer == std::vector<int>{2, 3} );
+	}
+
+	SECTION("Empty Lists"){
+		std::vector<std::vector<int>> lists;
+		std::vector<int> buffer;
+		REQUIRE( xstd::Intersection(lists, std::back_inserter(buffer)) == 0 );
+
+		lists = {{1, 2, 3}, {}};
+		REQUIRE( xstd::Intersection(lists, std::back_inserter(buffer)) == 0 );
+		REQUIRE( buffer.empty() );
+	}
+}
@@ -0,0 +1,98 @@
+/*
+ * intersection_count.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/set/intersection_count.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <random>
+#include <set>
+#include <vector>
+
+
+namespace {
+
+template<typename T>
+std::vector<T> random_set(std::mt19937_64& mte, const std::size_t n, const std::int64_t lo, const std::int64_t hi){
+	std::uniform_int_distribution<std::int64_t> dist(lo, hi);
+	std::set<T> values;
+	while( values.size() < n ){
+		values.insert(static_cast<T>(dist(mte)));
+	}
+	return std::vector<T>(values.begin(), values.end());
+}
+
+template<typename T>
+std::size_t std_count(const std::vector<T>& a, const std::vector<T>& b){
+	std::vector<T> ans;
+	std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(ans));
+	return ans.size();
+}
+
+} // namespace
+
+
+using IntegerTypes = std::tuple<std::int16_t, std::int32_t, std::uint32_t, std::int64_t>;
+
+TEMPLATE_LIST_TEST_CASE("Intersection Count", "[default]", IntegerTypes) {
+
+	std::mt19937_64 mte(31);
+	const std::int64_t lo = std::is_signed<TestType>::value ? -5000 : 0;
+
+	SECTION("Dense Sets Use Bitmaps"){
+		const auto a = random_set<TestType>(mte, 4000, lo, lo + 10000);
+		const auto b = random_set<TestType>(mte, 6000, lo + 100, lo + 10000);
+		const auto c = random_set<TestType>(mte, 3000, lo, lo + 9000);
+		REQUIRE( xstd::intersection_count(a, b) == std_count(a, b) );
+
+		std::vector<TestType> ab;
+		std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(ab));
+		REQUIRE( xstd::intersection_count(a, b, c) == std_count(ab, c) );
+	}
+
+	SECTION("Sparse Sets Use Merge"){
+		const auto a = random_set<TestType>(mte, 500, lo, lo + 30000);
+		const auto b = random_set<TestType>(mte, 50, lo, lo + 30000);
+		REQUIRE( xstd::intersection_count(a, b) == std_count(a, b) );
+	}
+
+	SECTION("Disjoint and Empty"){
+		const std::vector<TestType> a = {1, 2, 3};
+		const std::vector<TestType> b = {4, 5, 6};
+		const std::vector<TestType> c;
+		REQUIRE( xstd::intersection_count(a, b) == 0 );
+		REQUIRE( xstd::intersection_count(a, c) == 0 );
+		REQUIRE( xstd::intersection_count(a, a) == 3 );
+	}
+}
+
+
+TEST_CASE("Intersection Count Mixed", "[default]") {
+
+	std::vector<double> vec = {1, 3, 5, 7, 9, 11};
+	std::list<double>   lst = {0, 2, 3, 5, 8, 11};
+	std::set<double>     st = {0, 2, 3, 5, 9, 10};
+	REQUIRE( xstd::intersection_count(vec, lst, st) == 2 );
+	REQUIRE( xstd::intersection_count(vec) == 6 );
+}
+
+
+TEST_CASE("Jaccard Index", "[default]") {
+
+	const std::vector<int> a = {1, 2, 3, 4};
+	const std::vector<int> b = {3, 4, 5, 6, 7, 8};
+	const std::vector<int> e;
+	REQUIRE( xstd::jaccard_index(a, b) == Approx(2.0 / 8.0) );
+	REQUIRE( xstd::jaccard_index(a, a) == 1.0 );
+	REQUIRE( xstd::jaccard_index(a, e) == 0.0 );
+	REQUIRE( xstd::jaccard_index(e, e) == 1.0 );
+}
@@ -0,0 +1,96 @@
+/*
+ * loser_tree.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/set/loser_tree.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+
+template<std::size_t N>
+std::vector<int> merge_all(const std::vector<std::vector<int>>& runs){
+	xstd::loser_tree<int, N> tree;
+	std::vector<std::size_t> pos(N, 0);
+	for(std::size_t s = 0; s < N; ++s){
+		if( runs[s].empty() ){
+			tree.close(s);
+		}
+		else {
+			tree.set(s, runs[s][0]);
+		}
+	}
+	tree.build();
+
+	std::vector<int> out;
+	while( not tree.empty() ){
+		const auto s = tree.top_source();
+		out.push_back(tree.top());
+		if( ++pos[s] < runs[s].size() ){
+			tree.replace_top(runs[s][pos[s]]);
+		}
+		else {
+			tree.pop_top();
+		}
+	}
+	return out;
+}
+
+template<std::size_t N>
+void check_merge(std::mt19937& mte){
+	std::uniform_int_distribution<int> len(0, 50);
+	std::uniform_int_distribution<int> val(-100, 100);
+
+	std::vector<std::vector<int>> runs(N);
+	std::vector<int> expect;
+	for(auto& run : runs){
+		run.resize(len(mte));
+		std::generate(run.begin(), run.end(), [&](){return val(mte);});
+		std::sort(run.begin(), run.end());
+		expect.insert(expect.end(), run.begin(), run.end());
+	}
+	std::sort(expect.begin(), expect.end());
+	REQUIRE( merge_all<N>(runs) == expect );
+}
+
+
+TEST_CASE("Loser Tree", "[default]") {
+
+	std::mt19937 mte(3);
+
+	SECTION("Merge Runs"){
+		for(int i = 0; i < 10; ++i){
+			check_merge<1>(mte);
+			check_merge<2>(mte);
+			check_merge<3>(mte);
+			check_merge<5>(mte);
+			check_merge<8>(mte);
+			check_merge<13>(mte);
+		}
+	}
+
+	SECTION("Ties Won by Lowest Source"){
+		xstd::loser_tree<int, 4> tree;
+		tree.set(0, 7);
+		tree.set(1, 3);
+		tree.set(2, 3);
+		tree.close(3);
+		tree.build();
+		REQUIRE( tree.top_source() == 1 );
+		tree.replace_top(9);
+		REQUIRE( tree.top_source() == 2 );
+		tree.pop_top();
+		REQUIRE( tree.top_source() == 0 );
+		tree.pop_top();
+		REQUIRE( tree.top_source() == 1 );
+		tree.pop_top();
+		REQUIRE( tree.empty() );
+	}
+}
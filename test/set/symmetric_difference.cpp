@@ -0,0 +1,75 @@
+/*
+ * symmetric_difference.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/set/symmetric_difference.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <random>
+#include <set>
+#include <vector>
+
+
+TEST_CASE("Set Symmetric Difference", "[default]") {
+
+	SECTION("Mixed Containers"){
+		std::vector<double> vec = {1, 3, 5, 7, 9, 11};
+		std::list<double>   lst = {0, 2, 3, 5, 8, 11};
+		std::set<double>     st = {0, 2, 3, 5, 9, 10};
+
+		// Odd number of containers hold the value
+		std::vector<double> ans;
+		xstd::SymmetricDifference(ans,vec,lst,st);
+		REQUIRE( ans == std::vector<double>{1, 3, 5, 7, 8, 10} );
+	}
+
+	SECTION("Duplicates Within Container"){
+		std::vector<int> a = {1, 1, 2, 4, 4, 4};
+		std::list<int>   b = {2, 2, 3, 4};
+		std::vector<int> c = {};
+
+		// Each container counts once per value
+		std::vector<int> ans;
+		xstd::SymmetricDifference(ans,a,b,c);
+		REQUIRE( ans == std::vector<int>{1, 3} );
+
+		// Single container with repeats keeps the value
+		ans.clear();
+		xstd::SymmetricDifference(ans,std::vector<int>{1, 1},c);
+		REQUIRE( ans == std::vector<int>{1} );
+
+		// Counting copies drops values repeated an even number of times
+		ans.clear();
+		xstd::SymmetricDifference<false>(ans,a,b,c);
+		REQUIRE( ans == std::vector<int>{2, 3} );
+	}
+
+	SECTION("Matches Two Container Standard"){
+		std::mt19937 mte(21);
+		std::uniform_int_distribution<int> dist(0, 3000);
+		auto make = [&](std::size_t n){
+			std::set<int> values;
+			while( values.size() < n ){
+				values.insert(dist(mte));
+			}
+			return std::vector<int>(values.begin(), values.end());
+		};
+		const auto a = make(1000);
+		const auto b = make(1700);
+
+		std::vector<int> expect;
+		std::set_symmetric_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expect));
+
+		std::vector<int> ans;
+		xstd::SymmetricDifference(ans,a,b);
+		REQUIRE( ans == expect );
+	}
+}
@@ -0,0 +1,78 @@
+/*
+ * union.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/set/union.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <random>
+#include <set>
+#include <vector>
+
+
+TEST_CASE("Set Union", "[default]") {
+
+	SECTION("Mixed Containers"){
+		std::vector<double> vec = {1, 3, 5, 7, 9, 11};
+		std::list<double>   lst = {0, 2, 3, 5, 8, 11};
+		std::set<double>     st = {0, 2, 3, 5, 9, 10};
+
+		std::vector<double> ans;
+		xstd::Union(ans,vec,lst,st);
+		REQUIRE( ans == std::vector<double>{0, 1, 2, 3, 5, 7, 8, 9, 10, 11} );
+	}
+
+	SECTION("Keep Duplicates"){
+		std::vector<int> a = {1, 2, 2, 4};
+		std::vector<int> b = {2, 3};
+		std::vector<int> c;
+
+		std::vector<int> ans;
+		xstd::Union<false>(ans,a,b,c);
+		REQUIRE( ans == std::vector<int>{1, 2, 2, 2, 3, 4} );
+
+		ans.clear();
+		xstd::Union(ans,a,b,c);
+		REQUIRE( ans == std::vector<int>{1, 2, 3, 4} );
+	}
+
+	SECTION("Empty Containers"){
+		std::vector<int> a;
+		std::list<int>   b;
+		std::vector<int> ans;
+		xstd::Union(ans,a,b);
+		REQUIRE( ans.empty() );
+	}
+
+	SECTION("Random Shards"){
+		std::mt19937 mte(5);
+		std::uniform_int_distribution<int> dist(0, 2000);
+
+		std::vector<std::vector<int>> shards(5);
+		std::vector<int> expect;
+		for(auto& shard : shards){
+			shard.resize(700);
+			std::generate(shard.begin(), shard.end(), [&](){return dist(mte);});
+			std::sort(shard.begin(), shard.end());
+			expect.insert(expect.end(), shard.begin(), shard.end());
+		}
+		std::sort(expect.begin(), expect.end());
+
+		std::vector<int> merged;
+		xstd::Union<false>(merged, shards[0], shards[1], shards[2], shards[3], shards[4]);
+		REQUIRE( merged == expect );
+
+		expect.erase(std::unique(expect.begin(), expect.end()), expect.end());
+		std::vector<int> unique;
+		xstd::Union(unique, shards[0], shards[1], shards[2], shards[3], shards[4]);
+		REQUIRE( unique == expect );
+	}
+}
@@ -0,0 +1,72 @@
+/**
+ * \file       thread_pool.cpp
+ * \author     Bryan Flynt
+ * \date       Oct 16, 2026
+ * \copyright  Copyright (C) 2026 Bryan Flynt - All Rights Reserved
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/thread/thread_pool.hpp"
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+
+TEST_CASE("Thread Pool", "[default]") {
+
+	SECTION("Size"){
+		xstd::thread_pool pool(4);
+		REQUIRE( pool.size() == 4 );
+
+		xstd::thread_pool hw_pool;
+		REQUIRE( hw_pool.size() >= 1 );
+	}
+
+	SECTION("Every Task Executed Once"){
+		xstd::thread_pool pool(4);
+		std::vector<int> hits(1000, 0);
+		pool.parallel_for(hits.size(), [&](std::size_t i){
+			hits[i] += 1;
+		});
+		REQUIRE( std::all_of(hits.begin(), hits.end(), [](int h){return h == 1;}) );
+	}
+
+	SECTION("Repeated Phases"){
+		xstd::thread_pool pool(3);
+		std::atomic<std::size_t> sum = 0;
+		for(std::size_t phase = 0; phase < 100; ++phase){
+			pool.parallel_for(10, [&](std::size_t i){
+				sum += i;
+			});
+		}
+		REQUIRE( sum == 100 * 45 );
+	}
+
+	SECTION("Single Thread"){
+		xstd::thread_pool pool(1);
+		std::vector<std::size_t> order;
+		pool.parallel_for(5, [&](std::size_t i){
+			order.push_back(i);
+		});
+		REQUIRE( order == std::vector<std::size_t>{0, 1, 2, 3, 4} );
+	}
+
+	SECTION("Exception Propagation"){
+		xstd::thread_pool pool(4);
+		auto throwing = [](std::size_t i){
+			if( i == 7 ){
+				throw std::runtime_error("task failed");
+			}
+		};
+		REQUIRE_THROWS_AS( pool.parallel_for(16, throwing), std::runtime_error );
+
+		// Pool remains usable
+		std::atomic<std::size_t> count = 0;
+		pool.parallel_for(16, [&](std::size_t){ ++count; });
+		REQUIRE( count == 16 );
+	}
+}
@@ -14,6 +14,7 @@
 #include "xstd/detail/tuple/functional.hpp"
 
 #include <tuple>
+#include <utility>
 
 
 TEST_CASE("Tuple Functionals", "[default]") {
@@ -85,6 +86,23 @@ TEST_CASE("Tuple Functionals", "[default]") {
 		REQUIRE( std::get<2>(res) == -std::get<2>(a) );
 	}
 
+	SECTION("Pairs"){
+
+		auto a = std::make_pair(-1, 3.1415);
+		auto b = std::make_pair(+1, 1.1235);
+		auto res = a + b;
+
+		REQUIRE( std::get<0>(res) == (a.first + b.first) );
+		REQUIRE( std::get<1>(res) == (a.second + b.second) );
+
+		auto mixed = a * std::make_tuple(2, 2.0, 7);
+		STATIC_REQUIRE( std::tuple_size_v<decltype(mixed)> == 2 );
+		REQUIRE( std::get<0>(mixed) == -2 );
+
+		auto neg = -b;
+		REQUIRE( std::get<1>(neg) == -b.second );
+	}
+
 }
 
 
@@ -0,0 +1,108 @@
+/*
+ * relocatable.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/type_traits/relocatable.hpp"
+
+#include <array>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+
+
+namespace {
+
+struct Plain {
+	int    i;
+	double d;
+};
+
+struct Owner {
+	std::unique_ptr<int> value;
+};
+
+struct SelfReference {
+	SelfReference() : self(this) {}
+	SelfReference(const SelfReference&) : self(this) {}
+	SelfReference* self;
+};
+
+} // namespace
+
+template<>
+struct xstd::is_trivially_relocatable<Owner> : std::true_type {};
+
+
+TEST_CASE("Is Trivially Relocatable", "[default]") {
+	using namespace xstd;
+
+	STATIC_REQUIRE( is_trivially_relocatable_v<int> );
+	STATIC_REQUIRE( is_trivially_relocatable_v<Plain> );
+	STATIC_REQUIRE( is_trivially_relocatable_v<Owner> );
+	STATIC_REQUIRE( is_trivially_relocatable_v<std::array<Owner,3>> );
+	STATIC_REQUIRE( is_trivially_relocatable_v<std::pair<int,Owner>> );
+	STATIC_REQUIRE( not is_trivially_relocatable_v<SelfReference> );
+	STATIC_REQUIRE( not is_trivially_relocatable_v<std::string> );
+	STATIC_REQUIRE( not is_trivially_relocatable_v<std::pair<int,std::string>> );
+}
+
+TEST_CASE("Uninitialized Relocate", "[default]") {
+	using namespace xstd;
+
+	SECTION("Trivially Relocatable"){
+		alignas(Owner) unsigned char buffer[8 * sizeof(Owner)];
+		auto p = reinterpret_cast<Owner*>(buffer);
+		for(int i = 0; i < 4; ++i){
+			::new(p + i) Owner{std::make_unique<int>(i)};
+		}
+
+		// Overlapping shift up then back down
+		REQUIRE( uninitialized_relocate(p, p + 4, p + 2) == p + 6 );
+		REQUIRE( *p[2].value == 0 );
+		REQUIRE( *p[5].value == 3 );
+		uninitialized_relocate(p + 2, p + 6, p);
+		for(int i = 0; i < 4; ++i){
+			REQUIRE( *p[i].value == i );
+		}
+		std::destroy(p, p + 4);
+	}
+
+	SECTION("Element by Element"){
+		alignas(std::string) unsigned char buffer[8 * sizeof(std::string)];
+		auto p = reinterpret_cast<std::string*>(buffer);
+		for(int i = 0; i < 4; ++i){
+			::new(p + i) std::string(32, char('a' + i));
+		}
+
+		uninitialized_relocate(p, p + 4, p + 3);
+		REQUIRE( p[3] == std::string(32, 'a') );
+		REQUIRE( p[6] == std::string(32, 'd') );
+		uninitialized_relocate(p + 3, p + 7, p + 1);
+		REQUIRE( p[1] == std::string(32, 'a') );
+		REQUIRE( p[4] == std::string(32, 'd') );
+		std::destroy(p + 1, p + 5);
+	}
+}
+
+TEST_CASE("Swap Relocatable", "[default]") {
+	using namespace xstd;
+
+	std::array<Owner,100> a;
+	std::array<Owner,100> b;
+	for(int i = 0; i < 100; ++i){
+		a[i].value = std::make_unique<int>(i);
+		b[i].value = std::make_unique<int>(-i);
+	}
+	swap_relocatable(a.data(), b.data(), a.size());
+	for(int i = 0; i < 100; ++i){
+		REQUIRE( *a[i].value == -i );
+		REQUIRE( *b[i].value == i );
+	}
+}
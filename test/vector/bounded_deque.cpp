@@ -0,0 +1,124 @@
+/*
+ * bounded_deque.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/vector/bounded_deque.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+namespace {
+
+template<typename T, std::size_t N>
+void require_equal(const xstd::bounded_deque<T,N>& a, const std::deque<T>& b){
+	REQUIRE( a.size() == b.size() );
+	REQUIRE( std::equal(a.begin(), a.end(), b.begin(), b.end()) );
+}
+
+} // namespace
+
+
+TEST_CASE("Bounded Deque Construction", "[default]") {
+	using namespace xstd;
+
+	bounded_deque<int,5> a(3, 7);
+	require_equal(a, {7, 7, 7});
+	REQUIRE( a.capacity() == 5 );
+	STATIC_REQUIRE( std::is_trivially_destructible_v<bounded_deque<int,5>> );
+	STATIC_REQUIRE( not std::is_trivially_destructible_v<bounded_deque<std::string,5>> );
+
+	bounded_deque<int,5> b = {1, 2, 3, 4, 5};
+	REQUIRE( b.full() );
+	REQUIRE( b.front() == 1 );
+	REQUIRE( b.back() == 5 );
+	REQUIRE( b.at(3) == 4 );
+	REQUIRE_THROWS( b.at(5) );
+
+	bounded_deque<std::string,3> c(2);
+	REQUIRE( c[1].empty() );
+
+	const std::vector<int> v = {4, 5, 6};
+	bounded_deque<int,5> d(v.begin(), v.end());
+	REQUIRE( not (d < b) );
+	REQUIRE( b < d );
+	d = {1, 2, 3, 4, 5};
+	REQUIRE( d == b );
+}
+
+TEST_CASE("Bounded Deque Modifiers", "[default]") {
+	using namespace xstd;
+
+	bounded_deque<std::string,12> a;
+	std::deque<std::string> b;
+
+	// Random operations compared against std::deque
+	std::mt19937 gen(3);
+	for(int trial = 0; trial < 2000; ++trial){
+		const auto op = std::uniform_int_distribution<int>(0, 7)(gen);
+		const auto value = std::to_string(trial);
+		const auto index = b.empty() ? 0 : std::uniform_int_distribution<std::size_t>(0, b.size() - 1)(gen);
+		switch( op ){
+		case 0:
+			if( not a.full() ){ a.push_back(value); b.push_back(value); }
+			break;
+		case 1:
+			if( not a.full() ){ a.push_front(value); b.push_front(value); }
+			break;
+		case 2:
+			if( not a.empty() ){ a.pop_back(); b.pop_back(); }
+			break;
+		case 3:
+			if( not a.empty() ){ a.pop_front(); b.pop_front(); }
+			break;
+		case 4:
+			if( not a.full() ){
+				auto it = a.insert(a.begin() + index, value);
+				b.insert(b.begin() + index, value);
+				REQUIRE( *it == value );
+			}
+			break;
+		case 5:
+			if( not a.empty() ){
+				auto it = a.erase(a.begin() + index);
+				b.erase(b.begin() + index);
+				REQUIRE( (it - a.begin()) == static_cast<std::ptrdiff_t>(index) );
+			}
+			break;
+		case 6:
+			if( a.size() + 2 <= a.max_size() ){
+				a.insert(a.begin() + index, 2, value);
+				b.insert(b.begin() + index, 2, value);
+			}
+			break;
+		case 7:
+			if( not a.empty() ){
+				const auto count = std::min<std::size_t>(3, b.size() - index);
+				a.erase(a.begin() + index, a.begin() + index + count);
+				b.erase(b.begin() + index, b.begin() + index + count);
+			}
+			break;
+		}
+		require_equal(a, b);
+	}
+
+	a.resize(10, "x");
+	b.resize(10, "x");
+	require_equal(a, b);
+	a.resize(4);
+	b.resize(4);
+	require_equal(a, b);
+
+	REQUIRE( erase_if(a, [](const auto&){ return true; }) == 4 );
+	REQUIRE( a.empty() );
+}
@@ -0,0 +1,160 @@
+/*
+ * bounded_ring.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+#include "lifetime_types.hpp"
+
+#include "xstd/detail/vector/bounded_ring.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+namespace {
+
+template<typename Ring>
+std::vector<typename Ring::value_type> to_vector(const Ring& ring){
+	return std::vector<typename Ring::value_type>(ring.begin(), ring.end());
+}
+
+} // namespace
+
+
+TEST_CASE("Bounded Ring Queue", "[default]") {
+	using namespace xstd;
+
+	bounded_ring<int,8> ring;
+	REQUIRE( ring.empty() );
+	REQUIRE( ring.capacity() == 8 );
+
+	// Wrap the head around the storage several times
+	std::deque<int> expect;
+	int next = 0;
+	for(int round = 0; round < 20; ++round){
+		while( not ring.full() ){
+			ring.push_back(next);
+			expect.push_back(next++);
+		}
+		REQUIRE( ring.size() == 8 );
+		for(int i = 0; i < 3; ++i){
+			REQUIRE( ring.front() == expect.front() );
+			ring.pop_front();
+			expect.pop_front();
+		}
+		REQUIRE( std::equal(ring.begin(), ring.end(), expect.begin(), expect.end()) );
+		REQUIRE( ring[2] == expect[2] );
+		REQUIRE( ring.back() == expect.back() );
+	}
+
+	ring.push_front(-1);
+	ring.emplace_front(-2);
+	expect.push_front(-1);
+	expect.push_front(-2);
+	ring.pop_back();
+	expect.pop_back();
+	REQUIRE( std::equal(ring.begin(), ring.end(), expect.begin(), expect.end()) );
+	REQUIRE( std::equal(ring.rbegin(), ring.rend(), expect.rbegin(), expect.rend()) );
+	REQUIRE_THROWS( ring.at(ring.size()) );
+
+	auto copy = ring;
+	REQUIRE( copy == ring );
+	copy.pop_front();
+	REQUIRE( copy != ring );
+}
+
+TEST_CASE("Bounded Ring Spans", "[default]") {
+	using namespace xstd;
+
+	bounded_ring<int,8> ring;
+	for(int i = 0; i < 6; ++i){
+		ring.push_back(i);
+	}
+	ring.pop_front(4);
+	for(int i = 6; i < 11; ++i){
+		ring.push_back(i);
+	}
+	REQUIRE( to_vector(ring) == std::vector<int>{4, 5, 6, 7, 8, 9, 10} );
+
+	// Elements wrap so the second span is not empty
+	auto [a, b] = ring.spans();
+	REQUIRE( a.size() == 4 );
+	REQUIRE( b.size() == 3 );
+	std::vector<int> joined(a.begin(), a.end());
+	joined.insert(joined.end(), b.begin(), b.end());
+	REQUIRE( joined == to_vector(ring) );
+
+	// Batch processing through the spans
+	for(auto span : {a, b}){
+		for(auto& v : span){
+			v *= 10;
+		}
+	}
+	REQUIRE( std::accumulate(ring.begin(), ring.end(), 0) == 490 );
+
+	ring.pop_front(a.size());
+	const auto& cring = ring;
+	auto [c, d] = cring.spans();
+	REQUIRE( c.size() == 3 );
+	REQUIRE( d.empty() );
+	REQUIRE( c[0] == 80 );
+
+	ring.pop_back(2);
+	REQUIRE( to_vector(ring) == std::vector<int>{80} );
+}
+
+TEST_CASE("Bounded Ring Lifetime", "[default]") {
+	using namespace xstd;
+
+	// Trivial elements keep a trivial destructor
+	STATIC_REQUIRE( std::is_trivially_destructible_v<bounded_ring<int,4>> );
+	STATIC_REQUIRE( not std::is_trivially_destructible_v<bounded_ring<Counted,4>> );
+
+	Counted::reset();
+	{
+		bounded_ring<Counted,4> a;
+		REQUIRE( Counted::alive() == 0 );
+
+		for(int i = 0; i < 4; ++i){
+			a.emplace_back(i);
+		}
+		a.pop_front(2);
+		a.emplace_back(4);
+		a.emplace_back(5);
+		REQUIRE( Counted::alive() == 4 );
+
+		bounded_ring<Counted,4> b(std::move(a));
+		REQUIRE( a.empty() );
+		REQUIRE( Counted::alive() == 4 );
+		REQUIRE( b.front().value == 2 );
+		REQUIRE( b.back().value == 5 );
+
+		bounded_ring<Counted,4> c;
+		c.emplace_back(9);
+		swap(b, c);
+		REQUIRE( b.size() == 1 );
+		REQUIRE( c.size() == 4 );
+		REQUIRE( c[1].value == 3 );
+		REQUIRE( Counted::alive() == 5 );
+
+		c.pop_back(3);
+		REQUIRE( Counted::alive() == 2 );
+	}
+	REQUIRE( Counted::alive() == 0 );
+
+	bounded_ring<std::unique_ptr<std::string>,2> owners;
+	owners.push_back(std::make_unique<std::string>("a"));
+	owners.push_front(std::make_unique<std::string>("b"));
+	auto moved = std::move(owners);
+	REQUIRE( *moved[0] == "b" );
+	REQUIRE( *moved[1] == "a" );
+}
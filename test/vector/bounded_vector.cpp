@@ -1,9 +1,27 @@
 
 #include "xstd/detail/vector/bounded_vector.hpp"
 
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "catch.hpp"
+#include "lifetime_types.hpp"
+
+namespace {
+
+/// Type without a default constructor
+struct NoDefault {
+    explicit NoDefault(std::string s) : value(std::move(s)) {}
+
+    bool operator==(const NoDefault& other) const = default;
+
+    std::string value;
+};
+
+}  // namespace
 
 TEST_CASE("Static Vector", "[default]") {
     using namespace std;
@@ -490,3 +508,146 @@ TEST_CASE("Static Vector", "[default]") {
         REQUIRE(vb == b);
     }
 }
+
+TEST_CASE("Static Vector Element Lifetime", "[default]") {
+    using namespace std;
+    using namespace xstd;
+
+    constexpr std::size_t N = 8;
+
+    SECTION("Trivial elements keep a trivial destructor") {
+        STATIC_REQUIRE(std::is_trivially_destructible_v<bounded_vector<int, N>>);
+        STATIC_REQUIRE(std::is_trivially_destructible_v<bounded_vector<double, 0>>);
+        STATIC_REQUIRE(not std::is_trivially_destructible_v<bounded_vector<Counted, N>>);
+    }
+
+    SECTION("Only live elements are constructed") {
+        Counted::reset();
+        {
+            bounded_vector<Counted, N> a;
+            REQUIRE(Counted::alive() == 0);
+
+            bounded_vector<Counted, N> b(3);
+            REQUIRE(Counted::alive() == 3);
+
+            b.push_back(Counted(4));
+            b.emplace_back(5);
+            REQUIRE(Counted::alive() == 5);
+
+            b.pop_back();
+            b.erase(b.begin());
+            REQUIRE(Counted::alive() == 3);
+
+            b.resize(5, Counted(7));
+            REQUIRE(Counted::alive() == 5);
+
+            b.insert(b.begin() + 1, 2, Counted(9));
+            b.emplace(b.begin(), 1);
+            REQUIRE(b.size() == 8);
+            REQUIRE(b[0].value == 1);
+            REQUIRE(b[2].value == 9);
+            REQUIRE(b[3].value == 9);
+            REQUIRE(Counted::alive() == 8);
+
+            b.resize(2);
+            REQUIRE(Counted::alive() == 2);
+        }
+        REQUIRE(Counted::alive() == 0);
+    }
+
+    SECTION("Move and swap touch live elements") {
+        Counted::reset();
+        {
+            bounded_vector<Counted, N> a = {1, 2, 3};
+            bounded_vector<Counted, N> b = {4};
+            REQUIRE(Counted::alive() == 4);
+
+            // Three moved from and destroyed within a
+            const auto constructed = Counted::constructed;
+            bounded_vector<Counted, N> c(std::move(a));
+            REQUIRE(a.empty());
+            REQUIRE(c.size() == 3);
+            REQUIRE(Counted::constructed - constructed == 3);
+            REQUIRE(Counted::alive() == 4);
+
+            c.swap(b);
+            REQUIRE(b.size() == 3);
+            REQUIRE(c.size() == 1);
+            REQUIRE(b[2].value == 3);
+            REQUIRE(c[0].value == 4);
+            REQUIRE(Counted::alive() == 4);
+
+            b = std::move(c);
+            REQUIRE(b.size() == 1);
+            REQUIRE(c.empty());
+            REQUIRE(b[0].value == 4);
+            REQUIRE(Counted::alive() == 1);
+        }
+        REQUIRE(Counted::alive() == 0);
+    }
+
+    SECTION("Non default constructible values") {
+        bounded_vector<NoDefault, N> a;
+        a.emplace_back("one");
+        a.push_back(NoDefault("two"));
+        a.insert(a.begin(), NoDefault("zero"));
+        a.assign(2, NoDefault("same"));
+        a.emplace_back("last");
+
+        bounded_vector<NoDefault, N> b(a);
+        bounded_vector<NoDefault, N + 1> c;
+        c.emplace_back("other");
+        b.swap(c);
+
+        REQUIRE(b.size() == 1);
+        REQUIRE(c.size() == 3);
+        REQUIRE(c[0].value == "same");
+        REQUIRE(c[2].value == "last");
+        REQUIRE(b[0].value == "other");
+    }
+}
+
+TEST_CASE("Static Vector Trivially Relocatable", "[default]") {
+    using namespace std;
+    using namespace xstd;
+
+    constexpr std::size_t N = 8;
+
+    auto values = [](const auto& v) {
+        vector<int> ans;
+        for (const auto& h : v) {
+            ans.push_back(*h);
+        }
+        return ans;
+    };
+
+    bounded_vector<Handle, N> a;
+    for (int i = 0; i < 4; ++i) {
+        a.emplace_back(i);
+    }
+
+    a.emplace(a.begin() + 1, 10);
+    a.insert(a.begin(), Handle(11));
+    REQUIRE(values(a) == vector<int>{11, 0, 10, 1, 2, 3});
+
+    a.erase(a.begin() + 2);
+    a.erase(a.begin(), a.begin() + 2);
+    REQUIRE(values(a) == vector<int>{1, 2, 3});
+
+    bounded_vector<Handle, N> b;
+    b.emplace_back(7);
+    a.swap(b);
+    REQUIRE(values(a) == vector<int>{7});
+    REQUIRE(values(b) == vector<int>{1, 2, 3});
+
+    bounded_vector<Handle, N + 1> c;
+    b.swap(c);
+    REQUIRE(b.empty());
+    REQUIRE(values(c) == vector<int>{1, 2, 3});
+
+    bounded_vector<int, N> d = {1, 2, 3};
+    const vector<int> more = {4, 5};
+    d.insert(d.begin() + 1, more.begin(), more.end());
+    d.insert(d.end() - 1, 2, d[0]);
+    REQUIRE(d == vector<int>{1, 4, 5, 2, 1, 1, 3});
+}
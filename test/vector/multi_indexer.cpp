@@ -11,7 +11,11 @@
 
 #include "xstd/detail/vector/multi_indexer.hpp"
 
+#include <algorithm>
+#include <array>
 #include <iostream>
+#include <tuple>
+#include <vector>
 
 TEST_CASE("MultiIndexer", "[default]") {
 	using namespace xstd;
@@ -100,3 +104,253 @@ TEST_CASE("MultiIndexer", "[default]") {
 	}
 }
 
+
+TEST_CASE("MultiIndexer Odometer", "[default]") {
+	using namespace xstd;
+
+	RowMajorIndex<3> index({3,4,5});
+	RowMajorIndex<3> check({3,4,5});
+
+	for(std::size_t n = 1; n < index.size(); ++n){
+		++index;
+		check = n;
+		REQUIRE( std::size_t(index) == n );
+		for(std::size_t i = 0; i < 3; ++i){
+			REQUIRE( index[i] == check[i] );
+		}
+	}
+	for(std::size_t n = index.size()-1; n-- > 0;){
+		--index;
+		check = n;
+		REQUIRE( std::size_t(index) == n );
+		for(std::size_t i = 0; i < 3; ++i){
+			REQUIRE( index[i] == check[i] );
+		}
+	}
+}
+
+TEST_CASE("MultiIndexer Tiled", "[default]") {
+	using namespace xstd;
+
+	const std::array<std::size_t,3> shape = {5,7,6};
+	const std::array<std::size_t,3> tile  = {2,3,4};
+
+	TiledRowMajorIndex<3> index(shape, tile);
+	REQUIRE( index.size() == 5*7*6 );
+
+	// Expected order from explicit loops over tiles
+	std::vector<std::size_t> expected;
+	for(std::size_t ti = 0; ti < shape[0]; ti += tile[0]){
+		for(std::size_t tj = 0; tj < shape[1]; tj += tile[1]){
+			for(std::size_t tk = 0; tk < shape[2]; tk += tile[2]){
+				for(std::size_t i = ti; i < std::min(ti+tile[0],shape[0]); ++i){
+					for(std::size_t j = tj; j < std::min(tj+tile[1],shape[1]); ++j){
+						for(std::size_t k = tk; k < std::min(tk+tile[2],shape[2]); ++k){
+							expected.push_back((i*shape[1] + j)*shape[2] + k);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	std::vector<std::size_t> visited;
+	for(; index.count() < index.size(); ++index){
+		REQUIRE( std::size_t(index) == (index[0]*shape[1] + index[1])*shape[2] + index[2] );
+		visited.push_back(index);
+	}
+	REQUIRE( visited == expected );
+
+	SECTION("Tile Larger Than Shape"){
+		TiledRowMajorIndex<2> whole({3,4}, {8,8});
+		for(std::size_t n = 0; n < whole.size(); ++n, ++whole){
+			REQUIRE( std::size_t(whole) == n );
+		}
+		REQUIRE( whole.count() == whole.size() );
+	}
+}
+
+TEST_CASE("MultiIndexer Strided", "[default]") {
+	using namespace xstd;
+
+	const std::array<std::size_t,3> shape = {6,7,8};
+	StridedRowMajorIndex<3> index(shape, {1,0,2}, {2,3,3}, {3,2,2});
+	REQUIRE( index.size() == 2*3*3 );
+
+	std::vector<std::size_t> expected;
+	for(std::size_t i = 0; i < 2; ++i){
+		for(std::size_t j = 0; j < 3; ++j){
+			for(std::size_t k = 0; k < 3; ++k){
+				expected.push_back(((1+3*i)*shape[1] + (0+2*j))*shape[2] + (2+2*k));
+			}
+		}
+	}
+
+	std::vector<std::size_t> visited;
+	for(; index.count() < index.size(); ++index){
+		REQUIRE( std::size_t(index) == (index[0]*shape[1] + index[1])*shape[2] + index[2] );
+		visited.push_back(index);
+	}
+	REQUIRE( visited == expected );
+}
+
+TEST_CASE("MultiIndexer ColumnMajor", "[default]") {
+	using namespace xstd;
+
+	const std::size_t R = 3;
+	const std::size_t C = 4;
+	const std::size_t M = 2;
+	ColumnMajorIndex<3> index({R,C,M});
+	REQUIRE( index.size() == R*C*M );
+	REQUIRE( index.stride(0) == 1 );
+	REQUIRE( index.stride(1) == R );
+	REQUIRE( index.stride(2) == R*C );
+
+	for(std::size_t k = 0; k < M; ++k){
+		for(std::size_t j = 0; j < C; ++j){
+			for(std::size_t i = 0; i < R; ++i){
+				const std::size_t n = i + R*(j + C*k);
+				REQUIRE( std::size_t(index) == n );
+				REQUIRE( index[0] == i );
+				REQUIRE( index[1] == j );
+				REQUIRE( index[2] == k );
+				if( n + 1 < index.size() ){
+					++index;
+				}
+			}
+		}
+	}
+
+	--index;
+	REQUIRE( index[0] == R-2 );
+	REQUIRE( index[2] == M-1 );
+
+	auto i = index(1,2,1);
+	REQUIRE( i == 1 + R*(2 + C*1) );
+	index = 5;
+	REQUIRE( index[0] == 2 );
+	REQUIRE( index[1] == 1 );
+	REQUIRE( index[2] == 0 );
+}
+
+namespace {
+
+/// Visit every point of shape along the curve checking the coordinates
+template<typename Index, std::size_t N>
+void check_curve(const std::array<std::size_t,N> shape, const bool neighbors){
+	Index index(shape);
+
+	std::vector<int> seen(index.size(), 0);
+	std::size_t previous = 0;
+	std::array<std::size_t,N> last{};
+	std::size_t count = 0;
+	for(; index < index.capacity(); ++index){
+		REQUIRE( ((count == 0) || (std::size_t(index) > previous)) );
+		previous = index;
+
+		std::size_t linear = 0;
+		std::size_t distance = 0;
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( index[i] < shape[i] );
+			linear = linear * shape[i] + index[i];
+			distance += (index[i] > last[i]) ? (index[i] - last[i]) : (last[i] - index[i]);
+			last[i] = index[i];
+		}
+		if( neighbors && (count > 0) ){
+			REQUIRE( distance == 1 );
+		}
+		++seen[linear];
+		++count;
+
+		// Encoding the coordinates returns the same position
+		Index check(shape);
+		std::array<std::size_t,N> x;
+		for(std::size_t i = 0; i < N; ++i){
+			x[i] = index[i];
+		}
+		REQUIRE( std::apply([&](auto... args){ return check(args...); }, x) == std::size_t(index) );
+	}
+	REQUIRE( count == index.size() );
+	REQUIRE( std::all_of(seen.begin(), seen.end(), [](int s){ return s == 1; }) );
+
+	// Walk back to the origin
+	for(std::size_t n = 0; n < count; ++n){
+		--index;
+	}
+	REQUIRE( std::size_t(index) == 0 );
+}
+
+} // namespace
+
+TEST_CASE("MultiIndexer Morton", "[default]") {
+	using namespace xstd;
+
+	MortonIndex<2> index({4,4});
+	REQUIRE( index.capacity() == 16 );
+	REQUIRE( index(0,1) == 1 );
+	REQUIRE( index(1,0) == 2 );
+	REQUIRE( index(1,1) == 3 );
+	REQUIRE( index(0,2) == 4 );
+	REQUIRE( index(3,3) == 15 );
+	index = 6;
+	REQUIRE( index[0] == 1 );
+	REQUIRE( index[1] == 2 );
+
+	// Compare against bit by bit interleaving
+	MortonIndex<4> index4({16,16,16,16});
+	REQUIRE( index4(0b1010,0b0110,0b0011,0b1001) == 0b1001'0100'1110'0011 );
+
+	check_curve<MortonIndex<1>>(std::array<std::size_t,1>{7}, true);
+	check_curve<MortonIndex<2>>(std::array<std::size_t,2>{8,8}, false);
+	check_curve<MortonIndex<2>>(std::array<std::size_t,2>{5,7}, false);
+	check_curve<MortonIndex<3>>(std::array<std::size_t,3>{3,6,5}, false);
+	check_curve<MortonIndex<4>>(std::array<std::size_t,4>{2,3,4,5}, false);
+
+	SECTION("Non-Cubic Shapes"){
+		// Power of two boxes are numbered without gaps
+		MortonIndex<3> slab({1024,4,4});
+		REQUIRE( slab.capacity() == slab.size() );
+		REQUIRE( slab.bits(0) == 10 );
+		REQUIRE( slab.bits(1) == 2 );
+		REQUIRE( slab(1023,3,3) == slab.capacity() - 1 );
+
+		MortonIndex<3> rod({4096,2,2});
+		REQUIRE( rod.capacity() == 16384 );
+		REQUIRE( MortonIndex<2>({4096,1}).capacity() == 4096 );
+
+		check_curve<MortonIndex<3>>(std::array<std::size_t,3>{1024,4,4}, false);
+		check_curve<MortonIndex<3>>(std::array<std::size_t,3>{4096,2,2}, false);
+		check_curve<MortonIndex<3>>(std::array<std::size_t,3>{1000,3,5}, false);
+		check_curve<MortonIndex<2>>(std::array<std::size_t,2>{1,777}, true);
+	}
+
+	SECTION("Large Coordinates"){
+		MortonIndex<3> big({std::size_t(1) << 20, 3, std::size_t(1) << 20});
+		const std::size_t code = big((std::size_t(1) << 20) - 1, 2, 12345);
+		big = code;
+		REQUIRE( big[0] == (std::size_t(1) << 20) - 1 );
+		REQUIRE( big[1] == 2 );
+		REQUIRE( big[2] == 12345 );
+	}
+}
+
+TEST_CASE("MultiIndexer Hilbert", "[default]") {
+	using namespace xstd;
+
+	// Consecutive points of complete cubes are neighbors
+	check_curve<HilbertIndex<1>>(std::array<std::size_t,1>{8}, true);
+	check_curve<HilbertIndex<2>>(std::array<std::size_t,2>{2,2}, true);
+	check_curve<HilbertIndex<2>>(std::array<std::size_t,2>{16,16}, true);
+	check_curve<HilbertIndex<3>>(std::array<std::size_t,3>{8,8,8}, true);
+	check_curve<HilbertIndex<4>>(std::array<std::size_t,4>{4,4,4,4}, true);
+
+	// Clipped cubes still visit every point once
+	check_curve<HilbertIndex<2>>(std::array<std::size_t,2>{5,7}, false);
+	check_curve<HilbertIndex<3>>(std::array<std::size_t,3>{3,6,5}, false);
+
+	// Blocks of the cube outside the shape are skipped
+	HilbertIndex<3> slab({1024,4,4});
+	REQUIRE( slab.capacity() == (std::size_t(1) << 30) );
+	check_curve<HilbertIndex<3>>(std::array<std::size_t,3>{1024,4,4}, false);
+	check_curve<HilbertIndex<3>>(std::array<std::size_t,3>{4096,2,2}, false);
+}
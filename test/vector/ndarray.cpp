@@ -0,0 +1,210 @@
+/*
+ * ndarray.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/memory/aligned.hpp"
+#include "xstd/detail/vector/ndarray.hpp"
+
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <string>
+
+
+namespace {
+
+template<typename Array>
+void fill_linear(Array& a){
+	std::iota(a.begin(), a.end(), 0);
+}
+
+} // namespace
+
+
+TEST_CASE("NDArray Layout", "[default]") {
+	using namespace xstd;
+
+	SECTION("Row Major"){
+		ndarray<int,3> a({2,3,4});
+		REQUIRE( a.size() == 24 );
+		REQUIRE( a.stride(0) == 12 );
+		REQUIRE( a.stride(1) == 4 );
+		REQUIRE( a.stride(2) == 1 );
+		REQUIRE( is_aligned(a.data(), 64) );
+
+		fill_linear(a);
+		REQUIRE( a(0,0,1) == 1 );
+		REQUIRE( a(1,2,3) == 23 );
+		REQUIRE( a[{1,0,2}] == 14 );
+
+		a(1,1,1) = -1;
+		REQUIRE( a.data()[17] == -1 );
+	}
+
+	SECTION("Column Major"){
+		ndarray<int,3,ColumnMajorIndex> a({2,3,4});
+		REQUIRE( a.stride(0) == 1 );
+		REQUIRE( a.stride(1) == 2 );
+		REQUIRE( a.stride(2) == 6 );
+
+		fill_linear(a);
+		REQUIRE( a(1,0,0) == 1 );
+		REQUIRE( a(1,2,3) == 23 );
+	}
+
+	SECTION("Empty and Resize"){
+		ndarray<double,2> a;
+		REQUIRE( a.empty() );
+		a.resize({3,0});
+		REQUIRE( a.empty() );
+		a.resize({3,5});
+		REQUIRE( a.size() == 15 );
+		REQUIRE( a.stride(0) == 5 );
+
+		ndarray<double,2> b({3,5}, 2.0);
+		a.fill(2.0);
+		REQUIRE( a == b );
+		b(2,4) = 1;
+		REQUIRE( not (a == b) );
+		swap(a, b);
+		REQUIRE( a(2,4) == 1 );
+	}
+}
+
+TEST_CASE("NDArray Views", "[default]") {
+	using namespace xstd;
+
+	ndarray<int,3> a({4,5,6});
+	fill_linear(a);
+
+	auto v = a.view();
+	REQUIRE( v.is_contiguous() );
+	REQUIRE( v(3,4,5) == a(3,4,5) );
+
+	SECTION("Slice"){
+		auto s = v.slice(1, 1, 2, 2);
+		REQUIRE( s.extent(1) == 2 );
+		REQUIRE( not s.is_contiguous() );
+		REQUIRE( s(2,0,3) == a(2,1,3) );
+		REQUIRE( s(2,1,3) == a(2,3,3) );
+
+		s(0,1,0) = -7;
+		REQUIRE( a(0,3,0) == -7 );
+
+		// Outer slices remain contiguous
+		REQUIRE( v.slice(0, 1, 2).is_contiguous() );
+	}
+
+	SECTION("Subview"){
+		auto plane = v.subview(1, 2);
+		REQUIRE( plane.rank == 2 );
+		REQUIRE( plane.extent(0) == 4 );
+		REQUIRE( plane.extent(1) == 6 );
+		REQUIRE( plane(3,5) == a(3,2,5) );
+
+		auto line = plane.subview(1, 4);
+		REQUIRE( line.extent(0) == 4 );
+		REQUIRE( line(2) == a(2,2,4) );
+		REQUIRE( not line.is_contiguous() );
+	}
+
+	SECTION("Const View"){
+		const auto& ca = a;
+		ndarray_view<const int,3> cv = ca.view();
+		ndarray_view<const int,3> from_mutable = v;
+		REQUIRE( cv(1,2,3) == from_mutable(1,2,3) );
+	}
+}
+
+TEST_CASE("NDArray Bulk Operations", "[default]") {
+	using namespace xstd;
+
+	ndarray<double,3> a({4,5,6});
+	ndarray<double,3> b({4,5,6});
+	fill_linear(a);
+
+	SECTION("Contiguous"){
+		b.assign(a.view());
+		REQUIRE( a == b );
+
+		b.transform(a.view(), [](double x){ return 2*x; });
+		REQUIRE( b(3,4,5) == 2*a(3,4,5) );
+
+		b.transform(a.view(), b.view(), [](double x, double y){ return x + y; });
+		REQUIRE( b(1,2,3) == 3*a(1,2,3) );
+
+		b.view().fill(1.5);
+		REQUIRE( b(0,0,0) == 1.5 );
+		REQUIRE( b(3,4,5) == 1.5 );
+	}
+
+	SECTION("Strided"){
+		b.fill(0);
+		auto src = a.view().slice(2, 1, 3, 2);
+		auto dst = b.view().slice(2, 0, 3, 2);
+		dst.assign(src);
+		for(std::size_t i = 0; i < 4; ++i){
+			for(std::size_t j = 0; j < 5; ++j){
+				for(std::size_t k = 0; k < 3; ++k){
+					REQUIRE( b(i,j,2*k) == a(i,j,1+2*k) );
+					REQUIRE( b(i,j,2*k+1) == 0 );
+				}
+			}
+		}
+
+		dst.fill(-1.0);
+		REQUIRE( b(3,4,4) == -1 );
+		REQUIRE( b(3,4,5) == 0 );
+	}
+
+	SECTION("Mixed Layouts"){
+		ndarray<double,3,ColumnMajorIndex> c({4,5,6});
+		c.assign(a.view());
+		for(std::size_t i = 0; i < 4; ++i){
+			for(std::size_t j = 0; j < 5; ++j){
+				for(std::size_t k = 0; k < 6; ++k){
+					REQUIRE( c(i,j,k) == a(i,j,k) );
+				}
+			}
+		}
+
+		b.transform(a.view(), c.view(), [](double x, double y){ return x - y; });
+		REQUIRE( std::accumulate(b.begin(), b.end(), 0.0) == 0 );
+	}
+
+	SECTION("Whole Arrays"){
+		b.assign(a);
+		REQUIRE( a == b );
+
+		b.transform(a, [](double x){ return 2*x; });
+		REQUIRE( b(3,4,5) == 2*a(3,4,5) );
+
+		b.transform(a, b, [](double x, double y){ return x + y; });
+		REQUIRE( b(1,2,3) == 3*a(1,2,3) );
+
+		ndarray<float,3,ColumnMajorIndex> c({4,5,6});
+		c.assign(a);
+		REQUIRE( c(2,3,4) == static_cast<float>(a(2,3,4)) );
+
+		b.transform(a, c.view(), [](double x, float y){ return x - y; });
+		REQUIRE( b(0,1,2) == a(0,1,2) - c(0,1,2) );
+		b.transform(a.view(), c, [](double x, float y){ return x + y; });
+		REQUIRE( b(0,1,2) == a(0,1,2) + c(0,1,2) );
+	}
+
+	SECTION("Non Trivial Values"){
+		ndarray<std::string,2> s({2,3}, "x");
+		ndarray<std::string,2> t({2,3});
+		t.assign(s.view());
+		REQUIRE( t(1,2) == "x" );
+		t.view().subview(0, 1).fill(std::string("y"));
+		REQUIRE( t(0,2) == "x" );
+		REQUIRE( t(1,0) == "y" );
+	}
+}
@@ -0,0 +1,126 @@
+/*
+ * parallel_vector_math.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/vector/parallel_vector_math.hpp"
+#include "xstd/detail/vector/vector_math.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+namespace {
+
+std::vector<double> random_vector(const std::size_t n, const unsigned seed){
+	std::mt19937 gen(seed);
+	std::uniform_real_distribution<double> dist(-1, 1);
+	std::vector<double> ans(n);
+	for(auto& v : ans){
+		v = dist(gen);
+	}
+	return ans;
+}
+
+} // namespace
+
+
+TEST_CASE("Parallel Vector Assign", "[default]") {
+	using namespace xstd;
+
+	const std::size_t N = 10007;
+	const auto x = random_vector(N, 1);
+	const auto y = random_vector(N, 2);
+
+	thread_pool pool(4);
+	const parallel_policy policy(pool, 1000);
+
+	SECTION("Matches Serial"){
+		std::vector<double> serial = 2.0*x + y/3.0 - x*y;
+		std::vector<double> r;
+		assign(policy, r, 2.0*x + y/3.0 - x*y);
+		REQUIRE( r == serial );
+		REQUIRE( eval(policy, 2.0*x + y/3.0 - x*y) == serial );
+	}
+
+	SECTION("Aliased Destination"){
+		std::vector<double> r = x;
+		assign(policy, r, r - 0.5*y);
+		std::vector<double> serial = x - 0.5*y;
+		REQUIRE( r == serial );
+	}
+
+	SECTION("Empty"){
+		std::vector<double> a, b, r(3);
+		assign(policy, r, a + b);
+		REQUIRE( r.empty() );
+	}
+}
+
+
+TEST_CASE("Parallel Vector Reductions", "[default]") {
+	using namespace xstd;
+
+	const std::size_t N = 100003;
+	const auto x = random_vector(N, 3);
+	const auto y = random_vector(N, 4);
+
+	thread_pool pool1(1);
+	thread_pool pool3(3);
+	thread_pool pool4(4);
+	const parallel_policy p1(pool1, 4096);
+	const parallel_policy p3(pool3, 4096);
+	const parallel_policy p4(pool4, 4096);
+
+	SECTION("Agree With Serial"){
+		REQUIRE( dot_product(p4, x, y) == Approx(dot_product(x, y)) );
+		REQUIRE( norm1(p4, x) == Approx(norm1(x)) );
+		REQUIRE( norm2(p4, x) == Approx(norm2(x)) );
+		REQUIRE( norm_inf(p4, x) == norm_inf(x) );
+		REQUIRE( dot_product(p4, x + y, x) == Approx(dot_product(x + y, x)) );
+		REQUIRE( norm1(p4, x - y) == Approx(norm1(x - y)) );
+	}
+
+	SECTION("Independent Of Thread Count"){
+		for(auto mode : {summation::fast, summation::deterministic}){
+			const auto d1 = dot_product(p1, x, y, mode);
+			REQUIRE( dot_product(p3, x, y, mode) == d1 );
+			REQUIRE( dot_product(p4, x, y, mode) == d1 );
+
+			const auto n1 = norm1(p1, x, mode);
+			REQUIRE( norm1(p3, x, mode) == n1 );
+			REQUIRE( norm1(p4, x, mode) == n1 );
+
+			const auto e1 = dot_product(p1, x - y, y, mode);
+			REQUIRE( dot_product(p3, x - y, y, mode) == e1 );
+			REQUIRE( dot_product(p4, x - y, y, mode) == e1 );
+		}
+		REQUIRE( norm_inf(p3, x) == norm_inf(p1, x) );
+	}
+
+	SECTION("Mixed Types"){
+		std::vector<float> f(y.begin(), y.end());
+		REQUIRE( dot_product(p4, x, f) == Approx(dot_product(x, f)) );
+	}
+
+	SECTION("NaN Propagates"){
+		auto z = x;
+		z[N - 7] = std::numeric_limits<double>::quiet_NaN();
+		REQUIRE( std::isnan(norm_inf(p4, z)) );
+		REQUIRE( std::isnan(norm_inf(p4, z + y)) );
+	}
+
+	SECTION("Empty"){
+		std::vector<double> a;
+		REQUIRE( dot_product(p4, a, a) == 0 );
+		REQUIRE( norm_inf(p4, a) == 0 );
+	}
+}
@@ -0,0 +1,149 @@
+/*
+ * simd_reduce.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/vector/simd_reduce.hpp"
+#include "xstd/detail/vector/vector_math.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+
+namespace {
+
+template<typename T>
+std::vector<T> random_vector(const std::size_t n, const unsigned seed){
+	std::mt19937 gen(seed);
+	std::uniform_real_distribution<T> dist(-1, 1);
+	std::vector<T> ans(n);
+	for(auto& v : ans){
+		v = dist(gen);
+	}
+	return ans;
+}
+
+template<typename T>
+void check_kernels(const xstd::detail::simd_kernels<T>& kernels){
+	for(std::size_t n : {0, 1, 3, 15, 16, 17, 33, 100, 1001}){
+		const auto a = random_vector<T>(n, 7 + n);
+		const auto b = random_vector<T>(n, 11 + n);
+
+		long double dot  = 0;
+		long double asum = 0;
+		long double amax = 0;
+		for(std::size_t i = 0; i < n; ++i){
+			dot  += static_cast<long double>(a[i]) * b[i];
+			asum += std::abs(static_cast<long double>(a[i]));
+			amax  = std::max(amax, std::abs(static_cast<long double>(a[i])));
+		}
+
+		const double eps = std::is_same<T,float>::value ? 1.0e-4 : 1.0e-12;
+		REQUIRE( kernels.dot(a.data(), b.data(), n) == Approx(static_cast<double>(dot)).epsilon(eps).margin(eps) );
+		REQUIRE( kernels.asum(a.data(), n) == Approx(static_cast<double>(asum)).epsilon(eps).margin(eps) );
+		REQUIRE( kernels.amax(a.data(), n) == static_cast<T>(amax) );
+
+		// NaN anywhere propagates to the maximum
+		for(std::size_t pos : {std::size_t(0), n / 2, n - 1}){
+			if( pos < n ){
+				auto c = a;
+				c[pos] = std::numeric_limits<T>::quiet_NaN();
+				REQUIRE( std::isnan(kernels.amax(c.data(), n)) );
+			}
+		}
+	}
+}
+
+template<typename T>
+void check_level(const xstd::detail::simd_level level){
+	check_kernels<T>(xstd::detail::select_simd_kernels<T>(level));
+}
+
+} // namespace
+
+
+TEST_CASE("SIMD Reduce Kernels", "[default]") {
+	using namespace xstd::detail;
+
+	SECTION("Scalar"){
+		check_level<float>(simd_level::scalar);
+		check_level<double>(simd_level::scalar);
+	}
+
+#if defined(XSTD_HAS_TARGET_DISPATCH)
+	SECTION("SSE2"){
+		if( XSTD_CPU_SUPPORTS("sse2") ){
+			check_level<float>(simd_level::sse2);
+			check_level<double>(simd_level::sse2);
+		}
+	}
+
+	SECTION("AVX2"){
+		if( XSTD_CPU_SUPPORTS("avx2") && XSTD_CPU_SUPPORTS("fma") ){
+			check_level<float>(simd_level::avx2);
+			check_level<double>(simd_level::avx2);
+		}
+	}
+
+	SECTION("AVX-512"){
+		if( XSTD_CPU_SUPPORTS("avx512f") ){
+			check_level<float>(simd_level::avx512);
+			check_level<double>(simd_level::avx512);
+		}
+	}
+#endif
+
+	SECTION("Running CPU"){
+		check_kernels<float>(cpu_simd_kernels<float>());
+		check_kernels<double>(cpu_simd_kernels<double>());
+	}
+}
+
+
+TEST_CASE("Maximum Norm Propagates NaN", "[default]") {
+	using namespace xstd;
+
+	auto a = random_vector<double>(101, 13);
+	a[57] = std::numeric_limits<double>::quiet_NaN();
+	REQUIRE( std::isnan(norm_inf(a)) );
+	REQUIRE( std::isnan(norm_inf(a + a)) );
+
+	a[57] = -4;
+	REQUIRE( norm_inf(a) == 4 );
+}
+
+
+TEST_CASE("Deterministic Summation", "[default]") {
+	using namespace xstd;
+
+	const auto a = random_vector<double>(1001, 3);
+	const auto b = random_vector<double>(1001, 5);
+
+	double dot  = 0;
+	double asum = 0;
+	for(std::size_t i = 0; i < a.size(); ++i){
+		dot  += a[i] * b[i];
+		asum += std::abs(a[i]);
+	}
+
+	REQUIRE( dot_product(a, b, summation::deterministic) == dot );
+	REQUIRE( norm1(a, summation::deterministic) == asum );
+	REQUIRE( norm2(a, summation::deterministic) == std::sqrt(dot_product(a, a, summation::deterministic)) );
+
+	// Existing callers keep the in order additions
+	REQUIRE( dot_product(a, b) == dot );
+	REQUIRE( norm1(a) == asum );
+
+	REQUIRE( dot_product(a, b, summation::fast) == Approx(dot) );
+	REQUIRE( norm1(a, summation::fast) == Approx(asum) );
+}
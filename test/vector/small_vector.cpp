@@ -0,0 +1,238 @@
+/*
+ * small_vector.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+#include "lifetime_types.hpp"
+
+#include "xstd/detail/memory/aligned.hpp"
+#include "xstd/detail/memory/allocator/aligned_allocator.hpp"
+#include "xstd/detail/vector/small_vector.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace {
+
+/// Allocator which counts the allocations made
+template<typename T>
+struct counting_allocator : std::allocator<T> {
+	using value_type = T;
+
+	static inline int allocations = 0;
+
+	counting_allocator() = default;
+
+	template<typename U>
+	counting_allocator(const counting_allocator<U>&) noexcept {}
+
+	T* allocate(std::size_t n) {
+		++allocations;
+		return std::allocator<T>::allocate(n);
+	}
+
+	template<typename U>
+	struct rebind { using other = counting_allocator<U>; };
+};
+
+template<typename SV>
+void require_equal(const SV& a, const std::vector<typename SV::value_type>& b){
+	REQUIRE( a.size() == b.size() );
+	REQUIRE( std::equal(a.begin(), a.end(), b.begin(), b.end()) );
+}
+
+template<typename SV>
+std::vector<int> handle_values(const SV& v){
+	std::vector<int> ans;
+	for(const auto& h : v){
+		ans.push_back(*h.value);
+	}
+	return ans;
+}
+
+} // namespace
+
+
+TEST_CASE("Small Vector Inline", "[default]") {
+	using namespace xstd;
+	using alloc_type = counting_allocator<int>;
+
+	alloc_type::allocations = 0;
+	small_vector<int,8,alloc_type> a;
+	REQUIRE( a.empty() );
+	REQUIRE( a.capacity() == 8 );
+	REQUIRE( a.is_inline() );
+
+	for(int i = 0; i < 8; ++i){
+		a.push_back(i);
+	}
+	a.erase(a.begin() + 2);
+	a.insert(a.begin(), -1);
+	a.resize(5);
+	a.emplace_back(9);
+	REQUIRE( a.is_inline() );
+	REQUIRE( alloc_type::allocations == 0 );
+	require_equal(a, {-1, 0, 1, 3, 4, 9});
+
+	// Copies and moves of inline vectors stay inline
+	auto b = a;
+	auto c = std::move(b);
+	REQUIRE( b.empty() );
+	REQUIRE( c == a );
+	REQUIRE( c.is_inline() );
+	REQUIRE( alloc_type::allocations == 0 );
+}
+
+TEST_CASE("Small Vector Spill", "[default]") {
+	using namespace xstd;
+	using alloc_type = counting_allocator<int>;
+
+	alloc_type::allocations = 0;
+	small_vector<int,4,alloc_type> a = {0, 1, 2, 3};
+	REQUIRE( a.is_inline() );
+
+	a.push_back(a[0]); // argument refers to an element
+	REQUIRE( not a.is_inline() );
+	REQUIRE( a.capacity() >= 5 );
+	REQUIRE( alloc_type::allocations == 1 );
+	require_equal(a, {0, 1, 2, 3, 0});
+
+	std::vector<int> expect(1000);
+	std::iota(expect.begin(), expect.end(), 0);
+	a.assign(expect.begin(), expect.end());
+	require_equal(a, expect);
+
+	// Heap storage is stolen on move
+	const auto ptr = a.data();
+	auto b = std::move(a);
+	REQUIRE( b.data() == ptr );
+	REQUIRE( a.empty() );
+	REQUIRE( a.is_inline() );
+
+	// Shrinking returns to inline storage
+	b.resize(3);
+	b.shrink_to_fit();
+	REQUIRE( b.is_inline() );
+	require_equal(b, {0, 1, 2});
+
+	SECTION("Aligned Allocator"){
+		small_vector<double,2,aligned_allocator<double,64>> x(100, 1.0);
+		REQUIRE( not x.is_inline() );
+		REQUIRE( is_aligned(x.data(), 64) );
+	}
+}
+
+TEST_CASE("Small Vector Modifiers", "[default]") {
+	using namespace xstd;
+	using SV = small_vector<std::string,3>;
+
+	SV a = {"a", "b"};
+	std::vector<std::string> v = {"a", "b"};
+
+	a.insert(a.begin() + 1, 3, "x");
+	v.insert(v.begin() + 1, 3, "x");
+	require_equal(a, v);
+
+	const std::vector<std::string> more = {"m", "n"};
+	a.insert(a.end() - 1, more.begin(), more.end());
+	v.insert(v.end() - 1, more.begin(), more.end());
+	require_equal(a, v);
+
+	a.emplace(a.begin(), a.back());
+	v.emplace(v.begin(), v.back());
+	require_equal(a, v);
+
+	a.erase(a.begin() + 1, a.begin() + 4);
+	v.erase(v.begin() + 1, v.begin() + 4);
+	require_equal(a, v);
+
+	REQUIRE( erase(a, "m") == 1 );
+	REQUIRE( erase_if(a, [](const auto& s){ return s == "b"; }) == 2 );
+	require_equal(a, {"x", "n"});
+	REQUIRE_THROWS( a.at(2) );
+
+	SV b = {"1", "2", "3", "4", "5"};
+	SV c = {"6"};
+	swap(b, c);
+	require_equal(b, {"6"});
+	require_equal(c, {"1", "2", "3", "4", "5"});
+	swap(b, c);
+	require_equal(b, {"1", "2", "3", "4", "5"});
+	REQUIRE( b < c );
+
+	b.assign(2, "z");
+	require_equal(b, {"z", "z"});
+	b.resize(4, b[0]);
+	require_equal(b, {"z", "z", "z", "z"});
+}
+
+TEST_CASE("Small Vector Lifetime", "[default]") {
+	using namespace xstd;
+
+	Counted::reset();
+	{
+		small_vector<Counted,4> a;
+		for(int i = 0; i < 3; ++i){
+			a.emplace_back(i);
+		}
+		REQUIRE( Counted::alive() == 3 );
+
+		small_vector<Counted,4> b(10);
+		REQUIRE( Counted::alive() == 13 );
+
+		a.swap(b);
+		REQUIRE( a.size() == 10 );
+		REQUIRE( b.size() == 3 );
+		REQUIRE( Counted::alive() == 13 );
+
+		b = a;
+		REQUIRE( Counted::alive() == 20 );
+
+		a.clear();
+		b.pop_back();
+		REQUIRE( Counted::alive() == 9 );
+	}
+	REQUIRE( Counted::alive() == 0 );
+}
+
+TEST_CASE("Small Vector Trivially Relocatable", "[default]") {
+	using namespace xstd;
+	using SV = small_vector<Handle,4>;
+
+	SV a;
+	for(int i = 0; i < 4; ++i){
+		a.emplace_back(i);
+	}
+	a.emplace(a.begin() + 1, 10); // spills to the heap
+	REQUIRE( not a.is_inline() );
+	a.insert(a.begin(), Handle(11));
+	REQUIRE( handle_values(a) == std::vector<int>{11, 0, 10, 1, 2, 3} );
+
+	a.erase(a.begin() + 2);
+	a.erase(a.begin(), a.begin() + 3);
+	a.shrink_to_fit();
+	REQUIRE( a.is_inline() );
+	REQUIRE( handle_values(a) == std::vector<int>{2, 3} );
+
+	SV b;
+	b.emplace_back(7);
+	a.swap(b);
+	REQUIRE( handle_values(a) == std::vector<int>{7} );
+	REQUIRE( handle_values(b) == std::vector<int>{2, 3} );
+
+	small_vector<int,4> c = {1, 2, 3};
+	const std::vector<int> more = {4, 5};
+	c.insert(c.begin() + 1, more.begin(), more.end());
+	c.insert(c.end() - 1, 2, c[0]);
+	REQUIRE( std::vector<int>(c.begin(), c.end()) == std::vector<int>{1, 4, 5, 2, 1, 1, 3} );
+}
@@ -0,0 +1,109 @@
+/*
+ * vector_expression.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: bflynt
+ */
+
+
+#include "catch.hpp"
+
+#include "xstd/detail/vector/vector_math.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+
+namespace {
+
+std::vector<double> make_vector(std::size_t n, double value){
+	return std::vector<double>(n, value);
+}
+
+} // namespace
+
+
+TEST_CASE("Vector Expression", "[default]") {
+	using namespace xstd;
+
+	const std::size_t N = 100;
+	std::vector<double> x(N), y(N), z(N);
+	for(std::size_t i = 0; i < N; ++i){
+		x[i] = i;
+		y[i] = 2.0 * i + 1;
+		z[i] = 0.5 * i;
+	}
+	const double a = 3.0;
+	const double b = -2.0;
+
+	SECTION("Fused Evaluation"){
+		std::vector<double> r = a*x + b*y - z;
+		REQUIRE( r.size() == N );
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( r[i] == a*x[i] + b*y[i] - z[i] );
+		}
+		REQUIRE( (a*x + b*y - z) == r );
+		REQUIRE( r == (a*x + b*y - z) );
+	}
+
+	SECTION("Scalar on Either Side"){
+		std::vector<double> r = (1.0 - x) / (2.0 + y) * 4.0;
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( r[i] == Approx((1.0 - x[i]) / (2.0 + y[i]) * 4.0) );
+		}
+	}
+
+	SECTION("Assign Without Temporary"){
+		std::vector<double> r(N, 1.0);
+		const auto* data = r.data();
+		assign(r, r + x * y);
+		REQUIRE( r.data() == data );
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( r[i] == 1.0 + x[i]*y[i] );
+		}
+
+		std::vector<double> e;
+		assign(e, -x);
+		REQUIRE( e == eval(-x) );
+		REQUIRE( e.size() == N );
+	}
+
+	SECTION("Compound Assignment of Expression"){
+		std::vector<double> r(z);
+		r += a*x - y;
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( r[i] == z[i] + (a*x[i] - y[i]) );
+		}
+		r -= 2.0;
+		r *= x;
+		r /= 2.0;
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( r[i] == Approx((z[i] + (a*x[i] - y[i]) - 2.0) * x[i] / 2.0) );
+		}
+	}
+
+	SECTION("Temporary Vectors are Owned"){
+		auto expr = make_vector(N, 2.0) * x;
+		std::vector<double> r = expr;
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( r[i] == 2.0 * x[i] );
+		}
+	}
+
+	SECTION("Mixed Types and Allocators"){
+		std::vector<int> k(N, 3);
+		std::vector<double> r = k * 0.5 + x;
+		REQUIRE( r[10] == 1.5 + x[10] );
+
+		std::vector<float> f = x + k;
+		REQUIRE( f[10] == 13.0f );
+	}
+
+	SECTION("Reductions of Expressions"){
+		REQUIRE( dot_product(x - z, y) == Approx(dot_product(eval(x - z), y)) );
+		REQUIRE( norm1(x - y) == Approx(norm1(eval(x - y))) );
+		REQUIRE( norm2(x - y) == Approx(norm2(eval(x - y))) );
+		REQUIRE( norm_inf(x - y) == Approx(norm_inf(eval(x - y))) );
+	}
+}
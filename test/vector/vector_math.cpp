@@ -12,6 +12,11 @@
 
 #include "xstd/detail/vector/vector_math.hpp"
 
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <vector>
+
 
 using ValueTypes = std::tuple<std::int32_t, std::int64_t, float, double>;
 
@@ -181,3 +186,90 @@ TEMPLATE_LIST_TEST_CASE("Vector Math", "[default]", ValueTypes) {
 
 
 
+
+
+using FloatTypes = std::tuple<float, double>;
+
+TEMPLATE_LIST_TEST_CASE("Vector BLAS-1", "[default]", FloatTypes) {
+	using namespace xstd;
+
+	using value_type = TestType;
+	using aligned_vector = std::vector<value_type, aligned_allocator<value_type,64>>;
+	const std::size_t N = 37;
+
+	std::vector<value_type> x(N);
+	aligned_vector y(N);
+	for(std::size_t i = 0; i < N; ++i){
+		x[i] = value_type(i) - 10;
+		y[i] = value_type(2*i) + 1;
+	}
+
+	SECTION("scal"){
+		auto z = y;
+		scal(value_type(3), z);
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( z[i] == 3*y[i] );
+		}
+	}
+
+	SECTION("axpy"){
+		auto z = y;
+		axpy(value_type(2), x, z);
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( z[i] == 2*x[i] + y[i] );
+		}
+		axpy(value_type(2), z, z);
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( z[i] == 3*(2*x[i] + y[i]) );
+		}
+	}
+
+	SECTION("axpby"){
+		auto z = y;
+		axpby(value_type(2), x, value_type(-1), z);
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( z[i] == 2*x[i] - y[i] );
+		}
+	}
+
+	SECTION("waxpby"){
+		std::vector<value_type> w;
+		waxpby(value_type(2), x, value_type(3), y, w);
+		REQUIRE( w.size() == N );
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( w[i] == 2*x[i] + 3*y[i] );
+		}
+
+		auto z = x;
+		waxpby(value_type(2), z, value_type(3), y, z);
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( z[i] == 2*x[i] + 3*y[i] );
+		}
+
+		z = x;
+		waxpby(value_type(3), y, value_type(2), z, z);
+		for(std::size_t i = 0; i < N; ++i){
+			REQUIRE( z[i] == 3*y[i] + 2*x[i] );
+		}
+	}
+
+	SECTION("dot_norm"){
+		const auto [d, n] = dot_norm(x, y);
+		REQUIRE( d == Approx(dot_product(x, std::vector<value_type>(y.begin(), y.end()))) );
+		REQUIRE( n == Approx(norm2(x)) );
+	}
+
+	SECTION("nrm2"){
+		REQUIRE( nrm2(x) == Approx(norm2(x)) );
+		REQUIRE( nrm2(std::vector<value_type>(N, 0)) == 0 );
+
+		const auto big = std::numeric_limits<value_type>::max() / 4;
+		const std::vector<value_type> b = {big, big, big, big};
+		REQUIRE( std::isfinite(nrm2(b)) );
+		REQUIRE( nrm2(b) == Approx(2*big) );
+
+		const auto tiny = std::numeric_limits<value_type>::min() * 8;
+		const std::vector<value_type> t = {3*tiny, 4*tiny};
+		REQUIRE( nrm2(t) == Approx(5*tiny) );
+	}
+}